@@ -0,0 +1,222 @@
+// Chain Prefetch Header File
+#ifndef CHAIN_PREFETCH_H
+#define CHAIN_PREFETCH_H
+
+#include <algorithm> // std::sort, std::lower_bound
+#include <cstddef>   // std::size_t
+#include <utility>   // std::pair
+#include <vector>
+
+/*
+Why linked-list walks are slow, and what batching can do about it
+
+Walking a chain is POINTER CHASING: the address of node k+1 is stored inside
+node k, so the CPU cannot start loading node k+1 before node k has arrived.
+Once a list is much larger than the caches, every step waits for main memory
+(~100 ns) and the CPU sits idle in between: one miss in flight at a time.
+
+Two ways to do better, depending on what the lookups share:
+
+1) Many lookups in the SAME list (findAllInChain, nodesAtPositions)
+   Interleaving does not help here: every lookup walks the same nodes from
+   the head, so they would all wait for the same misses. Instead answer ALL
+   of them in ONE pass: each node is loaded once instead of once per lookup.
+   The loop also prefetches node->next before doing its per-node work, so
+   that work overlaps the next miss.
+
+2) Lookups in DIFFERENT chains (interleave, findMany, advanceMany)
+   e.g. one lookup per hash bucket / shard / list. These chains are
+   independent, so their misses CAN overlap. Keep a GROUP of G walks in
+   flight and advance them round-robin, one node each:
+
+       walk 0: check node, prefetch next --+
+       walk 1: check node, prefetch next   |  while the others are worked
+       ...                                 |  on, walk 0's next node
+       walk G-1: ...                       |  arrives from memory
+       walk 0: next node is (likely) here <+
+
+   With G misses in flight instead of one, throughput can rise up to ~G
+   times (until the memory system's parallelism runs out, typically 10-20
+   outstanding misses per core). This is "asynchronous memory access
+   chaining" (AMAC): each walk is a small state machine, the C++17 stand-in
+   for a coroutine that suspends at every prefetch.
+
+The functions only assume nodes with `data` and `next` (NodeIterators.h has
+the same convention). Pass the first node (list.begin().node()).
+*/
+
+namespace chainwalk {
+
+// Ask the CPU to start loading the cache line at p (a hint: never faults)
+inline void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#else
+    (void)p;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// 1) One pass, many questions
+// ----------------------------------------------------------------------------
+
+// found[i] = first node whose data == keys[i], or nullptr. The walk stops at
+// `end` (nullptr for a normal list; the first node again for a ring) or as
+// soon as every key has been found. O(length * log n + n log n).
+template <typename NodeT, typename T>
+void findAllInChain(NodeT* first, const NodeT* end, const T* keys, std::size_t n, NodeT** found) {
+    std::vector<std::pair<T, std::size_t>> sorted(n);   // (key, query index)
+    for (std::size_t i = 0; i < n; i++) {
+        sorted[i] = {keys[i], i};
+        found[i] = nullptr;
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::size_t remaining = n;
+
+    NodeT* node = first;
+    if (node == nullptr || n == 0) return;
+    do {
+        NodeT* next = node->next;
+        prefetch(next);   // start the next miss before the lookup work below
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), node->data,
+                                   [](const std::pair<T, std::size_t>& entry, const T& value) { return entry.first < value; });
+        for (; it != sorted.end() && !(node->data < it->first); ++it) {
+            if (found[it->second] == nullptr) {
+                found[it->second] = node;
+                remaining--;
+            }
+        }
+        if (remaining == 0) return;
+        node = next;
+    } while (node != end && node != nullptr);
+}
+
+// out[i] = node at 1-based position positions[i], or nullptr if out of range.
+// Positions are visited in sorted order, so the chain is walked once.
+template <typename NodeT>
+void nodesAtPositions(NodeT* first, const int* positions, std::size_t n, NodeT** out) {
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; i++) {
+        order[i] = i;
+        out[i] = nullptr;
+    }
+    std::sort(order.begin(), order.end(), [positions](std::size_t a, std::size_t b) { return positions[a] < positions[b]; });
+
+    std::size_t k = 0;
+    while (k < n && positions[order[k]] < 1) k++;   // invalid positions stay nullptr
+    NodeT* node = first;
+    int position = 1;
+    while (node != nullptr && k < n) {
+        NodeT* next = node->next;
+        prefetch(next);
+        while (k < n && positions[order[k]] == position) out[order[k++]] = node;
+        node = next;
+        position++;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// 2) Interleaved walks over independent chains
+//
+// interleave(jobs, group, start, step): the scheduling loop alone.
+//   start(job, cursor) -> bool  set up `cursor` for job; false if the job is
+//                               already complete (e.g. its chain is empty)
+//   step(cursor)       -> bool  advance one node; true while still running.
+//                               It should prefetch the node it moves to.
+// Up to `group` cursors (at most MAX_GROUP) are in flight at any time.
+// ----------------------------------------------------------------------------
+const std::size_t MAX_GROUP = 64;
+
+template <typename Cursor, typename Start, typename Step>
+void interleave(std::size_t jobs, std::size_t group, Start start, Step step) {
+    if (group == 0) group = 1;
+    if (group > MAX_GROUP) group = MAX_GROUP;
+
+    Cursor cursors[MAX_GROUP];
+    std::size_t nextJob = 0;
+    std::size_t active = 0;
+
+    // Load the next job that still needs walking into `slot`
+    auto refill = [&](Cursor& slot) {
+        while (nextJob < jobs) {
+            if (start(nextJob++, slot)) return true;
+        }
+        return false;
+    };
+
+    while (active < group && refill(cursors[active])) active++;
+    while (active > 0) {
+        for (std::size_t i = 0; i < active;) {
+            if (step(cursors[i]) || refill(cursors[i])) {
+                i++;
+            } else {
+                cursors[i] = cursors[--active];   // retire: move the last cursor here
+            }
+        }
+    }
+}
+
+// found[j] = first node equal to keys[j] in the chain starting at starts[j]
+// (nullptr if absent). Ring = true for circular lists: stop after one lap.
+template <bool Ring = false, typename NodeT, typename T>
+void findMany(NodeT* const* starts, const T* keys, std::size_t n, NodeT** found, std::size_t group = 16) {
+    struct Cursor {
+        NodeT* node;
+        const NodeT* stop;
+        std::size_t job;
+    };
+    interleave<Cursor>(
+        n, group,
+        [&](std::size_t job, Cursor& c) {
+            found[job] = nullptr;
+            if (starts[job] == nullptr) return false;
+            prefetch(starts[job]);
+            c = Cursor{starts[job], Ring ? starts[job] : nullptr, job};
+            return true;
+        },
+        [&](Cursor& c) {
+            if (c.node->data == keys[c.job]) {
+                found[c.job] = c.node;
+                return false;
+            }
+            NodeT* next = c.node->next;
+            if (next == c.stop) return false;
+            prefetch(next);
+            c.node = next;
+            return true;
+        });
+}
+
+// out[j] = the node `steps[j]` links after starts[j] (nullptr if the chain
+// ends first): getNodeAtPosition(steps + 1) for many chains at once
+template <typename NodeT>
+void advanceMany(NodeT* const* starts, const std::size_t* steps, std::size_t n, NodeT** out, std::size_t group = 16) {
+    struct Cursor {
+        NodeT* node;
+        std::size_t left;
+        std::size_t job;
+    };
+    interleave<Cursor>(
+        n, group,
+        [&](std::size_t job, Cursor& c) {
+            out[job] = starts[job];
+            if (starts[job] == nullptr || steps[job] == 0) return false;
+            prefetch(starts[job]);
+            c = Cursor{starts[job], steps[job], job};
+            return true;
+        },
+        [&](Cursor& c) {
+            NodeT* next = c.node->next;
+            if (next == nullptr || --c.left == 0) {
+                out[c.job] = next;
+                return false;
+            }
+            prefetch(next);
+            c.node = next;
+            return true;
+        });
+}
+
+} // namespace chainwalk
+
+#endif // CHAIN_PREFETCH_H
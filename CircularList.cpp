@@ -1,31 +1,70 @@
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <string>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#include <span>
+#endif
+
+#include "ChainPrefetch.h"
+#include "Instrumentation.h"
+#include "ListSnapshot.h"
+#include "MemoryUsage.h"
+#include "ListSort.h"
+#include "NodeArena.h"
+#include "NodeIterators.h"
+#include "Serialization.h"
+
 using namespace std;
 
 // Node structure
+template <typename T>
 struct Node {
-    int data;
+    T data;
     Node* next;
 
-    Node(int value) {
+    Node(const T& value) {
         data = value;
         next = nullptr;
     }
+
+    // deserialize() builds the nodes inside one arena: delete finds out which,
+    // and new refills the arena's holes (NodeArena.h)
+    static void* operator new(std::size_t bytes) { return nodearena::Registry<Node>::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) {
+        nodearena::Registry<Node>::deallocate(p, bytes);
+    }
 };
 
 // Circular Singly Linked List class
+template <typename T = int>
 class CircularLinkedList {
 private:
-    Node* head;
+    Node<T>* head;
+    std::size_t nodeCount;   // number of nodes in the ring
 
 public:
+    // Iterators walk exactly ONE lap, starting at head
+    using iterator = RingIterator<Node<T>, T>;
+    using const_iterator = RingIterator<const Node<T>, const T>;
+    // Cursor that never stops (wraps from the last node back to head)
+    using cursor = CircularCursor<Node<T>, T>;
+
     // Constructor
     CircularLinkedList() {
         head = nullptr;
+        nodeCount = 0;
     }
 
     // Insert node at the end of the list
-    void insertNode(int value) {
-        Node* newNode = new Node(value);
+    void insertNode(const T& value) {
+        DS_COUNT_OP("CircularLinkedList", "insertNode");
+        DS_TRAVERSAL_SCOPE("CircularLinkedList", "insertNode", steps);
+        Node<T>* newNode = new Node<T>(value);
+        DS_COUNT_ALLOC("CircularLinkedList");
+        nodeCount++;
 
         // Case 1: Empty list
         if (head == nullptr) {
@@ -33,11 +72,12 @@ public:
             newNode->next = head;   // Point to itself (circular)
         }
         else {
-            Node* current = head;
+            Node<T>* current = head;
 
             // Traverse until last node
             while (current->next != head) {
                 current = current->next;
+                DS_TRAVERSAL_STEP(steps);
             }
 
             current->next = newNode;  // Link last node to new node
@@ -45,6 +85,23 @@ public:
         }
     }
 
+    // Range access for one lap (range-for, <algorithm>, std::execution)
+    iterator begin() { return iterator(head, head, 0); }
+    iterator end() { return iterator(head, head, head == nullptr ? 0 : 1); }
+    const_iterator begin() const { return const_iterator(head, head, 0); }
+    const_iterator end() const { return const_iterator(head, head, head == nullptr ? 0 : 1); }
+
+    // Endless round-robin cursor starting at head
+    cursor ringCursor() { return cursor(head); }
+
+    std::size_t size() const { return nodeCount; }
+    bool isEmpty() const { return head == nullptr; }
+
+    // Footprint breakdown (see MemoryUsage.h); walks exactly one lap, O(n)
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::nodeChainUsage<Node<T>, T>(head, nodeCount, sizeof(*this));
+    }
+
     // Display the circular linked list
     void display() {
         if (head == nullptr) {
@@ -52,7 +109,7 @@ public:
             return;
         }
 
-        Node* current = head;
+        Node<T>* current = head;
 
         cout << "Circular Linked List: ";
         do {
@@ -63,13 +120,94 @@ public:
         cout << "(head)" << endl;
     }
 
-    // Destructor to free memory
-    ~CircularLinkedList() {
+    // Search for many values in ONE lap (see ChainPrefetch.h):
+    // found[i] = is keys[i] in the ring? Stops early once all are found.
+    void searchMany(const T* keys, std::size_t n, bool* found) const {
+        DS_COUNT_OP("CircularLinkedList", "searchMany");
+        std::vector<const Node<T>*> nodes(n);
+        chainwalk::findAllInChain<const Node<T>>(head, head, keys, n, nodes.data());
+        for (std::size_t i = 0; i < n; i++) found[i] = nodes[i] != nullptr;
+    }
+
+#if __cplusplus >= 202002L
+    void searchMany(std::span<const T> keys, std::span<bool> found) const {
+        searchMany(keys.data(), std::min(keys.size(), found.size()), found.data());
+    }
+#endif
+
+    // Sort the ring with an LSD radix sort (see ListSort.h)
+    // 1) open the ring into a normal chain (last->next = nullptr)
+    // 2) radix sort it: nodes are re-linked through 256 buckets, not copied
+    // 3) close the ring again: the smallest value becomes the new head
+    void radixSort() {
+        if (head == nullptr)
+            return;
+
+        Node<T>* last = head;
+        while (last->next != head) {
+            last = last->next;
+        }
+        last->next = nullptr;
+
+        Node<T>* sortedTail = nullptr;
+        head = listsort::radixSort(head, &sortedTail);
+        sortedTail->next = head;
+    }
+
+    // Write the ring to a snapshot file, starting at head (layout in ListSnapshot.h)
+    void saveSnapshot(const string& path) const {
+        snapshot::SnapshotWriter<T> writer(path, snapshot::Kind::CircularLinkedList);
+        if (head != nullptr) {
+            Node<T>* current = head;
+            do {
+                writer.append(current->data);
+                current = current->next;
+            } while (current != head);
+        }
+        writer.finish();
+    }
+
+    // Rebuild the ring from a mapped snapshot in one pass. The new chain is
+    // built first (buildChain deletes it again if an allocation throws), so
+    // on failure the ring keeps its old contents.
+    void loadSnapshot(const snapshot::SnapshotView<T>& view) {
+        auto value = view.begin();
+        Node<T>* tail = nullptr;
+        Node<T>* first = nodearena::buildChain<Node<T>>(view.size(), [&value] { return *value++; }, &tail);
+        if (tail != nullptr) {
+            tail->next = first;   // close the circle
+        }
+        clear();
+        head = first;
+        nodeCount = view.size();
+        DS_COUNT_ALLOCS("CircularLinkedList", nodeCount);
+    }
+
+    // Binary serialization, one lap from head (format in Serialization.h)
+    void serialize(const string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        serial::save<T>(path, serial::Kind::CircularLinkedList, begin(), end(), nodeCount, encoding);
+    }
+
+    // Rebuild the ring with every node in ONE allocation (NodeArena.h buildChain)
+    void deserialize(const string& path) {
+        serial::Reader<T> in(path);
+        clear();
+        Node<T>* tail = nullptr;
+        head = nodearena::buildChain<Node<T>>(in.size(), [&in] { return in.next(); }, &tail);
+        if (tail != nullptr) {
+            tail->next = head;    // close the circle
+        }
+        nodeCount = in.size();
+        DS_COUNT_ALLOCS("CircularLinkedList", nodeCount);
+    }
+
+    // Free every node and leave an empty ring
+    void clear() {
         if (head == nullptr)
             return;
 
-        Node* current = head->next;
-        Node* temp;
+        Node<T>* current = head->next;
+        Node<T>* temp;
 
         while (current != head) {
             temp = current;
@@ -78,11 +216,25 @@ public:
         }
 
         delete head;
+        DS_COUNT_FREES("CircularLinkedList", nodeCount);
         head = nullptr;
+        nodeCount = 0;
+    }
+
+    // Destructor to free memory
+    ~CircularLinkedList() {
+        clear();
     }
 };
 
+#if __cplusplus >= 202002L
+static_assert(std::ranges::forward_range<CircularLinkedList<>>);
+static_assert(std::ranges::sized_range<CircularLinkedList<>>);
+#endif
+
 // Main function
+// (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+#ifndef DS_NO_DEMO_MAIN
 int main() {
     CircularLinkedList list;
 
@@ -93,5 +245,30 @@ int main() {
 
     list.display();
 
+    list.insertNode(-5);
+    list.insertNode(25);
+    list.radixSort();
+    list.display();
+
+    // One lap with a range-for
+    int sum = 0;
+    for (int value : list) sum += value;
+    cout << "Sum of " << list.size() << " nodes: " << sum << endl;
+
+    // Round-robin: the cursor keeps wrapping past the last node
+    CircularLinkedList<>::cursor rr = list.ringCursor();
+    cout << "Round robin (6 turns): ";
+    for (int turn = 0; turn < 6; turn++) {
+        cout << rr.next() << " ";
+    }
+    cout << endl;
+
+    // Several searches in one lap
+    int wanted[3] = {25, 99, -5};
+    bool present[3];
+    list.searchMany(wanted, 3, present);
+    cout << "searchMany {25, 99, -5}: " << present[0] << present[1] << present[2] << endl;
+
     return 0;
 }
+#endif // DS_NO_DEMO_MAIN
@@ -0,0 +1,438 @@
+// Epoch Reclamation Header File
+#ifndef EPOCH_RECLAIM_H
+#define EPOCH_RECLAIM_H
+
+#include <atomic>
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <mutex>
+#include <stdexcept> // std::runtime_error
+#include <thread>    // std::this_thread::yield
+#include <vector>
+
+/*
+When may a node that readers can still see be deleted?
+
+Lock-free readers walk a list without taking any lock. A writer that
+unlinks node X cannot `delete X` right away: a reader that loaded the
+pointer to X a moment earlier may still be standing on it. Epoch-based
+reclamation answers "when is nobody standing on X any more?":
+
+  - A global epoch number E only ever grows.
+  - A reader enters a critical section by announcing "I am in epoch E" in
+    its own slot (Guard), and clears the slot when it leaves.
+  - retire(X) does not free X; it files X under the current epoch.
+  - E may advance to E+1 once every ACTIVE reader has announced E (nobody
+    is still in E-1). Anything retired in epoch E-2 or earlier was unlinked
+    before every current reader started, so it is unreachable: free it.
+
+Readers pay one store (+ fence) on entry and one on exit: no lock, no
+shared counter they all write to. Writers pay for the bookkeeping, in
+batches (every RECLAIM_BATCH retires).
+
+Rules:
+  - only dereference shared nodes while a Guard is alive
+  - a Guard may be nested (the inner one is free), but not moved to another
+    thread
+  - each reader thread takes a slot in every Domain it reads; the slot
+    tables grow in chunks of SLOTS_PER_CHUNK, up to MAX_THREADS threads at
+    once (one more throws std::runtime_error)
+  - a reader that stays inside a Guard forever stops reclamation (memory
+    then grows, it is never freed early)
+
+QuiescentDomain (below) is the RCU "quiescent-state" flavour of the same
+idea, for read-mostly data: a reader pays NOTHING per read section. Instead
+each reader thread goes online() once and calls quiescent() now and then at
+a point where it holds no shared pointer (e.g. between two requests). A node
+retired at epoch E is freed once every online reader has passed a quiescent
+point after E, or gone offline. Writers pay; readers only publish "I am
+past E" with a plain store.
+
+A thread keeps its slot number from its first Guard or online() until it
+exits (the thread_local destructor gives it back), so a reader that is
+not registered pays for the pool lock once per thread, not once per read.
+*/
+
+namespace epoch {
+
+const std::size_t SLOTS_PER_CHUNK = 64;
+const std::size_t MAX_CHUNKS = 1024;
+const std::size_t MAX_THREADS = SLOTS_PER_CHUNK * MAX_CHUNKS;   // 65536 at once
+const std::size_t RECLAIM_BATCH = 64;
+const std::size_t NO_SLOT = ~std::size_t(0);
+
+// ----------------------------------------------------------------------------
+// Thread numbers: process-wide, in [0, MAX_THREADS), the smallest free one
+// first. A thread takes its number on first use (a Guard or online()) and
+// gives it back when it exits.
+// ----------------------------------------------------------------------------
+struct SlotPool {
+    std::mutex lock;
+    std::vector<std::size_t> free;   // numbers given back, reused first
+    std::size_t next = 0;            // numbers never handed out start here
+};
+
+inline SlotPool& slotPool() {
+    static SlotPool pool;
+    return pool;
+}
+
+struct ThreadSlot {
+    std::size_t index = NO_SLOT;
+
+    void acquire() {
+        SlotPool& pool = slotPool();
+        std::lock_guard<std::mutex> guard(pool.lock);
+        if (!pool.free.empty()) {
+            index = pool.free.back();
+            pool.free.pop_back();
+        } else if (pool.next < MAX_THREADS) {
+            index = pool.next++;
+        } else {
+            throw std::runtime_error("epoch: more than MAX_THREADS reader threads at once");
+        }
+    }
+    void release() {
+        SlotPool& pool = slotPool();
+        std::lock_guard<std::mutex> guard(pool.lock);
+        pool.free.push_back(index);
+        index = NO_SLOT;
+    }
+    ~ThreadSlot() {
+        if (index != NO_SLOT) release();
+    }
+};
+
+inline ThreadSlot& threadState() {
+    thread_local ThreadSlot state;
+    return state;
+}
+
+// The calling thread's number, taken on first use and kept until it exits
+inline std::size_t threadSlot() {
+    ThreadSlot& state = threadState();
+    if (state.index == NO_SLOT) state.acquire();
+    return state.index;
+}
+
+// The calling thread's number, or NO_SLOT when it holds none
+inline std::size_t currentSlot() {
+    return threadState().index;
+}
+
+// ----------------------------------------------------------------------------
+// SlotTable<Slot>: a domain's per-thread slots, indexed by thread number.
+// Chunks are allocated the first time a number in them is used and stay
+// until the domain is destroyed, so a Slot never moves while readers and
+// the reclaimer look at it.
+// ----------------------------------------------------------------------------
+template <typename Slot>
+class SlotTable {
+public:
+    SlotTable() = default;
+    ~SlotTable() {
+        for (std::atomic<Slot*>& chunk : chunks_) delete[] chunk.load(std::memory_order_relaxed);
+    }
+
+    SlotTable(const SlotTable&) = delete;
+    SlotTable& operator=(const SlotTable&) = delete;
+
+    Slot& operator[](std::size_t index) {
+        Slot* chunk = chunks_[index / SLOTS_PER_CHUNK].load(std::memory_order_acquire);
+        if (chunk == nullptr) chunk = grow(index / SLOTS_PER_CHUNK);
+        return chunk[index % SLOTS_PER_CHUNK];
+    }
+
+    // Every slot allocated so far. The reader publishes its chunk before
+    // the fence of its announcement, so a scan after the reclaimer's fence
+    // finds every reader that may hold a shared pointer.
+    template <typename Visit>
+    void forEach(Visit visit) const {
+        std::size_t used = used_.load(std::memory_order_acquire);
+        for (std::size_t c = 0; c < used; c++) {
+            const Slot* chunk = chunks_[c].load(std::memory_order_acquire);
+            if (chunk == nullptr) continue;
+            for (std::size_t i = 0; i < SLOTS_PER_CHUNK; i++) visit(chunk[i]);
+        }
+    }
+
+private:
+    std::atomic<Slot*> chunks_[MAX_CHUNKS] = {};
+    std::atomic<std::size_t> used_{0};   // chunks_[used_ ..] are all null
+
+    Slot* grow(std::size_t c) {
+        Slot* fresh = new Slot[SLOTS_PER_CHUNK];
+        Slot* expected = nullptr;
+        if (!chunks_[c].compare_exchange_strong(expected, fresh, std::memory_order_acq_rel)) {
+            delete[] fresh;   // another thread of the same chunk won
+            fresh = expected;
+        }
+        std::size_t used = used_.load(std::memory_order_relaxed);
+        while (used < c + 1 && !used_.compare_exchange_weak(used, c + 1, std::memory_order_acq_rel)) {
+            // `used` was reloaded: retry unless another thread went past c
+        }
+        return fresh;
+    }
+};
+
+class Domain {
+public:
+    static const std::uint64_t IDLE = ~std::uint64_t(0);
+
+private:
+    struct alignas(64) Slot {                // own cache line: no false sharing
+        std::atomic<std::uint64_t> epoch{IDLE};
+        unsigned depth = 0;                  // nesting, touched by the owner only
+    };
+
+public:
+    Domain() = default;
+    ~Domain() { drain(); }
+
+    Domain(const Domain&) = delete;
+    Domain& operator=(const Domain&) = delete;
+
+    // ------------------------------------------------------------------------
+    // Guard: read-side critical section (RAII)
+    // ------------------------------------------------------------------------
+    class Guard {
+    public:
+        explicit Guard(Domain& domain) : slot_(domain.slots_[threadSlot()]) {
+            if (slot_.depth++ == 0) {
+                slot_.epoch.store(domain.epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                // the announcement must be visible before any shared pointer is read
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+        ~Guard() {
+            if (--slot_.depth == 0) slot_.epoch.store(IDLE, std::memory_order_release);
+        }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Slot& slot_;
+    };
+
+    // Free `p` (with `delete`) once no reader can still hold it. The caller
+    // must already have unlinked p so new readers cannot find it.
+    template <typename T>
+    void retire(T* p) {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        limbo_.push_back(Retired{p, [](void* q) { delete static_cast<T*>(q); },
+                                 epoch_.load(std::memory_order_relaxed)});
+        if (++sinceReclaim_ >= RECLAIM_BATCH) {
+            sinceReclaim_ = 0;
+            reclaimLocked();
+        }
+    }
+
+    // Try to advance the epoch and free what has become unreachable
+    void reclaim() {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        reclaimLocked();
+    }
+
+    // Free everything retired. Only when no reader can be active (destructor).
+    void drain() {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        for (const Retired& r : limbo_) r.free(r.pointer);
+        limbo_.clear();
+    }
+
+    std::size_t pending() const {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        return limbo_.size();
+    }
+
+private:
+    struct Retired {
+        void* pointer;
+        void (*free)(void*);
+        std::uint64_t epoch;
+    };
+
+    std::atomic<std::uint64_t> epoch_{1};
+    SlotTable<Slot> slots_;
+    mutable std::mutex limboLock_;
+    std::vector<Retired> limbo_;
+    std::size_t sinceReclaim_ = 0;
+
+    void reclaimLocked() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);   // pairs with Guard's fence
+        std::uint64_t current = epoch_.load(std::memory_order_relaxed);
+        bool everyoneCurrent = true;
+        slots_.forEach([&](const Slot& slot) {
+            std::uint64_t e = slot.epoch.load(std::memory_order_acquire);
+            if (e != IDLE && e != current) everyoneCurrent = false;
+        });
+        if (everyoneCurrent) epoch_.store(++current, std::memory_order_release);
+
+        std::size_t kept = 0;
+        for (const Retired& r : limbo_) {
+            if (r.epoch + 2 <= current) r.free(r.pointer);
+            else limbo_[kept++] = r;
+        }
+        limbo_.resize(kept);
+    }
+};
+
+// ============================================================================
+// QuiescentDomain: quiescent-state-based reclamation (QSBR, RCU style)
+// ============================================================================
+class QuiescentDomain {
+public:
+    static const std::uint64_t OFFLINE = ~std::uint64_t(0);
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::uint64_t> seen{OFFLINE};   // last epoch this reader was quiescent in
+        bool online = false;                         // touched by the owner only
+    };
+
+public:
+    QuiescentDomain() = default;
+    ~QuiescentDomain() { drain(); }
+
+    QuiescentDomain(const QuiescentDomain&) = delete;
+    QuiescentDomain& operator=(const QuiescentDomain&) = delete;
+
+    // ------------------------------------------------------------------------
+    // Reader side (each call acts on the calling thread only)
+    // ------------------------------------------------------------------------
+    // Start reading. Rare, so it may pay for a full fence: the announcement
+    // must be visible before the first shared pointer is read.
+    void online() {
+        std::size_t index = currentSlot();
+        if (index != NO_SLOT && slots_[index].online) return;
+        Slot& slot = slots_[threadSlot()];
+        slot.online = true;
+        // acquire: a newer epoch also brings the unlink that preceded it
+        slot.seen.store(epoch_.load(std::memory_order_acquire), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    // "I hold no shared pointer right now." Two plain moves on x86/ARM.
+    void quiescent() {
+        std::size_t index = currentSlot();
+        if (index == NO_SLOT) return;   // not online anywhere
+        Slot& slot = slots_[index];
+        if (slot.online) slot.seen.store(epoch_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // Stop reading (e.g. before blocking for a long time or exiting). The
+    // thread keeps its number: the next online() takes no lock.
+    void offline() {
+        std::size_t index = currentSlot();
+        if (index == NO_SLOT) return;
+        Slot& slot = slots_[index];
+        if (!slot.online) return;
+        slot.online = false;
+        slot.seen.store(OFFLINE, std::memory_order_release);
+    }
+
+    bool isOnline() {
+        std::size_t index = currentSlot();
+        return index != NO_SLOT && slots_[index].online;
+    }
+
+    // A read section for a thread that may not be online: free when it is,
+    // online() + offline() around the section when it is not
+    class ReadSection {
+    public:
+        explicit ReadSection(QuiescentDomain& domain) : domain_(domain), temporary_(!domain.isOnline()) {
+            if (temporary_) domain_.online();
+        }
+        ~ReadSection() {
+            if (temporary_) domain_.offline();
+        }
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) = delete;
+
+    private:
+        QuiescentDomain& domain_;
+        bool temporary_;
+    };
+
+    // ------------------------------------------------------------------------
+    // Writer side. The caller must NOT hold shared pointers from a read
+    // section (it counts as quiescent here).
+    // ------------------------------------------------------------------------
+    // Free `p` (with `delete`) after a grace period. p must be unlinked.
+    template <typename T>
+    void retire(T* p) {
+        quiescent();
+        std::lock_guard<std::mutex> guard(limboLock_);
+        // readers that see the new epoch also see the unlink (release)
+        std::uint64_t e = epoch_.fetch_add(1, std::memory_order_acq_rel);
+        limbo_.push_back(Retired{p, [](void* q) { delete static_cast<T*>(q); }, e});
+        reclaimLocked();
+    }
+
+    // Free what every online reader can no longer reach (never waits)
+    void reclaim() {
+        quiescent();
+        std::lock_guard<std::mutex> guard(limboLock_);
+        reclaimLocked();
+    }
+
+    // Wait for a full grace period, then free everything retired before the
+    // call (the blocking synchronize_rcu())
+    void synchronize() {
+        quiescent();
+        std::uint64_t target = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        quiescent();
+        while (oldestSeen() < target) std::this_thread::yield();
+        reclaim();
+    }
+
+    // Free everything retired. Only when no reader can be active (destructor).
+    void drain() {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        for (const Retired& r : limbo_) r.free(r.pointer);
+        limbo_.clear();
+    }
+
+    std::size_t pending() const {
+        std::lock_guard<std::mutex> guard(limboLock_);
+        return limbo_.size();
+    }
+
+private:
+    struct Retired {
+        void* pointer;
+        void (*free)(void*);
+        std::uint64_t epoch;
+    };
+
+    std::atomic<std::uint64_t> epoch_{1};
+    SlotTable<Slot> slots_;
+    mutable std::mutex limboLock_;
+    std::vector<Retired> limbo_;
+
+    // Smallest epoch an online reader may still be reading in
+    std::uint64_t oldestSeen() const {
+        std::atomic_thread_fence(std::memory_order_seq_cst);   // pairs with online()'s fence
+        std::uint64_t oldest = OFFLINE;
+        slots_.forEach([&](const Slot& slot) {
+            std::uint64_t seen = slot.seen.load(std::memory_order_acquire);
+            if (seen < oldest) oldest = seen;
+        });
+        return oldest;
+    }
+
+    // Retired at epoch e: freed once every online reader has seen e + 1
+    void reclaimLocked() {
+        std::uint64_t oldest = oldestSeen();
+        std::size_t kept = 0;
+        for (const Retired& r : limbo_) {
+            if (r.epoch < oldest) r.free(r.pointer);
+            else limbo_[kept++] = r;
+        }
+        limbo_.resize(kept);
+    }
+};
+
+} // namespace epoch
+
+#endif // EPOCH_RECLAIM_H
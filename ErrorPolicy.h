@@ -0,0 +1,241 @@
+// Error Policy Header File
+#ifndef ERROR_POLICY_H
+#define ERROR_POLICY_H
+
+#include <stdexcept> // std::overflow_error, std::underflow_error, std::out_of_range
+#include <type_traits> // std::is_arithmetic
+#include <utility>   // std::move
+#if __cplusplus >= 202302L
+#include <expected>
+#endif
+
+/*
+Error policies: HOW a container reports overflow / underflow / not found
+
+The array stack, the simple queue, the list stack and LinkedListImplementation
+used to print a message with `endl` (which flushes cout) on errors, and the
+array containers on EVERY push/pop as well. Inside a tight loop that turns
+each operation into a system call and makes threads queue on the stream lock.
+
+These containers now take the policy as their LAST template parameter
+(after the element type and, for the arrays, the capacity):
+
+  StackArrayImplementation<>                                 Print (default, same as before)
+  StackArrayImplementation<int, MAX, errpolicy::Silent>      no I/O at all
+  StackArrayImplementation<int, MAX, errpolicy::Throw>       exceptions
+  StackArrayImplementation<int, MAX, errpolicy::ReturnExpected>  Expected<T> results
+  StackArrayImplementation<int, MAX, errpolicy::Callback<f>> calls f(error, where)
+  StackListImp<int, errpolicy::Silent>, LinkedListImplementation<int, ...>: same idea
+
+Every policy provides:
+  verbose               true only for Print: the container's study-guide
+                        messages are written inside `if constexpr`, so every
+                        other policy compiles to code with no iostream calls
+  status_type           return type of operations that return nothing
+                        (push, enqueue, deleteNode)
+  result<T>             return type of operations that return a value
+                        (pop, peek, dequeue)
+  ok() / fail(e, where)                 build a status_type (all constexpr, so
+                                        fixed-capacity containers stay usable
+                                        in constant expressions)
+  value(v) / failValue(e, where, s)     build a result<T>; `s` is the old
+                                        -1 style sentinel for policies that
+                                        return plain values
+
+                 status_type      result<T>     on error
+  Print          void             T             message on cout, sentinel
+  Silent         bool (success)   T             sentinel, nothing printed
+  Throw          void             T             throws (overflow_error,
+                                                underflow_error, out_of_range)
+  ReturnExpected Expected<void>   Expected<T>   unexpected(Error)
+  Callback<f>    bool (success)   T             f(error, where), sentinel
+*/
+
+namespace errpolicy {
+
+enum class Error {
+    Overflow,   // container is full
+    Underflow,  // container is empty
+    NotFound    // value to remove does not exist
+};
+
+inline const char* toString(Error e) {
+    switch (e) {
+    case Error::Overflow: return "overflow";
+    case Error::Underflow: return "underflow";
+    case Error::NotFound: return "not found";
+    }
+    return "unknown";
+}
+
+// ----------------------------------------------------------------------------
+// Expected<T>: std::expected<T, Error> when the library has it (C++23),
+// otherwise a small stand-in with the same basic interface.
+// ----------------------------------------------------------------------------
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+template <typename T>
+using Expected = std::expected<T, Error>;
+
+constexpr std::unexpected<Error> makeUnexpected(Error e) { return std::unexpected<Error>(e); }
+#else
+struct Unexpected {
+    Error error;
+};
+
+constexpr Unexpected makeUnexpected(Error e) { return Unexpected{e}; }
+
+template <typename T>
+class Expected {
+public:
+    constexpr Expected(T value) : value_(std::move(value)), error_(), hasValue_(true) {}
+    constexpr Expected(Unexpected u) : value_(), error_(u.error), hasValue_(false) {}
+
+    constexpr bool has_value() const { return hasValue_; }
+    constexpr explicit operator bool() const { return hasValue_; }
+    constexpr const T& value() const {
+        if (!hasValue_) throw std::logic_error("Expected::value() called on an error");
+        return value_;
+    }
+    constexpr const T& operator*() const { return value_; }
+    constexpr Error error() const { return error_; }
+    constexpr T value_or(T fallback) const { return hasValue_ ? value_ : fallback; }
+
+private:
+    T     value_;
+    Error error_;
+    bool  hasValue_;
+};
+
+template <>
+class Expected<void> {
+public:
+    constexpr Expected() : error_(), hasValue_(true) {}
+    constexpr Expected(Unexpected u) : error_(u.error), hasValue_(false) {}
+
+    constexpr bool has_value() const { return hasValue_; }
+    constexpr explicit operator bool() const { return hasValue_; }
+    constexpr Error error() const { return error_; }
+
+private:
+    Error error_;
+    bool  hasValue_;
+};
+#endif
+
+// ----------------------------------------------------------------------------
+// sentinel<T>(): the "no value" result for policies that return plain values
+// -1 for numbers (as the int containers always did; all bits set for
+// unsigned types), a value-initialized T{} for everything else.
+// ----------------------------------------------------------------------------
+template <typename T>
+constexpr T sentinel() {
+    if constexpr (std::is_arithmetic<T>::value) {
+        return static_cast<T>(-1);
+    } else {
+        return T{};
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Print: the original behaviour (messages on cout, -1 sentinel)
+// ----------------------------------------------------------------------------
+struct Print {
+    static constexpr bool verbose = true;
+    using status_type = void;
+    template <typename T>
+    using result = T;
+
+    static constexpr void ok() {}
+    static constexpr void fail(Error, const char*) {}
+    template <typename T>
+    static constexpr T value(T v) { return v; }
+    template <typename T>
+    static constexpr T failValue(Error, const char*, T sentinel) { return sentinel; }
+};
+
+// ----------------------------------------------------------------------------
+// Silent: no output; callers check the bool / the sentinel
+// ----------------------------------------------------------------------------
+struct Silent {
+    static constexpr bool verbose = false;
+    using status_type = bool;
+    template <typename T>
+    using result = T;
+
+    static constexpr bool ok() { return true; }
+    static constexpr bool fail(Error, const char*) { return false; }
+    template <typename T>
+    static constexpr T value(T v) { return v; }
+    template <typename T>
+    static constexpr T failValue(Error, const char*, T sentinel) { return sentinel; }
+};
+
+// ----------------------------------------------------------------------------
+// Throw: errors become exceptions (the success path costs nothing extra)
+// ----------------------------------------------------------------------------
+struct Throw {
+    static constexpr bool verbose = false;
+    using status_type = void;
+    template <typename T>
+    using result = T;
+
+    static constexpr void ok() {}
+    [[noreturn]] static void fail(Error e, const char* where) {  // never constant: always throws
+        switch (e) {
+        case Error::Overflow: throw std::overflow_error(where);
+        case Error::Underflow: throw std::underflow_error(where);
+        case Error::NotFound: break;
+        }
+        throw std::out_of_range(where);
+    }
+    template <typename T>
+    static constexpr T value(T v) { return v; }
+    template <typename T>
+    [[noreturn]] static constexpr T failValue(Error e, const char* where, T) { fail(e, where); }
+};
+
+// ----------------------------------------------------------------------------
+// ReturnExpected: the error travels in the return value
+// ----------------------------------------------------------------------------
+struct ReturnExpected {
+    static constexpr bool verbose = false;
+    using status_type = Expected<void>;
+    template <typename T>
+    using result = Expected<T>;
+
+    static constexpr status_type ok() { return status_type(); }
+    static constexpr status_type fail(Error e, const char*) { return makeUnexpected(e); }
+    template <typename T>
+    static constexpr Expected<T> value(T v) { return Expected<T>(std::move(v)); }
+    template <typename T>
+    static constexpr Expected<T> failValue(Error e, const char*, T) { return makeUnexpected(e); }
+};
+
+// ----------------------------------------------------------------------------
+// Callback<Handler>: hand the error to a function chosen at compile time
+// (logging, metrics, a breakpoint...). Returns like Silent afterwards.
+// ----------------------------------------------------------------------------
+template <void (*Handler)(Error, const char*)>
+struct Callback {
+    static constexpr bool verbose = false;
+    using status_type = bool;
+    template <typename T>
+    using result = T;
+
+    static constexpr bool ok() { return true; }
+    static constexpr bool fail(Error e, const char* where) {
+        Handler(e, where);
+        return false;
+    }
+    template <typename T>
+    static constexpr T value(T v) { return v; }
+    template <typename T>
+    static constexpr T failValue(Error e, const char* where, T sentinel) {
+        Handler(e, where);
+        return sentinel;
+    }
+};
+
+} // namespace errpolicy
+
+#endif // ERROR_POLICY_H
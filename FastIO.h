@@ -0,0 +1,414 @@
+// Fast IO Header File
+#ifndef FAST_IO_H
+#define FAST_IO_H
+
+#include <algorithm>   // std::min
+#include <charconv>    // std::from_chars, std::to_chars
+#include <cerrno>      // errno, EINTR
+#include <cstddef>     // std::size_t
+#include <cstring>     // std::memmove, std::memcpy
+#include <limits>      // std::numeric_limits
+#include <stdexcept>   // std::runtime_error
+#include <string>
+#include <type_traits> // std::is_arithmetic, std::void_t
+#include <utility>     // std::declval
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // read, write, close
+#else
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+/*
+Fast text input and output for numbers
+
+`std::cin >> x` in a loop spends most of its time NOT parsing: it takes the
+stream's locale, checks the sentry, formats flags and state bits, and reads
+one char at a time through the streambuf. For a file of 10^7 ints that is
+most of the runtime. `cout << x << endl` is worse: endl flushes, so every
+element is a system call.
+
+NumberReader<T>: numbers from a file or a file descriptor (stdin)
+  - a regular file is mapped with mmap: the kernel pages it in, nothing is
+    copied into a buffer; pipes and terminals are read() into a 1 MiB
+    buffer, and next() returns what has arrived instead of waiting for
+    the buffer to fill
+  - std::from_chars parses each token: no locale, no exceptions, no
+    allocation; it scans the digits and stops at the first separator in
+    the same pass
+  - next(out, max) parses up to max values straight into an array, so a
+    container can take them with ONE bulk append
+
+Writer: numbers to a file or a file descriptor (stdout)
+  - std::to_chars into a 1 MiB buffer, one write() per full buffer
+
+Separators are any of space, tab, newline, carriage return and comma, in
+any amount. Anything else (a letter, "12abc", a number out of T's range)
+throws std::runtime_error with the byte offset, like ListSnapshot.h does
+for a bad file.
+
+appendAll(reader, container) fills LinkedList, SimpleQueue, CircularQueue,
+StackArrayImplementation or RingDeque through their bulk appends, stopping
+early if a fixed-capacity container fills up. Every container's writeTo(out)
+is the bulk counterpart of display(): the values only, one per line, in an
+order that appendAll reads back into the same container.
+*/
+
+namespace fastio {
+
+const std::size_t BUFFER_BYTES = std::size_t(1) << 20;
+const std::size_t MAX_TOKEN_BYTES = 64;   // longer than any int or double
+
+inline bool isSeparator(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == ',';
+}
+
+// ----------------------------------------------------------------------------
+// NumberReader<T>: parses T values (integers or floating point) from text
+//
+//   NumberReader<int> in("values.txt");     // or NumberReader<int> in(0) for stdin
+//   int chunk[4096];
+//   while (std::size_t n = in.next(chunk, 4096)) consume(chunk, n);
+// ----------------------------------------------------------------------------
+template <typename T>
+class NumberReader {
+    static_assert(std::is_arithmetic<T>::value, "NumberReader parses numbers");
+
+private:
+    int fd_;
+    bool ownsFd_;
+    const char* mapped_;      // whole file when mmap worked
+    std::size_t mappedBytes_;
+    std::vector<char> buffer_;
+    const char* pos_;         // next unread byte
+    const char* end_;         // end of the bytes available now
+    const char* start_;       // first byte of the current window (for offsets)
+    std::size_t windowOffset_; // file offset of start_
+    bool eof_;                // no more bytes beyond end_
+
+    // read() mode: keep the unparsed tail and read more after it. Stops as
+    // soon as the window ends on a separator (every token in it is whole),
+    // so a pipe or terminal hands over what it has without waiting for
+    // the buffer to fill.
+    void refill() {
+        std::size_t left = static_cast<std::size_t>(end_ - pos_);
+        windowOffset_ += static_cast<std::size_t>(pos_ - start_);
+        if (left != 0) std::memmove(buffer_.data(), pos_, left);
+        std::size_t filled = left;
+        while (filled < buffer_.size() && !eof_) {
+            if (filled > left && isSeparator(buffer_[filled - 1])) break;
+            ssize_t got = ::read(fd_, buffer_.data() + filled, buffer_.size() - filled);
+            if (got < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("fastio: read failed");
+            }
+            if (got == 0) eof_ = true;
+            filled += static_cast<std::size_t>(got);
+        }
+        start_ = pos_ = buffer_.data();
+        end_ = buffer_.data() + filled;
+    }
+
+    void mapOrBuffer() {
+#if !defined(_WIN32)
+        struct stat info;
+        if (fstat(fd_, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            std::size_t bytes = static_cast<std::size_t>(info.st_size);
+            void* map = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (map != MAP_FAILED) {
+                madvise(map, bytes, MADV_SEQUENTIAL);   // read-ahead aggressively
+                mapped_ = static_cast<const char*>(map);
+                mappedBytes_ = bytes;
+                start_ = pos_ = mapped_;
+                end_ = mapped_ + bytes;
+                eof_ = true;
+                return;
+            }
+        }
+#endif
+        buffer_.resize(BUFFER_BYTES);
+    }
+
+    [[noreturn]] void badToken() const {
+        throw std::runtime_error("fastio: not a number at byte " +
+                                 std::to_string(windowOffset_ + static_cast<std::size_t>(pos_ - start_)));
+    }
+
+public:
+    // Read from a file (mapped when possible)
+    explicit NumberReader(const std::string& path)
+        : fd_(::open(path.c_str(), O_RDONLY)), ownsFd_(true), mapped_(nullptr), mappedBytes_(0),
+          pos_(nullptr), end_(nullptr), start_(nullptr), windowOffset_(0), eof_(false) {
+        if (fd_ < 0) {
+            throw std::runtime_error("fastio: cannot open " + path);
+        }
+        mapOrBuffer();
+    }
+
+    // Read from an open descriptor, e.g. 0 for stdin (not closed afterwards)
+    explicit NumberReader(int fd)
+        : fd_(fd), ownsFd_(false), mapped_(nullptr), mappedBytes_(0), pos_(nullptr), end_(nullptr),
+          start_(nullptr), windowOffset_(0), eof_(false) {
+        mapOrBuffer();
+    }
+
+    NumberReader(const NumberReader&) = delete;
+    NumberReader& operator=(const NumberReader&) = delete;
+
+    ~NumberReader() {
+#if !defined(_WIN32)
+        if (mapped_ != nullptr) munmap(const_cast<char*>(mapped_), mappedBytes_);
+#endif
+        if (ownsFd_) ::close(fd_);
+    }
+
+    bool isMapped() const { return mapped_ != nullptr; }
+
+    // Parse up to max values into out. Returns how many; 0 means the input is
+    // exhausted. Any other count may be followed by more: once it has some
+    // values, next() returns them rather than wait for the next read().
+    std::size_t next(T* out, std::size_t max) {
+        std::size_t count = 0;
+        while (count < max) {
+            while (pos_ != end_ && isSeparator(*pos_)) pos_++;
+            if (pos_ == end_) {
+                if (eof_ || count != 0) break;
+                refill();
+                continue;
+            }
+            // a token may be cut at the end of the buffer: top up first
+            if (!eof_ && !isSeparator(end_[-1]) && static_cast<std::size_t>(end_ - pos_) < MAX_TOKEN_BYTES) {
+                refill();
+            }
+            const char* first = pos_;
+            if (*first == '+') first++;   // from_chars does not take a leading '+'
+            std::from_chars_result result = std::from_chars(first, end_, out[count]);
+            if (result.ptr == end_ && !eof_) {
+                // the token runs to the end of the window: it may go on in
+                // the next read, so parse it again once more bytes are in
+                if (pos_ == buffer_.data() && end_ == buffer_.data() + buffer_.size()) badToken();
+                refill();
+                continue;
+            }
+            if (result.ec != std::errc() || (result.ptr != end_ && !isSeparator(*result.ptr))) badToken();
+            pos_ = result.ptr;
+            count++;
+        }
+        return count;
+    }
+
+    // Every remaining value, appended to values; returns how many
+    std::size_t readAll(std::vector<T>& values) {
+        std::size_t total = 0;
+        for (;;) {
+            std::size_t before = values.size();
+            values.resize(before + 4096);
+            std::size_t got = next(values.data() + before, 4096);
+            values.resize(before + got);
+            total += got;
+            if (got == 0) return total;
+        }
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Writer: numbers as text, buffered
+//
+//   fastio::Writer out;                 // stdout; Writer out("values.txt") for a file
+//   out.write(42);                      // "42\n"
+//   out.writeValues(array, n);
+//   list.writeTo(out);                  // any container in this repository
+//
+// The destructor flushes; call flush() to see write errors as exceptions.
+// ----------------------------------------------------------------------------
+class Writer {
+private:
+    int fd_;
+    bool ownsFd_;
+    char separator_;
+    std::vector<char> buffer_;
+    std::size_t used_;
+
+    void writeOut(const char* data, std::size_t bytes) {
+        while (bytes != 0) {
+            ssize_t put = ::write(fd_, data, bytes);
+            if (put < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("fastio: write failed");
+            }
+            data += put;
+            bytes -= static_cast<std::size_t>(put);
+        }
+    }
+
+public:
+    // Write to a file (created or truncated)
+    explicit Writer(const std::string& path, char separator = '\n')
+        : fd_(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)), ownsFd_(true), separator_(separator),
+          buffer_(BUFFER_BYTES), used_(0) {
+        if (fd_ < 0) {
+            throw std::runtime_error("fastio: cannot open " + path + " for writing");
+        }
+    }
+
+    // Write to an open descriptor, 1 (stdout) by default (not closed afterwards)
+    explicit Writer(int fd = 1, char separator = '\n')
+        : fd_(fd), ownsFd_(false), separator_(separator), buffer_(BUFFER_BYTES), used_(0) {}
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    ~Writer() {
+        try {
+            flush();
+        } catch (const std::runtime_error&) {
+            // nothing sensible to do in a destructor; call flush() to find out
+        }
+        if (ownsFd_) ::close(fd_);
+    }
+
+    void flush() {
+        std::size_t bytes = used_;
+        used_ = 0;
+        writeOut(buffer_.data(), bytes);
+    }
+
+    // One value and the separator
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_arithmetic<T>::value, "Writer formats numbers; use writeText for strings");
+        if (buffer_.size() - used_ < MAX_TOKEN_BYTES) flush();
+        char* first = buffer_.data() + used_;
+        std::to_chars_result result = std::to_chars(first, buffer_.data() + buffer_.size() - 1, value);
+        *result.ptr = separator_;
+        used_ = static_cast<std::size_t>(result.ptr + 1 - buffer_.data());
+    }
+
+    template <typename T>
+    void writeValues(const T* values, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) write(values[i]);
+    }
+
+    // Raw text, no separator added
+    void writeText(const char* text, std::size_t bytes) {
+        if (bytes > buffer_.size() - used_) {
+            flush();
+            if (bytes > buffer_.size()) {
+                writeOut(text, bytes);
+                return;
+            }
+        }
+        std::memcpy(buffer_.data() + used_, text, bytes);
+        used_ += bytes;
+    }
+
+    void writeText(const std::string& text) { writeText(text.data(), text.size()); }
+};
+
+// ----------------------------------------------------------------------------
+// appendAll: reader -> container, in chunks, through the container's bulk
+// append. Which one is picked at compile time:
+//   insertAtEndBulk(p, n)   LinkedList (the last node it returns is passed
+//                           back with the next chunk: one walk in total)
+//   pushBackBulk(p, n)      RingDeque
+//   pushBulk(p, n)          StackArrayImplementation
+//   enqueueBulk(p, n)       SimpleQueue, CircularQueue
+// Fixed-capacity containers take at most room() (or capacity() - size())
+// values; the rest stays in the reader. Returns how many were appended.
+// ----------------------------------------------------------------------------
+template <typename C, typename T, typename = void>
+struct HasInsertAtEndBulk : std::false_type {};
+template <typename C, typename T>
+struct HasInsertAtEndBulk<C, T, std::void_t<decltype(std::declval<C&>().insertAtEndBulk(std::declval<const T*>(), std::size_t()))>>
+    : std::true_type {};
+
+template <typename C, typename T, typename = void>
+struct HasPushBackBulk : std::false_type {};
+template <typename C, typename T>
+struct HasPushBackBulk<C, T, std::void_t<decltype(std::declval<C&>().pushBackBulk(std::declval<const T*>(), std::size_t()))>>
+    : std::true_type {};
+
+template <typename C, typename T, typename = void>
+struct HasPushBulk : std::false_type {};
+template <typename C, typename T>
+struct HasPushBulk<C, T, std::void_t<decltype(std::declval<C&>().pushBulk(std::declval<const T*>(), std::size_t()))>>
+    : std::true_type {};
+
+template <typename C, typename T, typename = void>
+struct HasEnqueueBulk : std::false_type {};
+template <typename C, typename T>
+struct HasEnqueueBulk<C, T, std::void_t<decltype(std::declval<C&>().enqueueBulk(std::declval<const T*>(), std::size_t()))>>
+    : std::true_type {};
+
+template <typename C, typename = void>
+struct HasRoom : std::false_type {};
+template <typename C>
+struct HasRoom<C, std::void_t<decltype(std::declval<const C&>().room())>> : std::true_type {};
+
+template <typename C, typename = void>
+struct HasCapacity : std::false_type {};
+template <typename C>
+struct HasCapacity<C, std::void_t<decltype(C::capacity()), decltype(std::declval<const C&>().size())>>
+    : std::true_type {};
+
+// Values the container can still take
+template <typename C>
+std::size_t roomIn(const C& container) {
+    if constexpr (HasRoom<C>::value) {
+        return container.room();
+    } else if constexpr (HasCapacity<C>::value) {
+        return C::capacity() - container.size();
+    } else {
+        return std::numeric_limits<std::size_t>::max();
+    }
+}
+
+template <typename C, typename T>
+void appendBulk(C& container, const T* values, std::size_t n) {
+    if constexpr (HasInsertAtEndBulk<C, T>::value) {
+        container.insertAtEndBulk(values, n);
+    } else if constexpr (HasPushBackBulk<C, T>::value) {
+        container.pushBackBulk(values, n);
+    } else if constexpr (HasPushBulk<C, T>::value) {
+        container.pushBulk(values, n);
+    } else {
+        static_assert(HasEnqueueBulk<C, T>::value, "container has no bulk append");
+        container.enqueueBulk(values, n);
+    }
+}
+
+// LinkedList has no tail pointer: remember the node its last insertAtEndBulk
+// returned, so the next chunk starts there instead of at the head
+template <typename C, typename T, typename = void>
+struct AppendCursor {
+    void append(C& container, const T* values, std::size_t n) { appendBulk(container, values, n); }
+};
+template <typename C, typename T>
+struct AppendCursor<C, T, std::void_t<decltype(std::declval<C&>().insertAtEndBulk(std::declval<const T*>(), std::size_t(), nullptr))>> {
+    decltype(std::declval<C&>().insertAtEndBulk(std::declval<const T*>(), std::size_t())) tail = nullptr;
+    void append(C& container, const T* values, std::size_t n) { tail = container.insertAtEndBulk(values, n, tail); }
+};
+
+template <typename T, typename C>
+std::size_t appendAll(NumberReader<T>& reader, C& container, std::size_t chunk = 65536) {
+    std::vector<T> values(chunk);
+    AppendCursor<C, T> cursor;
+    std::size_t total = 0;
+    for (;;) {
+        std::size_t want = std::min(chunk, roomIn(container));
+        if (want == 0) return total;
+        std::size_t got = reader.next(values.data(), want);
+        if (got == 0) return total;
+        cursor.append(container, values.data(), got);
+        total += got;
+    }
+}
+
+} // namespace fastio
+
+#endif // FAST_IO_H
@@ -0,0 +1,530 @@
+// Instrumentation Header File
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h> // perf_event_attr, PERF_* constants
+#include <sys/ioctl.h>        // ioctl (enable / disable / reset counters)
+#include <sys/syscall.h>      // SYS_perf_event_open
+#include <unistd.h>           // syscall, read, close
+#endif
+
+/*
+Opt-in instrumentation for the containers
+
+Compile with -DDS_INSTRUMENT to turn it on. Without that flag every DS_*
+macro below expands to nothing, so the containers compile to exactly the
+same code as before (zero cost when disabled).
+
+What is recorded (per container name, e.g. "LinkedList"):
+  DS_COUNT_OP(container, op)        how often an operation was called
+  DS_TRAVERSAL_SCOPE(container, op, steps) + DS_TRAVERSAL_STEP(steps)
+                                    how many nodes one call walked
+                                    (count / total / max + log2 histogram)
+  DS_COUNT_ALLOC(container)         node allocations
+  DS_COUNT_ALLOCS(container, n)     n node allocations at once (bulk builds)
+  DS_COUNT_FREE(container)          node frees
+  DS_COUNT_FREES(container, n)      n node frees at once (bulk operations)
+  DS_PERF_REGION(name)              hardware counters (cycles, cache-misses,
+                                    branch-misses) around a region, Linux only
+
+perf_event_open is a system call per measurement, so regions are OFF until
+configured, and then only every Nth entry is measured:
+  environment:  DS_PERF_REGIONS="LinkedList::searchNode,DoublyLinkedList::getNodeAtPosition"
+                (or "*" for all), DS_PERF_SAMPLE_EVERY=1024
+  code:         instr::configurePerf("*", 1024);
+If the kernel refuses perf events (e.g. perf_event_paranoid, containers),
+regions silently record nothing.
+
+Exporting: instr::takeSnapshot() copies every non-zero counter into plain structs,
+instr::toJson(snapshot) renders them for a metrics pipeline, and
+instr::resetAll() starts a new measurement window.
+*/
+
+namespace instr {
+
+// ----------------------------------------------------------------------------
+// Histogram of traversal lengths: bucket k counts calls that walked
+// [2^(k-1), 2^k) nodes (bucket 0 = zero nodes).
+// ----------------------------------------------------------------------------
+const int HISTOGRAM_BUCKETS = 40;
+
+struct Histogram {
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> totalSteps{0};
+    std::atomic<std::uint64_t> maxSteps{0};
+    std::atomic<std::uint64_t> buckets[HISTOGRAM_BUCKETS];
+
+    Histogram() {
+        for (auto& b : buckets) b.store(0, std::memory_order_relaxed);
+    }
+
+    void record(std::uint64_t steps) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        totalSteps.fetch_add(steps, std::memory_order_relaxed);
+        std::uint64_t seen = maxSteps.load(std::memory_order_relaxed);
+        while (steps > seen && !maxSteps.compare_exchange_weak(seen, steps, std::memory_order_relaxed)) {
+        }
+        int bucket = 0;
+        while (steps != 0 && bucket < HISTOGRAM_BUCKETS - 1) {
+            steps >>= 1;
+            bucket++;
+        }
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void reset() {
+        calls = 0;
+        totalSteps = 0;
+        maxSteps = 0;
+        for (auto& b : buckets) b.store(0, std::memory_order_relaxed);
+    }
+};
+
+// Hardware counter totals for one DS_PERF_REGION
+struct PerfSite {
+    std::atomic<std::uint64_t> entries{0};  // times the region was entered
+    std::atomic<std::uint64_t> samples{0};  // times it was actually measured
+    std::atomic<std::uint64_t> cycles{0};
+    std::atomic<std::uint64_t> cacheMisses{0};
+    std::atomic<std::uint64_t> branchMisses{0};
+    std::atomic<bool>          enabled{false};
+
+    void reset() {
+        entries = samples = cycles = cacheMisses = branchMisses = 0;
+    }
+};
+
+struct ContainerStats {
+    std::atomic<std::uint64_t> allocs{0};
+    std::atomic<std::uint64_t> frees{0};
+    std::map<std::string, std::unique_ptr<std::atomic<std::uint64_t>>> ops;
+    std::map<std::string, std::unique_ptr<Histogram>> traversals;
+};
+
+// ----------------------------------------------------------------------------
+// Registry: owns every counter. Lookups take a mutex, but the macros cache
+// the returned reference in a function-local static, so the lock is only
+// taken the first time each call site runs. Counters are never removed,
+// so cached references stay valid for the life of the program.
+// ----------------------------------------------------------------------------
+class Registry {
+public:
+    Registry() : sampleEvery_(1024) {
+        if (const char* regions = std::getenv("DS_PERF_REGIONS")) regions_ = regions;
+        if (const char* every = std::getenv("DS_PERF_SAMPLE_EVERY")) {
+            unsigned long n = std::strtoul(every, nullptr, 10);
+            if (n > 0) sampleEvery_ = static_cast<unsigned>(n);
+        }
+    }
+
+    std::atomic<std::uint64_t>& opCounter(const char* container, const char* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = stats(container).ops[op];
+        if (!slot) slot.reset(new std::atomic<std::uint64_t>(0));
+        return *slot;
+    }
+
+    Histogram& traversal(const char* container, const char* op) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = stats(container).traversals[op];
+        if (!slot) slot.reset(new Histogram());
+        return *slot;
+    }
+
+    std::atomic<std::uint64_t>& allocCounter(const char* container) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats(container).allocs;
+    }
+
+    std::atomic<std::uint64_t>& freeCounter(const char* container) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats(container).frees;
+    }
+
+    PerfSite& perfSite(const char* name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = perf_[name];
+        if (!slot) {
+            slot.reset(new PerfSite());
+            slot->enabled = regionSelected(name);
+        }
+        return *slot;
+    }
+
+    unsigned sampleEvery() const { return sampleEvery_.load(std::memory_order_relaxed); }
+
+    void configurePerf(const std::string& regionsCsv, unsigned sampleEvery) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        regions_ = regionsCsv;
+        sampleEvery_ = sampleEvery > 0 ? sampleEvery : 1;
+        for (auto& site : perf_) site.second->enabled = regionSelected(site.first);
+    }
+
+    void resetAll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& c : containers_) {
+            c.second->allocs = 0;
+            c.second->frees = 0;
+            for (auto& op : c.second->ops) *op.second = 0;
+            for (auto& t : c.second->traversals) t.second->reset();
+        }
+        for (auto& site : perf_) site.second->reset();
+    }
+
+    template <typename Fn>
+    void visit(Fn fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn(containers_, perf_);
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<ContainerStats>> containers_;
+    std::map<std::string, std::unique_ptr<PerfSite>> perf_;
+    std::string regions_;
+    std::atomic<unsigned> sampleEvery_;
+
+    ContainerStats& stats(const char* container) {
+        auto& slot = containers_[container];
+        if (!slot) slot.reset(new ContainerStats());
+        return *slot;
+    }
+
+    bool regionSelected(const std::string& name) const {
+        if (regions_ == "*") return true;
+        std::size_t start = 0;
+        while (start <= regions_.size()) {
+            std::size_t comma = regions_.find(',', start);
+            if (comma == std::string::npos) comma = regions_.size();
+            if (regions_.compare(start, comma - start, name) == 0 && comma - start == name.size()) return true;
+            start = comma + 1;
+        }
+        return false;
+    }
+};
+
+inline Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+inline void configurePerf(const std::string& regionsCsv, unsigned sampleEvery) {
+    registry().configurePerf(regionsCsv, sampleEvery);
+}
+
+inline void resetAll() { registry().resetAll(); }
+
+// ----------------------------------------------------------------------------
+// TraversalScope: counts steps during one call and records them when the
+// call returns (whichever `return` it leaves through).
+// ----------------------------------------------------------------------------
+class TraversalScope {
+public:
+    explicit TraversalScope(Histogram& histogram) : histogram_(histogram), steps_(0) {}
+    ~TraversalScope() { histogram_.record(steps_); }
+
+    void step() { steps_++; }
+
+    TraversalScope(const TraversalScope&) = delete;
+    TraversalScope& operator=(const TraversalScope&) = delete;
+
+private:
+    Histogram&    histogram_;
+    std::uint64_t steps_;
+};
+
+// ----------------------------------------------------------------------------
+// Hardware counters (Linux perf_event_open)
+//
+// Each thread opens ONE event group (cycles leader + cache-misses +
+// branch-misses) the first time it measures something, and reuses it.
+// ----------------------------------------------------------------------------
+#if defined(__linux__)
+class PerfGroup {
+public:
+    PerfGroup() : leader_(-1), cacheMisses_(-1), branchMisses_(-1) {
+        leader_ = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (leader_ < 0) return;
+        cacheMisses_ = open(PERF_COUNT_HW_CACHE_MISSES, leader_);
+        branchMisses_ = open(PERF_COUNT_HW_BRANCH_MISSES, leader_);
+        if (cacheMisses_ < 0 || branchMisses_ < 0) close();
+    }
+
+    ~PerfGroup() { close(); }
+
+    bool ok() const { return leader_ >= 0; }
+
+    void start() {
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    // returns false if the counters could not be read
+    bool stop(std::uint64_t& cycles, std::uint64_t& cacheMisses, std::uint64_t& branchMisses) {
+        ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        std::uint64_t values[1 + 3]; // nr, then one value per event
+        if (::read(leader_, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values))) return false;
+        cycles = values[1];
+        cacheMisses = values[2];
+        branchMisses = values[3];
+        return true;
+    }
+
+private:
+    int leader_;
+    int cacheMisses_;
+    int branchMisses_;
+
+    static int open(std::uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = (groupFd == -1) ? 1 : 0; // leader starts disabled, members follow it
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+
+    void close() {
+        if (branchMisses_ >= 0) ::close(branchMisses_);
+        if (cacheMisses_ >= 0) ::close(cacheMisses_);
+        if (leader_ >= 0) ::close(leader_);
+        leader_ = cacheMisses_ = branchMisses_ = -1;
+    }
+};
+
+inline PerfGroup& threadPerfGroup() {
+    thread_local PerfGroup group;
+    return group;
+}
+#endif
+
+class PerfRegion {
+public:
+    explicit PerfRegion(PerfSite& site) : site_(site), active_(false) {
+        std::uint64_t entry = site.entries.fetch_add(1, std::memory_order_relaxed);
+        if (!site.enabled.load(std::memory_order_relaxed)) return;
+        if (entry % registry().sampleEvery() != 0) return;
+#if defined(__linux__)
+        PerfGroup& group = threadPerfGroup();
+        if (!group.ok()) return;
+        active_ = true;
+        group.start();
+#endif
+    }
+
+    ~PerfRegion() {
+#if defined(__linux__)
+        if (!active_) return;
+        std::uint64_t cycles = 0, cacheMisses = 0, branchMisses = 0;
+        if (!threadPerfGroup().stop(cycles, cacheMisses, branchMisses)) return;
+        site_.samples.fetch_add(1, std::memory_order_relaxed);
+        site_.cycles.fetch_add(cycles, std::memory_order_relaxed);
+        site_.cacheMisses.fetch_add(cacheMisses, std::memory_order_relaxed);
+        site_.branchMisses.fetch_add(branchMisses, std::memory_order_relaxed);
+#endif
+    }
+
+    PerfRegion(const PerfRegion&) = delete;
+    PerfRegion& operator=(const PerfRegion&) = delete;
+
+private:
+    PerfSite& site_;
+    bool      active_;
+};
+
+// ----------------------------------------------------------------------------
+// Snapshot: plain copies of every counter, safe to keep and serialize
+// ----------------------------------------------------------------------------
+struct TraversalSnapshot {
+    std::string container;
+    std::string op;
+    std::uint64_t calls;
+    std::uint64_t totalSteps;
+    std::uint64_t maxSteps;
+    std::vector<std::uint64_t> log2Buckets; // trailing empty buckets trimmed
+};
+
+struct PerfSnapshot {
+    std::string region;
+    std::uint64_t entries, samples, cycles, cacheMisses, branchMisses;
+};
+
+struct StatsSnapshot {
+    struct Container {
+        std::string name;
+        std::uint64_t allocs;
+        std::uint64_t frees;
+        std::map<std::string, std::uint64_t> ops;
+    };
+    std::vector<Container> containers;
+    std::vector<TraversalSnapshot> traversals;
+    std::vector<PerfSnapshot> perf;
+};
+
+inline StatsSnapshot takeSnapshot() {
+    StatsSnapshot snap;
+    registry().visit([&snap](const std::map<std::string, std::unique_ptr<ContainerStats>>& containers,
+                             const std::map<std::string, std::unique_ptr<PerfSite>>& perf) {
+        for (const auto& c : containers) {
+            bool active = c.second->allocs.load() != 0 || c.second->frees.load() != 0;
+            for (const auto& op : c.second->ops) active = active || op.second->load() != 0;
+            if (!active) continue;  // nothing recorded since the last resetAll()
+
+            StatsSnapshot::Container entry;
+            entry.name = c.first;
+            entry.allocs = c.second->allocs.load();
+            entry.frees = c.second->frees.load();
+            for (const auto& op : c.second->ops) entry.ops[op.first] = op.second->load();
+            snap.containers.push_back(entry);
+
+            for (const auto& t : c.second->traversals) {
+                if (t.second->calls.load() == 0) continue;
+                TraversalSnapshot ts;
+                ts.container = c.first;
+                ts.op = t.first;
+                ts.calls = t.second->calls.load();
+                ts.totalSteps = t.second->totalSteps.load();
+                ts.maxSteps = t.second->maxSteps.load();
+                int last = HISTOGRAM_BUCKETS - 1;
+                while (last >= 0 && t.second->buckets[last].load() == 0) last--;
+                for (int b = 0; b <= last; b++) ts.log2Buckets.push_back(t.second->buckets[b].load());
+                snap.traversals.push_back(ts);
+            }
+        }
+        for (const auto& p : perf) {
+            if (p.second->entries.load() == 0) continue;
+            snap.perf.push_back(PerfSnapshot{p.first, p.second->entries.load(), p.second->samples.load(),
+                                             p.second->cycles.load(), p.second->cacheMisses.load(),
+                                             p.second->branchMisses.load()});
+        }
+    });
+    return snap;
+}
+
+inline std::string toJson(const StatsSnapshot& snap) {
+    std::string out = "{\"containers\": [";
+    char buf[256];
+    for (std::size_t i = 0; i < snap.containers.size(); i++) {
+        const auto& c = snap.containers[i];
+        std::snprintf(buf, sizeof(buf), "%s{\"name\": \"%s\", \"allocs\": %llu, \"frees\": %llu, \"ops\": {",
+                      i ? ", " : "", c.name.c_str(), static_cast<unsigned long long>(c.allocs),
+                      static_cast<unsigned long long>(c.frees));
+        out += buf;
+        bool first = true;
+        for (const auto& op : c.ops) {
+            std::snprintf(buf, sizeof(buf), "%s\"%s\": %llu", first ? "" : ", ", op.first.c_str(),
+                          static_cast<unsigned long long>(op.second));
+            out += buf;
+            first = false;
+        }
+        out += "}}";
+    }
+    out += "], \"traversals\": [";
+    for (std::size_t i = 0; i < snap.traversals.size(); i++) {
+        const auto& t = snap.traversals[i];
+        std::snprintf(buf, sizeof(buf),
+                      "%s{\"container\": \"%s\", \"op\": \"%s\", \"calls\": %llu, \"total_steps\": %llu, "
+                      "\"max_steps\": %llu, \"mean_steps\": %.2f, \"log2_buckets\": [",
+                      i ? ", " : "", t.container.c_str(), t.op.c_str(),
+                      static_cast<unsigned long long>(t.calls), static_cast<unsigned long long>(t.totalSteps),
+                      static_cast<unsigned long long>(t.maxSteps),
+                      t.calls ? static_cast<double>(t.totalSteps) / static_cast<double>(t.calls) : 0.0);
+        out += buf;
+        for (std::size_t b = 0; b < t.log2Buckets.size(); b++) {
+            std::snprintf(buf, sizeof(buf), "%s%llu", b ? ", " : "", static_cast<unsigned long long>(t.log2Buckets[b]));
+            out += buf;
+        }
+        out += "]}";
+    }
+    out += "], \"perf\": [";
+    for (std::size_t i = 0; i < snap.perf.size(); i++) {
+        const auto& p = snap.perf[i];
+        std::snprintf(buf, sizeof(buf),
+                      "%s{\"region\": \"%s\", \"entries\": %llu, \"samples\": %llu, \"cycles\": %llu, "
+                      "\"cache_misses\": %llu, \"branch_misses\": %llu}",
+                      i ? ", " : "", p.region.c_str(), static_cast<unsigned long long>(p.entries),
+                      static_cast<unsigned long long>(p.samples), static_cast<unsigned long long>(p.cycles),
+                      static_cast<unsigned long long>(p.cacheMisses), static_cast<unsigned long long>(p.branchMisses));
+        out += buf;
+    }
+    out += "]}";
+    return out;
+}
+
+} // namespace instr
+
+// ----------------------------------------------------------------------------
+// The macros used inside the containers
+// ----------------------------------------------------------------------------
+#if defined(DS_INSTRUMENT)
+
+#define DS_COUNT_OP(container, op)                                                          \
+    do {                                                                                    \
+        static std::atomic<std::uint64_t>& dsOpCounter = instr::registry().opCounter(container, op); \
+        dsOpCounter.fetch_add(1, std::memory_order_relaxed);                                \
+    } while (0)
+
+#define DS_COUNT_ALLOC(container)                                                           \
+    do {                                                                                    \
+        static std::atomic<std::uint64_t>& dsAllocCounter = instr::registry().allocCounter(container); \
+        dsAllocCounter.fetch_add(1, std::memory_order_relaxed);                             \
+    } while (0)
+
+#define DS_COUNT_ALLOCS(container, n)                                                       \
+    do {                                                                                    \
+        static std::atomic<std::uint64_t>& dsAllocCounter = instr::registry().allocCounter(container); \
+        dsAllocCounter.fetch_add(static_cast<std::uint64_t>(n), std::memory_order_relaxed); \
+    } while (0)
+
+#define DS_COUNT_FREE(container)                                                            \
+    do {                                                                                    \
+        static std::atomic<std::uint64_t>& dsFreeCounter = instr::registry().freeCounter(container); \
+        dsFreeCounter.fetch_add(1, std::memory_order_relaxed);                              \
+    } while (0)
+
+#define DS_COUNT_FREES(container, n)                                                        \
+    do {                                                                                    \
+        static std::atomic<std::uint64_t>& dsFreeCounter = instr::registry().freeCounter(container); \
+        dsFreeCounter.fetch_add(static_cast<std::uint64_t>(n), std::memory_order_relaxed);  \
+    } while (0)
+
+#define DS_TRAVERSAL_SCOPE(container, op, steps)                                            \
+    static instr::Histogram& steps##Histogram = instr::registry().traversal(container, op); \
+    instr::TraversalScope steps(steps##Histogram)
+
+#define DS_TRAVERSAL_STEP(steps) steps.step()
+
+#define DS_PERF_REGION(name)                                                                \
+    static instr::PerfSite& dsPerfSite = instr::registry().perfSite(name);                 \
+    instr::PerfRegion dsPerfRegion(dsPerfSite)
+
+#else // instrumentation disabled: every hook disappears
+
+#define DS_COUNT_OP(container, op) ((void)0)
+#define DS_COUNT_ALLOC(container) ((void)0)
+#define DS_COUNT_ALLOCS(container, n) ((void)0)
+#define DS_COUNT_FREE(container) ((void)0)
+#define DS_COUNT_FREES(container, n) ((void)0)
+#define DS_TRAVERSAL_SCOPE(container, op, steps) ((void)0)
+#define DS_TRAVERSAL_STEP(steps) ((void)0)
+#define DS_PERF_REGION(name) ((void)0)
+
+#endif // DS_INSTRUMENT
+
+#endif // INSTRUMENTATION_H
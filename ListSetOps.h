@@ -0,0 +1,246 @@
+// List Set Operations Header File
+#ifndef LIST_SET_OPS_H
+#define LIST_SET_OPS_H
+
+#include <cstddef>    // std::size_t
+#include <functional> // std::greater
+#include <iterator>   // std::iterator_traits
+#include <queue>      // std::priority_queue (k-way merge)
+#include <utility>    // std::move
+#include <vector>
+
+/*
+Set operations on SORTED singly linked chains
+
+Checking every element of one list with searchNode() on the other costs
+O(n * m). When both lists are sorted, one simultaneous walk is enough
+(like the merge step of merge sort): O(n + m).
+
+Lists may hold repeated values, so the operations follow multiset rules:
+a value that appears x times in `a` and y times in `b` appears
+  union         max(x, y) times
+  intersection  min(x, y) times
+  difference    max(x - y, 0) times
+
+Nodes are SPLICED (re-linked) from one chain into the other; nodes that
+drop out of the result are deleted here, so the chains must own nodes
+allocated with `new` (true for every list in this repo). Each function
+adds the number of deleted nodes to `freed` so callers can fix their counts.
+
+Galloping (exponential) search:
+When one side is a sorted ARRAY (std::vector, a SnapshotView, ...) that is
+much larger than the list, stepping through it one element at a time wastes
+work. gallopLowerBound() jumps 1, 2, 4, 8, ... elements ahead and then binary
+searches the last jump, so matching n list values against m array values
+costs O(n log(m / n)) instead of O(n + m).
+(A linked list cannot be galloped: reaching node i still means walking i nodes.)
+*/
+
+namespace listset {
+
+// ----------------------------------------------------------------------------
+// unionRuns: splice every node of `b` into `a`
+// Equal values: the node from `a` stays, the matching node from `b` is freed.
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+NodeT* unionRuns(NodeT* a, NodeT* b, std::size_t& freed) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+
+    while (a != nullptr && b != nullptr) {
+        if (a->data < b->data) {
+            *link = a;
+            a = a->next;
+        } else if (b->data < a->data) {
+            *link = b;
+            b = b->next;
+        } else {
+            NodeT* duplicate = b;      // same value on both sides: keep one
+            b = b->next;
+            delete duplicate;
+            freed++;
+            *link = a;
+            a = a->next;
+        }
+        link = &(*link)->next;
+    }
+    *link = (a != nullptr) ? a : b;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// intersectRuns: keep only the nodes of `a` whose value also occurs in `b`
+// `b` is only read.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename OtherNodeT>
+NodeT* intersectRuns(NodeT* a, const OtherNodeT* b, std::size_t& freed) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+
+    while (a != nullptr) {
+        if (b == nullptr || a->data < b->data) {
+            NodeT* drop = a;           // not in b (anymore): remove
+            a = a->next;
+            delete drop;
+            freed++;
+        } else if (b->data < a->data) {
+            b = b->next;
+        } else {
+            *link = a;                 // in both: keep, consume one match from b
+            link = &a->next;
+            a = a->next;
+            b = b->next;
+        }
+    }
+    *link = nullptr;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// differenceRuns: remove from `a` every value that also occurs in `b`
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename OtherNodeT>
+NodeT* differenceRuns(NodeT* a, const OtherNodeT* b, std::size_t& freed) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+
+    while (a != nullptr) {
+        if (b == nullptr || a->data < b->data) {
+            *link = a;                 // not in b: keep
+            link = &a->next;
+            a = a->next;
+        } else if (b->data < a->data) {
+            b = b->next;
+        } else {
+            NodeT* drop = a;           // matched: remove, consume the match
+            a = a->next;
+            b = b->next;
+            delete drop;
+            freed++;
+        }
+    }
+    *link = nullptr;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// gallopLowerBound: first position in [first, last) whose value is >= target
+// Exponential probe from `first`, then binary search inside the last step.
+// Cheap when the answer is close to `first`, never worse than O(log m).
+// ----------------------------------------------------------------------------
+template <typename RandomIt, typename T>
+RandomIt gallopLowerBound(RandomIt first, RandomIt last, const T& target) {
+    typename std::iterator_traits<RandomIt>::difference_type size = last - first;
+    typename std::iterator_traits<RandomIt>::difference_type step = 1, lo = 0;
+
+    while (step <= size && first[step - 1] < target) {
+        lo = step;
+        step *= 2;
+    }
+    typename std::iterator_traits<RandomIt>::difference_type hi = (step <= size) ? step - 1 : size;
+
+    while (lo < hi) {                  // answer lies in [lo, hi]
+        typename std::iterator_traits<RandomIt>::difference_type mid = lo + (hi - lo) / 2;
+        if (first[mid] < target) lo = mid + 1;
+        else hi = mid;
+    }
+    return first + lo;
+}
+
+// ----------------------------------------------------------------------------
+// intersectWithRange / differenceWithRange:
+// same rules as above, but `b` is a sorted random-access range searched by
+// galloping, so a short list against a huge sorted array stays cheap.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename RandomIt>
+NodeT* intersectWithRange(NodeT* a, RandomIt first, RandomIt last, std::size_t& freed) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+
+    while (a != nullptr) {
+        first = gallopLowerBound(first, last, a->data);
+        if (first != last && !(a->data < *first)) {
+            *link = a;
+            link = &a->next;
+            a = a->next;
+            ++first;                   // each array element matches once
+        } else {
+            NodeT* drop = a;
+            a = a->next;
+            delete drop;
+            freed++;
+        }
+    }
+    *link = nullptr;
+    return head;
+}
+
+template <typename NodeT, typename RandomIt>
+NodeT* differenceWithRange(NodeT* a, RandomIt first, RandomIt last, std::size_t& freed) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+
+    while (a != nullptr) {
+        first = gallopLowerBound(first, last, a->data);
+        if (first != last && !(a->data < *first)) {
+            NodeT* drop = a;
+            a = a->next;
+            delete drop;
+            freed++;
+            ++first;
+        } else {
+            *link = a;
+            link = &a->next;
+            a = a->next;
+        }
+    }
+    *link = nullptr;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// mergeK: k-way merge of sorted chains into one sorted chain
+//
+// A min-heap holds the current front node of every chain (k entries).
+// Repeatedly pop the smallest front, splice it onto the result, and push
+// that chain's next node. Cost: O(N log k) comparisons for N nodes, no copies.
+// Ties are broken by chain index, so the merge is stable across inputs.
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+NodeT* mergeK(const std::vector<NodeT*>& heads) {
+    struct Front {
+        NodeT* node;
+        std::size_t source;
+        bool operator>(const Front& other) const {
+            if (other.node->data < node->data) return true;
+            if (node->data < other.node->data) return false;
+            return source > other.source;
+        }
+    };
+
+    std::vector<Front> storage;
+    storage.reserve(heads.size());
+    std::priority_queue<Front, std::vector<Front>, std::greater<Front>> heap(
+        std::greater<Front>(), std::move(storage));
+    for (std::size_t i = 0; i < heads.size(); i++) {
+        if (heads[i] != nullptr) heap.push(Front{heads[i], i});
+    }
+
+    NodeT* head = nullptr;
+    NodeT** link = &head;
+    while (!heap.empty()) {
+        Front smallest = heap.top();
+        heap.pop();
+        *link = smallest.node;
+        if (heap.empty()) break;       // last chain standing: already linked
+        link = &smallest.node->next;
+        if (smallest.node->next != nullptr) {
+            heap.push(Front{smallest.node->next, smallest.source});
+        }
+    }
+    return head;
+}
+
+} // namespace listset
+
+#endif // LIST_SET_OPS_H
@@ -0,0 +1,359 @@
+// List Snapshot Header File
+#ifndef LIST_SNAPSHOT_H
+#define LIST_SNAPSHOT_H
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // fixed-width header fields
+#include <cstring>     // std::memcpy, std::memcmp
+#include <cstdio>      // std::FILE (portable fallback)
+#include <stdexcept>   // std::runtime_error
+#include <string>
+#include <type_traits> // std::is_trivially_copyable
+#include <utility>     // std::declval
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#endif
+
+/*
+Why a snapshot format?
+- Rebuilding a list with insertAtEnd() in a loop walks the whole chain for every
+  element, so a restart of a large list is O(n^2) pointer chasing.
+- A snapshot stores the elements in traversal order as ONE flat array on disk.
+- Reopening it with mmap maps the file straight into memory: no parsing, no
+  allocation, and pages are only read from disk when they are touched.
+
+On-disk layout (native byte order, written and read on the same machine type):
+
+    offset 0                   SnapshotHeader (64 bytes)
+    offset header.dataOffset   count * elementSize bytes of element data
+
+Every position in the file is an OFFSET from the start of the file, never a
+pointer, so the same file can be mapped at any address.
+*/
+
+namespace snapshot {
+
+// Which container wrote the snapshot (informational; any list can read any kind).
+enum class Kind : std::uint32_t {
+    Unknown = 0,
+    LinkedList = 1,
+    LinkedListImplementation = 2,
+    DoublyLinkedList = 3,
+    CircularLinkedList = 4,
+    TemplatedDeque = 5
+};
+
+// Header flags
+const std::uint32_t FLAG_SORTED = 1u; // elements are in non-decreasing order
+
+struct SnapshotHeader {
+    char          magic[8];    // "DSSNAP01"
+    std::uint32_t version;     // format version (currently 1)
+    std::uint32_t elementSize; // sizeof(T) of the writer, checked by the reader
+    std::uint64_t count;       // number of elements
+    std::uint64_t dataOffset;  // relative offset of the first element
+    std::uint32_t flags;       // FLAG_* bits
+    std::uint32_t kind;        // snapshot::Kind of the writer
+    std::uint8_t  reserved[24];
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "snapshot header must stay 64 bytes");
+
+// Sortedness is only tracked for element types that have operator<.
+template <typename T, typename = void>
+struct IsOrdered : std::false_type {};
+
+template <typename T>
+struct IsOrdered<T, decltype(void(std::declval<const T&>() < std::declval<const T&>()))>
+    : std::true_type {};
+
+template <typename T>
+bool outOfOrder(const T& previous, const T& value, std::true_type) { return value < previous; }
+
+template <typename T>
+bool outOfOrder(const T&, const T&, std::false_type) { return true; }
+
+const char MAGIC[8] = {'D', 'S', 'S', 'N', 'A', 'P', '0', '1'};
+const std::uint32_t VERSION = 1;
+
+// ----------------------------------------------------------------------------
+// SnapshotWriter<T>: streams elements to disk in traversal order
+//
+// Usage (each list class does this inside saveSnapshot()):
+//   SnapshotWriter<int> w(path, Kind::LinkedList);
+//   for each node: w.append(node->data);
+//   w.finish();
+//
+// Elements are buffered and written in large chunks, and the header is
+// rewritten at the end once the count and the "sorted" flag are known.
+// ----------------------------------------------------------------------------
+template <typename T>
+class SnapshotWriter {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "snapshots store raw element bytes, so T must be trivially copyable");
+
+private:
+    std::FILE*     file_;
+    std::vector<T> buffer_;
+    std::uint64_t  count_;
+    bool           sorted_;
+    T              last_;
+    Kind           kind_;
+
+    static const std::size_t BUFFER_ELEMENTS = (1u << 16);
+
+    void flushBuffer() {
+        if (buffer_.empty()) return;
+        if (std::fwrite(buffer_.data(), sizeof(T), buffer_.size(), file_) != buffer_.size()) {
+            throw std::runtime_error("snapshot write failed");
+        }
+        buffer_.clear();
+    }
+
+    void writeHeader() {
+        SnapshotHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.elementSize = static_cast<std::uint32_t>(sizeof(T));
+        header.count = count_;
+        header.dataOffset = sizeof(SnapshotHeader);
+        header.flags = sorted_ ? FLAG_SORTED : 0u;
+        header.kind = static_cast<std::uint32_t>(kind_);
+
+        if (std::fseek(file_, 0, SEEK_SET) != 0 ||
+            std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            throw std::runtime_error("snapshot header write failed");
+        }
+    }
+
+public:
+    SnapshotWriter(const std::string& path, Kind kind)
+        : file_(std::fopen(path.c_str(), "wb")), count_(0), sorted_(true), last_(), kind_(kind) {
+        if (file_ == nullptr) {
+            throw std::runtime_error("cannot open snapshot file for writing: " + path);
+        }
+        buffer_.reserve(BUFFER_ELEMENTS);
+        writeHeader(); // placeholder, rewritten by finish()
+    }
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    ~SnapshotWriter() {
+        if (file_ != nullptr) std::fclose(file_); // finish() was not called: file is incomplete
+    }
+
+    void append(const T& value) {
+        if (count_ > 0 && sorted_ && outOfOrder(last_, value, IsOrdered<T>())) sorted_ = false;
+        last_ = value;
+        buffer_.push_back(value);
+        ++count_;
+        if (buffer_.size() == BUFFER_ELEMENTS) flushBuffer();
+    }
+
+    // Write remaining elements, patch the header and close the file.
+    void finish() {
+        flushBuffer();
+        writeHeader();
+        if (std::fclose(file_) != 0) {
+            file_ = nullptr;
+            throw std::runtime_error("snapshot close failed");
+        }
+        file_ = nullptr;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// SnapshotView<T>: read-only, zero-copy view of a snapshot file
+//
+// - open() maps the file with mmap (PROT_READ), so nothing is copied.
+// - begin()/end() are plain const T* pointers into the mapping, so the view
+//   works directly with range-for and <algorithm>.
+// - searchNode() uses binary search when the writer saw sorted input,
+//   otherwise a linear scan over contiguous memory (still far faster than
+//   chasing node pointers).
+// - The view owns the mapping; it is move-only.
+//
+// On platforms without mmap (_WIN32) the file is read into a heap buffer so
+// the same API keeps working, just without the zero-copy property.
+// ----------------------------------------------------------------------------
+template <typename T>
+class SnapshotView {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "snapshots store raw element bytes, so T must be trivially copyable");
+
+private:
+    const unsigned char* base_;   // start of the mapping (or heap buffer)
+    std::size_t          length_; // bytes mapped
+    const T*             data_;
+    std::size_t          count_;
+    std::uint32_t        flags_;
+    Kind                 kind_;
+
+    void release() noexcept {
+        if (base_ == nullptr) return;
+#if !defined(_WIN32)
+        munmap(const_cast<unsigned char*>(base_), length_);
+#else
+        delete[] base_;
+#endif
+        base_ = nullptr;
+        data_ = nullptr;
+        length_ = count_ = 0;
+    }
+
+    void validate(const std::string& path) {
+        if (length_ < sizeof(SnapshotHeader)) {
+            throw std::runtime_error("snapshot too small: " + path);
+        }
+        SnapshotHeader header;
+        std::memcpy(&header, base_, sizeof(header));
+
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+            throw std::runtime_error("not a snapshot file: " + path);
+        }
+        if (header.elementSize != sizeof(T)) {
+            throw std::runtime_error("snapshot element size mismatch: " + path);
+        }
+        if (header.dataOffset > length_ ||
+            header.count > (length_ - header.dataOffset) / sizeof(T)) {
+            throw std::runtime_error("snapshot truncated: " + path);
+        }
+        // the mapping starts on a page boundary, so an aligned offset gives
+        // aligned elements (a hand-edited header could say otherwise)
+        if (header.dataOffset % alignof(T) != 0) {
+            throw std::runtime_error("snapshot data misaligned: " + path);
+        }
+
+        data_ = reinterpret_cast<const T*>(base_ + header.dataOffset);
+        count_ = static_cast<std::size_t>(header.count);
+        flags_ = header.flags;
+        kind_ = static_cast<Kind>(header.kind);
+    }
+
+public:
+    SnapshotView() : base_(nullptr), length_(0), data_(nullptr), count_(0), flags_(0), kind_(Kind::Unknown) {}
+
+    explicit SnapshotView(const std::string& path) : SnapshotView() {
+        open(path);
+    }
+
+    SnapshotView(const SnapshotView&) = delete;
+    SnapshotView& operator=(const SnapshotView&) = delete;
+
+    SnapshotView(SnapshotView&& other) noexcept
+        : base_(other.base_), length_(other.length_), data_(other.data_),
+          count_(other.count_), flags_(other.flags_), kind_(other.kind_) {
+        other.base_ = nullptr;
+        other.data_ = nullptr;
+        other.length_ = other.count_ = 0;
+    }
+
+    SnapshotView& operator=(SnapshotView&& other) noexcept {
+        if (this != &other) {
+            release();
+            base_ = other.base_;
+            length_ = other.length_;
+            data_ = other.data_;
+            count_ = other.count_;
+            flags_ = other.flags_;
+            kind_ = other.kind_;
+            other.base_ = nullptr;
+            other.data_ = nullptr;
+            other.length_ = other.count_ = 0;
+        }
+        return *this;
+    }
+
+    ~SnapshotView() { release(); }
+
+    void open(const std::string& path) {
+        release();
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("cannot open snapshot: " + path);
+
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("cannot stat snapshot: " + path);
+        }
+        length_ = static_cast<std::size_t>(st.st_size);
+        if (length_ == 0) {
+            ::close(fd);
+            throw std::runtime_error("snapshot too small: " + path);
+        }
+
+        void* mapping = mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file alive
+        if (mapping == MAP_FAILED) {
+            length_ = 0;
+            throw std::runtime_error("cannot mmap snapshot: " + path);
+        }
+        base_ = static_cast<const unsigned char*>(mapping);
+#else
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (f == nullptr) throw std::runtime_error("cannot open snapshot: " + path);
+        std::fseek(f, 0, SEEK_END);
+        long size = std::ftell(f);
+        std::fseek(f, 0, SEEK_SET);
+        length_ = size > 0 ? static_cast<std::size_t>(size) : 0;
+        unsigned char* buffer = new unsigned char[length_ > 0 ? length_ : 1];
+        std::size_t got = std::fread(buffer, 1, length_, f);
+        std::fclose(f);
+        base_ = buffer;
+        if (got != length_) {
+            release();
+            throw std::runtime_error("cannot read snapshot: " + path);
+        }
+#endif
+        try {
+            validate(path);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    // Hint the kernel that the whole view will be scanned front to back.
+    void adviseSequential() const {
+#if !defined(_WIN32) && defined(MADV_SEQUENTIAL)
+        if (base_ != nullptr) madvise(const_cast<unsigned char*>(base_), length_, MADV_SEQUENTIAL);
+#endif
+    }
+
+    std::size_t size() const { return count_; }
+    bool isEmpty() const { return count_ == 0; }
+    bool isSorted() const { return (flags_ & FLAG_SORTED) != 0; }
+    Kind kind() const { return kind_; }
+
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + count_; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+
+    bool searchNode(const T& searchVal) const {
+        if (isSorted()) {
+            std::size_t lo = 0, hi = count_;
+            while (lo < hi) {
+                std::size_t mid = lo + (hi - lo) / 2;
+                if (data_[mid] < searchVal) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo < count_ && !(searchVal < data_[lo]);
+        }
+        for (std::size_t i = 0; i < count_; i++) {
+            if (data_[i] == searchVal) return true;
+        }
+        return false;
+    }
+};
+
+} // namespace snapshot
+
+#endif // LIST_SNAPSHOT_H
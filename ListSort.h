@@ -0,0 +1,286 @@
+// List Sort Header File
+#ifndef LIST_SORT_H
+#define LIST_SORT_H
+
+#include <cstddef>     // std::size_t
+#include <functional>  // std::less
+#include <thread>      // std::thread (parallel variant)
+#include <type_traits> // std::is_integral, std::make_unsigned (radix sort)
+#include <vector>
+
+/*
+Sorting a linked list IN PLACE
+- Arrays sort by moving values; lists can sort by re-linking `next` pointers.
+  No node is allocated, copied or freed, so sorting needs O(1) extra memory
+  (plus the recursion / thread bookkeeping below).
+- Merge sort is the natural fit: merging two sorted chains only ever looks at
+  the two front nodes, which is exactly what a singly linked list is good at.
+- All variants are STABLE: when two values compare equal, the one that came
+  first in the list stays first (mergeRuns takes from the LEFT run on ties).
+
+The functions only touch `data` and `next`, so they work for every singly
+linked Node type in the repo. Doubly linked lists call relinkPrev()
+afterwards to rebuild the `prev` pointers in one pass.
+
+  mergeSortTopDown(head)            recursive split/merge, O(log n) stack depth
+  mergeSortBottomUp(head)           iterative: merges runs of 1, 2, 4, ... nodes
+  mergeSortParallel(head, n, k)     cuts the chain into k pieces, sorts each on
+                                    its own thread, then merges the pieces
+  radixSort(head)                   integer keys only: LSD radix sort, one
+                                    byte per pass, no comparisons at all
+*/
+
+namespace listsort {
+
+// ----------------------------------------------------------------------------
+// mergeRuns: merge two sorted, nullptr-terminated chains into one
+// Returns the head of the merged chain. Ties take from `a` (stability).
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename Compare = std::less<>>
+NodeT* mergeRuns(NodeT* a, NodeT* b, Compare less = Compare()) {
+    NodeT* head = nullptr;
+    NodeT** link = &head;           // where the next chosen node gets attached
+
+    while (a != nullptr && b != nullptr) {
+        if (less(b->data, a->data)) {
+            *link = b;
+            b = b->next;
+        } else {
+            *link = a;
+            a = a->next;
+        }
+        link = &(*link)->next;
+    }
+    *link = (a != nullptr) ? a : b; // append whatever is left
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// splitAfter: detach the chain after `count` nodes
+// Returns the first node of the remainder (nullptr if the chain was shorter).
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+NodeT* splitAfter(NodeT* head, std::size_t count) {
+    for (std::size_t i = 1; head != nullptr && i < count; i++) {
+        head = head->next;
+    }
+    if (head == nullptr) return nullptr;
+    NodeT* rest = head->next;
+    head->next = nullptr;
+    return rest;
+}
+
+// ----------------------------------------------------------------------------
+// Top-down (recursive) merge sort
+// Finds the middle with slow/fast pointers, sorts both halves, merges.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename Compare = std::less<>>
+NodeT* mergeSortTopDown(NodeT* head, Compare less = Compare()) {
+    if (head == nullptr || head->next == nullptr) return head;
+
+    NodeT* slow = head;
+    NodeT* fast = head->next;
+    while (fast != nullptr && fast->next != nullptr) {
+        slow = slow->next;
+        fast = fast->next->next;
+    }
+    NodeT* right = slow->next;
+    slow->next = nullptr;
+
+    return mergeRuns(mergeSortTopDown(head, less), mergeSortTopDown(right, less), less);
+}
+
+// ----------------------------------------------------------------------------
+// Bottom-up (iterative) merge sort
+//
+// Works like counting in binary: bins[k] holds either nothing or a sorted
+// run of exactly 2^k nodes. Each node taken from the list is "added" as a
+// run of 1; whenever bins[k] is occupied the two runs are merged and carried
+// to bins[k+1]. At the end the occupied bins are merged together.
+//
+// - No recursion: the only bookkeeping is the fixed array of 64 bins.
+// - Cache friendly: small runs are merged while their nodes are still hot,
+//   instead of streaming over the whole list once per pass.
+// - Stable: a bin always holds EARLIER nodes than the carry, so it is
+//   passed as the left run.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename Compare = std::less<>>
+NodeT* mergeSortBottomUp(NodeT* head, Compare less = Compare()) {
+    if (head == nullptr || head->next == nullptr) return head;
+
+    const int BINS = 64;
+    NodeT* bins[BINS] = {};
+
+    while (head != nullptr) {
+        NodeT* carry = head;
+        head = head->next;
+        carry->next = nullptr;
+
+        int k = 0;
+        for (; k < BINS - 1 && bins[k] != nullptr; k++) {
+            carry = mergeRuns(bins[k], carry, less);
+            bins[k] = nullptr;
+        }
+        bins[k] = (bins[k] == nullptr) ? carry : mergeRuns(bins[k], carry, less);
+    }
+
+    NodeT* result = nullptr;
+    for (int k = 0; k < BINS; k++) {
+        if (bins[k] != nullptr) result = mergeRuns(bins[k], result, less);
+    }
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Task-parallel merge sort
+//
+// 1) Cut the chain into `tasks` pieces of about length/tasks nodes.
+// 2) Sort every piece with mergeSortBottomUp on its own std::thread.
+//    Pieces share no nodes, so the threads never touch the same memory.
+// 3) Merge neighbouring pieces pairwise (again in parallel) until one is left.
+//    Merging only neighbours, left before right, keeps the sort stable.
+//
+// Small lists (or tasks <= 1) just use the sequential bottom-up sort.
+// `length` is the node count (needed to cut equal pieces).
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename Compare = std::less<>>
+NodeT* mergeSortParallel(NodeT* head, std::size_t length, unsigned tasks, Compare less = Compare()) {
+    const std::size_t MIN_PIECE = 1u << 14; // below this, thread start-up costs more than it saves
+    if (tasks > length / MIN_PIECE) tasks = static_cast<unsigned>(length / MIN_PIECE);
+    if (tasks <= 1) return mergeSortBottomUp(head, less);
+
+    // Step 1: cut into pieces
+    std::vector<NodeT*> pieces;
+    std::size_t remainingLength = length;
+    for (unsigned t = 0; t < tasks; t++) {
+        std::size_t pieceLength = remainingLength / (tasks - t);
+        pieces.push_back(head);
+        head = splitAfter(head, pieceLength);
+        remainingLength -= pieceLength;
+    }
+
+    // Step 2: sort pieces concurrently
+    {
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < pieces.size(); i++) {
+            workers.emplace_back([&pieces, less, i]() {
+                pieces[i] = mergeSortBottomUp(pieces[i], less);
+            });
+        }
+        pieces[0] = mergeSortBottomUp(pieces[0], less); // this thread does piece 0
+        for (std::thread& worker : workers) worker.join();
+    }
+
+    // Step 3: pairwise merge rounds (piece 2i with piece 2i+1)
+    while (pieces.size() > 1) {
+        std::size_t pairs = pieces.size() / 2;
+        std::vector<NodeT*> merged(pairs + pieces.size() % 2);
+        std::vector<std::thread> workers;
+        for (std::size_t p = 1; p < pairs; p++) {
+            workers.emplace_back([&pieces, &merged, less, p]() {
+                merged[p] = mergeRuns(pieces[2 * p], pieces[2 * p + 1], less);
+            });
+        }
+        merged[0] = mergeRuns(pieces[0], pieces[1], less);
+        for (std::thread& worker : workers) worker.join();
+        if (pieces.size() % 2 != 0) merged.back() = pieces.back();
+        pieces.swap(merged);
+    }
+    return pieces[0];
+}
+
+// ----------------------------------------------------------------------------
+// LSD radix sort for integer keys (int, long, unsigned, ...)
+//
+// Idea: sort by the LOWEST byte first, then the next byte, ... up to the
+// highest byte. Each pass is a stable "distribute into 256 buckets and
+// concatenate" step, so after the last pass the list is fully sorted.
+//
+// Per pass:
+//   1) walk the chain, appending every node to bucket[byte] (head/tail pair)
+//   2) link bucket 0's tail to bucket 1's head, ... to rebuild one chain
+// Nodes are only re-linked, never copied, and appending to a bucket's tail
+// keeps equal bytes in their previous order (stable).
+//
+// Signed keys: flipping the sign bit maps INT_MIN..INT_MAX onto
+// 0..UINT_MAX in the same order, so negatives sort before positives.
+//
+// A first pass builds all byte histograms; a byte position where every key
+// lands in the same bucket (e.g. the top bytes of small numbers) is skipped.
+// If `tailOut` is given it receives the last node (circular lists need it).
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+NodeT* radixSort(NodeT* head, NodeT** tailOut = nullptr) {
+    using Key = typename std::remove_cv<decltype(head->data)>::type;
+    static_assert(std::is_integral<Key>::value, "radixSort needs an integer data member");
+    using UKey = typename std::make_unsigned<Key>::type;
+
+    const int PASSES = sizeof(Key);
+    const UKey SIGN_FLIP = std::is_signed<Key>::value ? static_cast<UKey>(UKey(1) << (8 * sizeof(Key) - 1)) : UKey(0);
+
+    auto digit = [SIGN_FLIP](const NodeT* node, int pass) -> unsigned {
+        UKey bits = static_cast<UKey>(static_cast<UKey>(node->data) ^ SIGN_FLIP);
+        return static_cast<unsigned>((bits >> (8 * pass)) & 0xFFu);
+    };
+
+    // Histogram of every byte position in one walk
+    std::size_t length = 0;
+    std::vector<std::size_t> counts(static_cast<std::size_t>(PASSES) * 256, 0);
+    NodeT* tail = nullptr;
+    for (NodeT* cur = head; cur != nullptr; cur = cur->next) {
+        for (int pass = 0; pass < PASSES; pass++) counts[pass * 256 + digit(cur, pass)]++;
+        tail = cur;
+        length++;
+    }
+
+    NodeT* bucketHead[256];
+    NodeT* bucketTail[256];
+
+    for (int pass = 0; pass < PASSES && length > 1; pass++) {
+        if (counts[pass * 256 + digit(head, pass)] == length) continue; // all keys share this byte
+
+        for (int b = 0; b < 256; b++) bucketHead[b] = bucketTail[b] = nullptr;
+
+        // 1) distribute
+        for (NodeT* cur = head; cur != nullptr;) {
+            NodeT* nxt = cur->next;
+            unsigned b = digit(cur, pass);
+            if (bucketTail[b] == nullptr) bucketHead[b] = cur;
+            else bucketTail[b]->next = cur;
+            bucketTail[b] = cur;
+            cur = nxt;
+        }
+
+        // 2) concatenate buckets 0..255
+        head = nullptr;
+        tail = nullptr;
+        for (int b = 0; b < 256; b++) {
+            if (bucketHead[b] == nullptr) continue;
+            if (tail == nullptr) head = bucketHead[b];
+            else tail->next = bucketHead[b];
+            tail = bucketTail[b];
+        }
+        tail->next = nullptr;
+    }
+
+    if (tailOut != nullptr) *tailOut = tail;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// relinkPrev: after sorting a doubly linked chain through `next` only,
+// rebuild every `prev` pointer. Returns the tail node.
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+NodeT* relinkPrev(NodeT* head) {
+    NodeT* previous = nullptr;
+    for (NodeT* cur = head; cur != nullptr; cur = cur->next) {
+        cur->prev = previous;
+        previous = cur;
+    }
+    return previous;
+}
+
+} // namespace listsort
+
+#endif // LIST_SORT_H
@@ -0,0 +1,201 @@
+// Memory Usage Header File
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <algorithm> // std::find
+#include <cstddef>  // std::size_t, std::max_align_t
+#include <cstdint>  // std::uintptr_t
+#include <memory>   // std::allocator, std::allocator_traits
+#include <vector>
+
+#include "NodeArena.h"
+
+/*
+Memory footprint of a container: where do the bytes go?
+
+Every container has a memoryUsage() method that returns this breakdown:
+
+  payloadBytes         the values themselves (elements * sizeof(value))
+  overheadBytes        everything the layout adds on top of the payload:
+                       next/prev pointers and padding inside each node,
+                       unused slots of a fixed array, the container object
+  allocatorSlackBytes  what malloc adds per heap block (chunk header +
+                       rounding up to its size classes); the program never
+                       sees these bytes but they are still used
+  heapBlocks           number of separate heap allocations (a compact()
+                       arena is one, however many nodes it holds)
+  fragmentation        0..1, share of links that jump somewhere other than
+                       the neighbouring heap block (or arena slot, after
+                       compact(), see NodeArena.h). 0 = the nodes sit in list
+                       order in memory (prefetch-friendly), 1 = every hop
+                       is a jump (typical after sort() or random inserts)
+
+For node containers the slack is computed from the allocator's size-class
+rule (mallocBlockSize below), not measured, and fragmentation needs one
+O(n) walk over the nodes. Array containers have no slack and no jumps.
+
+CountingAllocator<T> wraps another allocator and records how many bytes
+a standard container (std::list, std::vector, std::deque, ...) asks for,
+so the standard containers can be compared on the same terms
+(usageFromStats).
+*/
+
+namespace memusage {
+
+struct MemoryUsage {
+    std::size_t elements = 0;
+    std::size_t payloadBytes = 0;
+    std::size_t overheadBytes = 0;
+    std::size_t allocatorSlackBytes = 0;
+    std::size_t heapBlocks = 0;
+    double      fragmentation = 0.0;
+
+    std::size_t totalBytes() const { return payloadBytes + overheadBytes + allocatorSlackBytes; }
+
+    double bytesPerElement() const {
+        return elements ? static_cast<double>(totalBytes()) / static_cast<double>(elements) : 0.0;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// mallocBlockSize: bytes one malloc(requested) really occupies
+//
+// glibc (64-bit): an 8-byte size header is added, the sum is rounded up to a
+// multiple of 16, and no chunk is smaller than 32 bytes. So a 16-byte list
+// node costs 32 bytes. Other allocators: assume rounding to max_align_t.
+// ----------------------------------------------------------------------------
+inline std::size_t mallocBlockSize(std::size_t requested) {
+#if defined(__GLIBC__) && UINTPTR_MAX == 0xffffffffffffffffu
+    std::size_t chunk = (requested + sizeof(std::size_t) + 15) & ~static_cast<std::size_t>(15);
+    return chunk < 32 ? 32 : chunk;
+#else
+    const std::size_t align = alignof(std::max_align_t);
+    return requested == 0 ? align : (requested + align - 1) / align * align;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// nodeChainUsage: one node per element, reached through ->next
+//
+// Walks exactly `count` nodes from `first` (so it also works on a circular
+// list). containerBytes = sizeof the container object (head pointer, count...).
+// A node is its own malloc block, or a slot of a compact()/deserialize()
+// arena (nodearena::Registry says which): an arena counts as one block,
+// and its slots have no per-node slack.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename ValueT>
+MemoryUsage nodeChainUsage(const NodeT* first, std::size_t count, std::size_t containerBytes) {
+    using Registry = nodearena::Registry<NodeT>;
+    MemoryUsage usage;
+    usage.elements = count;
+    usage.payloadBytes = count * sizeof(ValueT);
+    usage.overheadBytes = count * (sizeof(NodeT) - sizeof(ValueT)) + containerBytes;
+
+    const std::uintptr_t neighbour = mallocBlockSize(sizeof(NodeT));
+    std::vector<const typename Registry::Block*> arenas;   // seen so far (a handful)
+    std::size_t heapNodes = 0;
+    std::size_t jumps = 0;
+    const NodeT* cur = first;
+    for (std::size_t i = 0; i < count; i++) {
+        const typename Registry::Block* arena = Registry::arenaOf(cur);
+        if (arena == nullptr) heapNodes++;
+        else if (std::find(arenas.begin(), arenas.end(), arena) == arenas.end()) arenas.push_back(arena);
+        if (i + 1 == count) break;
+        std::uintptr_t from = reinterpret_cast<std::uintptr_t>(cur);
+        std::uintptr_t to = reinterpret_cast<std::uintptr_t>(cur->next);
+        std::uintptr_t distance = (to > from) ? to - from : from - to;
+        if (distance != neighbour && distance != sizeof(NodeT)) jumps++;
+        cur = cur->next;
+    }
+    usage.allocatorSlackBytes = heapNodes * (neighbour - sizeof(NodeT));
+    usage.heapBlocks = heapNodes + arenas.size();
+    if (count > 1) usage.fragmentation = static_cast<double>(jumps) / static_cast<double>(count - 1);
+    return usage;
+}
+
+// ----------------------------------------------------------------------------
+// arrayUsage: fixed array stored INSIDE the container object (no heap)
+// Unused slots count as overhead: they are reserved whether used or not.
+// ----------------------------------------------------------------------------
+template <typename ValueT>
+MemoryUsage arrayUsage(std::size_t used, std::size_t containerBytes) {
+    MemoryUsage usage;
+    usage.elements = used;
+    usage.payloadBytes = used * sizeof(ValueT);
+    usage.overheadBytes = containerBytes - usage.payloadBytes;
+    return usage;
+}
+
+// ----------------------------------------------------------------------------
+// CountingAllocator: allocator adapter that records requested bytes
+//
+// All copies (and rebinds, e.g. std::list<int> allocating list nodes) share
+// one AllocationStats object. Not thread-safe: one stats object per thread.
+// ----------------------------------------------------------------------------
+struct AllocationStats {
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t liveBytes = 0;       // requested bytes currently allocated
+    std::size_t liveBlockBytes = 0;  // the same, rounded by mallocBlockSize
+    std::size_t peakLiveBytes = 0;
+};
+
+template <typename T, typename Base = std::allocator<T>>
+class CountingAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = CountingAllocator<U, typename std::allocator_traits<Base>::template rebind_alloc<U>>;
+    };
+
+    explicit CountingAllocator(AllocationStats& stats, const Base& base = Base()) : stats_(&stats), base_(base) {}
+
+    template <typename U, typename OtherBase>
+    CountingAllocator(const CountingAllocator<U, OtherBase>& other) : stats_(other.stats()), base_(other.base()) {}
+
+    T* allocate(std::size_t n) {
+        T* p = std::allocator_traits<Base>::allocate(base_, n);
+        stats_->allocations++;
+        stats_->liveBytes += n * sizeof(T);
+        stats_->liveBlockBytes += mallocBlockSize(n * sizeof(T));
+        if (stats_->liveBytes > stats_->peakLiveBytes) stats_->peakLiveBytes = stats_->liveBytes;
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        stats_->deallocations++;
+        stats_->liveBytes -= n * sizeof(T);
+        stats_->liveBlockBytes -= mallocBlockSize(n * sizeof(T));
+        std::allocator_traits<Base>::deallocate(base_, p, n);
+    }
+
+    AllocationStats* stats() const { return stats_; }
+    const Base& base() const { return base_; }
+
+    template <typename U, typename OtherBase>
+    bool operator==(const CountingAllocator<U, OtherBase>& other) const { return stats_ == other.stats(); }
+    template <typename U, typename OtherBase>
+    bool operator!=(const CountingAllocator<U, OtherBase>& other) const { return stats_ != other.stats(); }
+
+private:
+    AllocationStats* stats_;
+    Base             base_;
+};
+
+// Breakdown for a standard container that allocated through CountingAllocator
+inline MemoryUsage usageFromStats(const AllocationStats& stats, std::size_t elements, std::size_t valueBytes,
+                                  std::size_t containerBytes) {
+    MemoryUsage usage;
+    usage.elements = elements;
+    usage.payloadBytes = elements * valueBytes;
+    usage.overheadBytes = stats.liveBytes + containerBytes - usage.payloadBytes;
+    usage.allocatorSlackBytes = stats.liveBlockBytes - stats.liveBytes;
+    usage.heapBlocks = stats.allocations - stats.deallocations;
+    return usage;
+}
+
+} // namespace memusage
+
+#endif // MEMORY_USAGE_H
@@ -0,0 +1,725 @@
+// Node Arena Header File
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>   // std::size_t
+#include <cstdint>   // SIZE_MAX
+#include <cstring>   // std::memcpy
+#include <memory>    // std::unique_ptr
+#include <mutex>
+#include <new>       // ::operator new, placement new
+#include <type_traits>
+#include <utility>   // std::move
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h> // MPOL_* (mbind through syscall: no libnuma needed)
+#include <sys/mman.h>        // mmap, munmap, madvise
+#include <sys/syscall.h>     // SYS_mbind, SYS_getcpu
+#include <unistd.h>          // syscall
+#endif
+
+/*
+Compaction: putting a scattered list back in order
+
+A list that has lived through many inserts and deletes has its nodes spread
+all over the heap: node k+1 is rarely near node k, so a walk misses the cache
+at every step (MemoryUsage.h reports this as `fragmentation`). A freshly
+built list is often several times faster to walk, simply because malloc
+handed out neighbouring blocks.
+
+compact() rebuilds that layout without changing the list:
+
+    before:  head -> [A @ 0x9f40] -> [B @ 0x1200] -> [C @ 0x7b80] -> ...
+    after:   head -> [A @ arena+0] -> [B @ arena+16] -> [C @ arena+32] -> ...
+
+  1) allocate ONE block (the arena) with room for every node
+  2) walk the list; move each node's value into the next arena slot, fix the
+     links around it (next, and prev for a doubly linked list), delete the
+     old node
+  3) the arena now holds the nodes in traversal order, packed at
+     sizeof(Node) apart: no malloc headers, consecutive cache lines
+
+Doing it in SLICES (Compactor::step(head, count, budget)) bounds each pause:
+the walk stops after `budget` nodes and remembers where it was (the
+"frontier": the last node already moved). The list can be used normally
+between slices. If the frontier node is deleted in the meantime, the next
+slice simply restarts from the head and skips nodes already in the arena.
+
+Deleting an arena node
+  The lists keep freeing nodes with plain `delete` (also ListSetOps.h, which
+  never sees the list). Node types that can live in an arena declare
+
+      static void* operator new(std::size_t bytes) {
+          return nodearena::Registry<Node>::allocate(bytes);
+      }
+      static void operator delete(void* p, std::size_t bytes) {
+          nodearena::Registry<Node>::deallocate(p, bytes);
+      }
+
+  Arenas are page-aligned and never share a page, so a PageMap (a 3-level
+  table, like the CPU's page table) answers "which arena holds p?" with
+  three atomic loads and no lock. deallocate() turns an arena node into a
+  hole of its arena (anything else goes back to the heap); allocate() fills
+  the holes of the arena that last got one before asking the heap, so a
+  list that keeps deleting and inserting reuses the space instead of
+  pinning a mostly empty arena. An arena is released with its last node.
+  As long as no arena of the type exists, both checks are one atomic load.
+
+Cost: the arena is one block, so nodes added later come from the heap (or
+the holes) again. Any pointer or iterator to a moved node is invalidated.
+Like every container here, a list (and its compaction) must be used from
+one thread at a time. The registry is shared: its delete/new path is
+lock-free (a per-arena spin flag guards the holes), and only creating or
+releasing a whole arena takes the registry's mutex.
+
+Backing: huge pages and NUMA placement (Linux; elsewhere always Heap)
+  With hundreds of millions of nodes a walk also misses the TLB: a 4 KB page
+  holds 256 16-byte nodes, so 1 GB of nodes spans 262144 pages, far more
+  than the few thousand TLB entries. setArenaBacking() picks where the
+  NEXT arena's memory comes from:
+
+    pages  Heap             ::operator new (malloc), 4 KB pages
+           TransparentHuge  mmap aligned to 2 MB + madvise(MADV_HUGEPAGE):
+                            the kernel backs it with 2 MB pages when it can
+                            (/sys/kernel/mm/transparent_hugepage/enabled
+                            must be "always" or "madvise")
+           ExplicitHuge     mmap(MAP_HUGETLB) from the reserved pool
+                            (/proc/sys/vm/nr_hugepages); falls back to
+                            TransparentHuge when the pool is empty
+    numa   Default          the process policy (usually: first touch)
+           Local            MPOL_LOCAL: the node of the CPU that writes the
+                            page, i.e. the thread running compact(); give
+                            each thread its own container for node-local
+                            memory
+           Bind             only the nodes in nodeMask (MPOL_BIND)
+           Interleave       pages round-robin over nodeMask (MPOL_INTERLEAVE):
+                            even bandwidth for a list shared by all sockets
+
+  A NUMA policy needs page-aligned memory, so it implies mmap even for
+  Heap pages. If the kernel refuses (no NUMA support, seccomp) the arena
+  is still created; CompactReport says what was actually obtained.
+*/
+
+namespace nodearena {
+
+const std::size_t ARENA_PAGE = 4096;   // arena granularity: no two arenas share a page
+
+// ----------------------------------------------------------------------------
+// Backing: page size and NUMA policy for new arenas (see above)
+// ----------------------------------------------------------------------------
+struct Backing {
+    enum class Pages { Heap, TransparentHuge, ExplicitHuge };
+    enum class Numa { Default, Local, Bind, Interleave };
+
+    Pages pages = Pages::Heap;
+    Numa numa = Numa::Default;
+    unsigned long nodeMask = 0;   // Bind / Interleave: bit k = NUMA node k
+};
+
+inline const char* pagesName(Backing::Pages pages) {
+    switch (pages) {
+        case Backing::Pages::Heap: return "heap";
+        case Backing::Pages::TransparentHuge: return "THP";
+        case Backing::Pages::ExplicitHuge: return "hugetlb";
+    }
+    return "?";
+}
+
+// NUMA node of the CPU this thread is running on (0 if unknown)
+inline unsigned currentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return node;
+#endif
+    return 0;
+}
+
+// Memory for one arena, obtained as `backing` asks (or the nearest fallback)
+struct Mapping {
+    unsigned char* begin = nullptr;
+    void* raw = nullptr;                  // what ::operator new returned
+    std::size_t mappedBytes = 0;          // 0: from ::operator new
+    Backing::Pages pages = Backing::Pages::Heap;
+    bool numaApplied = false;             // the mbind() policy was accepted
+
+    static const std::size_t HUGE_PAGE = std::size_t(2) << 20;
+
+    static Mapping allocate(std::size_t bytes, const Backing& backing) {
+        Mapping m;
+#if defined(__linux__)
+        if (backing.pages != Backing::Pages::Heap || backing.numa != Backing::Numa::Default) {
+            if (bytes == 0) bytes = 1;
+            if (backing.pages == Backing::Pages::ExplicitHuge) m.mapHugeTlb(bytes);
+            if (m.begin == nullptr && backing.pages != Backing::Pages::Heap) m.mapTransparent(bytes);
+            if (m.begin == nullptr) m.mapPlain(bytes);
+            if (m.begin != nullptr) {
+                m.numaApplied = m.bind(backing);
+                return m;
+            }
+        }
+#else
+        (void)backing;
+#endif
+        // One spare page, then start on the first ARENA_PAGE boundary inside:
+        // the arena's pages hold nothing else, so PageMap can own them. (The
+        // aligned ::operator new would do this through memalign, which leaves
+        // the heap behind it scattered.)
+        std::size_t rounded = (bytes + ARENA_PAGE - 1) / ARENA_PAGE * ARENA_PAGE;
+        if (rounded == 0) rounded = ARENA_PAGE;
+        m.raw = ::operator new(rounded + ARENA_PAGE);
+        std::uintptr_t at = reinterpret_cast<std::uintptr_t>(m.raw);
+        m.begin = reinterpret_cast<unsigned char*>((at + ARENA_PAGE - 1) / ARENA_PAGE * ARENA_PAGE);
+        return m;
+    }
+
+    void release() {
+#if defined(__linux__)
+        if (mappedBytes != 0) {
+            munmap(begin, mappedBytes);
+            return;
+        }
+#endif
+        ::operator delete(raw);
+    }
+
+private:
+#if defined(__linux__)
+    static std::size_t roundUp(std::size_t bytes, std::size_t to) { return (bytes + to - 1) / to * to; }
+
+    void mapHugeTlb(std::size_t bytes) {
+        std::size_t length = roundUp(bytes, HUGE_PAGE);
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p == MAP_FAILED) return;
+        begin = static_cast<unsigned char*>(p);
+        mappedBytes = length;
+        pages = Backing::Pages::ExplicitHuge;
+    }
+
+    // Over-allocate by one huge page, then trim both ends so the arena starts
+    // on a 2 MB boundary: only aligned 2 MB ranges can become huge pages
+    void mapTransparent(std::size_t bytes) {
+        std::size_t length = roundUp(bytes, HUGE_PAGE);
+        void* p = mmap(nullptr, length + HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return;
+        unsigned char* raw = static_cast<unsigned char*>(p);
+        unsigned char* aligned = reinterpret_cast<unsigned char*>(
+            roundUp(reinterpret_cast<std::uintptr_t>(raw), HUGE_PAGE));
+        std::size_t head = static_cast<std::size_t>(aligned - raw);
+        if (head != 0) munmap(raw, head);
+        if (HUGE_PAGE - head != 0) munmap(aligned + length, HUGE_PAGE - head);
+        begin = aligned;
+        mappedBytes = length;
+        pages = (madvise(aligned, length, MADV_HUGEPAGE) == 0) ? Backing::Pages::TransparentHuge
+                                                               : Backing::Pages::Heap;
+    }
+
+    void mapPlain(std::size_t bytes) {
+        std::size_t length = roundUp(bytes, static_cast<std::size_t>(sysconf(_SC_PAGESIZE)));
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return;
+        begin = static_cast<unsigned char*>(p);
+        mappedBytes = length;
+        pages = Backing::Pages::Heap;
+    }
+
+    // Set the policy before the first touch: pages are placed when faulted in
+    bool bind(const Backing& backing) const {
+#if defined(SYS_mbind)
+        int mode = MPOL_DEFAULT;
+        const unsigned long* mask = nullptr;
+        unsigned long maxNode = 0;
+        switch (backing.numa) {
+            case Backing::Numa::Default: return false;
+            case Backing::Numa::Local: mode = MPOL_LOCAL; break;
+            case Backing::Numa::Bind: mode = MPOL_BIND; break;
+            case Backing::Numa::Interleave: mode = MPOL_INTERLEAVE; break;
+        }
+        if (backing.numa != Backing::Numa::Local) {
+            if (backing.nodeMask == 0) return false;
+            mask = &backing.nodeMask;
+            maxNode = sizeof(backing.nodeMask) * 8;
+        }
+        return syscall(SYS_mbind, begin, mappedBytes, mode, mask, maxNode, 0) == 0;
+#else
+        (void)backing;
+        return false;
+#endif
+    }
+#endif
+};
+
+// ----------------------------------------------------------------------------
+// PageMap: arena page -> its Block, read without any lock
+//
+// Three levels of 4096 entries cover 48-bit addresses at ARENA_PAGE pages.
+// Lower tables are added the first time an arena lands in their range and
+// kept for the life of the process (32 KB per 16 MB of address space that
+// ever held an arena). Writers (arena creation / release) are serialised
+// by the caller; readers pay three dependent loads.
+// ----------------------------------------------------------------------------
+class PageMap {
+public:
+    static const unsigned BITS = 12;
+    static const std::size_t FANOUT = std::size_t(1) << BITS;
+
+    // Can [begin, begin + bytes) be entered at all? (48-bit addresses)
+    static bool covers(const void* begin, std::size_t bytes) {
+        std::uintptr_t last = reinterpret_cast<std::uintptr_t>(begin) + (bytes == 0 ? 0 : bytes - 1);
+        return (last / ARENA_PAGE) >> (3 * BITS) == 0;
+    }
+
+    void* find(const void* p) const {
+        std::uintptr_t page = reinterpret_cast<std::uintptr_t>(p) / ARENA_PAGE;
+        if ((page >> (3 * BITS)) != 0) return nullptr;
+        Middle* middle = root_[page >> (2 * BITS)].load(std::memory_order_acquire);
+        if (middle == nullptr) return nullptr;
+        Leaf* leaf = middle->entries[(page >> BITS) % FANOUT].load(std::memory_order_acquire);
+        if (leaf == nullptr) return nullptr;
+        return leaf->entries[page % FANOUT].load(std::memory_order_acquire);
+    }
+
+    // Every page of [begin, begin + bytes) -> value (may throw std::bad_alloc
+    // while adding tables; the pages entered so far are then left set)
+    void set(const void* begin, std::size_t bytes, void* value) {
+        forEachPage(begin, bytes, [&](std::uintptr_t page) {
+            leafFor(page)->entries[page % FANOUT].store(value, std::memory_order_release);
+        });
+    }
+
+    void clear(const void* begin, std::size_t bytes) {
+        forEachPage(begin, bytes, [&](std::uintptr_t page) {
+            Middle* middle = root_[page >> (2 * BITS)].load(std::memory_order_relaxed);
+            if (middle == nullptr) return;
+            Leaf* leaf = middle->entries[(page >> BITS) % FANOUT].load(std::memory_order_relaxed);
+            if (leaf != nullptr) leaf->entries[page % FANOUT].store(nullptr, std::memory_order_release);
+        });
+    }
+
+private:
+    // No initialisers: new Leaf() / a static PageMap start zeroed
+    struct Leaf {
+        std::atomic<void*> entries[FANOUT];
+    };
+    struct Middle {
+        std::atomic<Leaf*> entries[FANOUT];
+    };
+    std::atomic<Middle*> root_[FANOUT];
+
+    template <typename Visit>
+    static void forEachPage(const void* begin, std::size_t bytes, Visit visit) {
+        std::uintptr_t first = reinterpret_cast<std::uintptr_t>(begin) / ARENA_PAGE;
+        std::uintptr_t last = (reinterpret_cast<std::uintptr_t>(begin) + (bytes == 0 ? 0 : bytes - 1)) / ARENA_PAGE;
+        for (std::uintptr_t page = first; page <= last; page++) visit(page);
+    }
+
+    Leaf* leafFor(std::uintptr_t page) {
+        std::atomic<Middle*>& top = root_[page >> (2 * BITS)];
+        Middle* middle = top.load(std::memory_order_relaxed);
+        if (middle == nullptr) {
+            middle = new Middle();
+            top.store(middle, std::memory_order_release);
+        }
+        std::atomic<Leaf*>& entry = middle->entries[(page >> BITS) % FANOUT];
+        Leaf* leaf = entry.load(std::memory_order_relaxed);
+        if (leaf == nullptr) {
+            leaf = new Leaf();
+            entry.store(leaf, std::memory_order_release);
+        }
+        return leaf;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Registry<NodeT>: every arena block of one node type
+//
+// A Block lives while `refs` > 0: one reference per node in it, plus one
+// while it is open (being filled). Whoever drops the last reference
+// releases the memory. Block descriptors are recycled, and only freed with
+// the registry at exit, so a stale pointer to one (the hole hint) is always
+// safe to look at.
+// ----------------------------------------------------------------------------
+template <typename NodeT>
+class Registry {
+public:
+    static const std::size_t NO_HOLE = ~std::size_t(0);
+
+    struct Block {
+        unsigned char* begin = nullptr;
+        std::size_t capacity = 0;                  // slots
+        std::size_t used = 0;                      // slots handed out in order (by the filler only)
+        std::atomic<std::size_t> refs{0};          // live nodes + 1 while open; 0: descriptor unused
+        std::atomic<bool> open{false};             // still being filled by a compaction
+        std::atomic<NodeT*> frontier{nullptr};     // last node moved (nullptr once deleted)
+        Mapping memory;
+
+        // Deleted slots, linked through their own bytes; guarded by holesLock
+        std::atomic_flag holesLock = ATOMIC_FLAG_INIT;
+        std::size_t firstHole = NO_HOLE;
+
+        bool contains(const void* p) const {
+            const unsigned char* bytes = static_cast<const unsigned char*>(p);
+            return bytes >= begin && bytes < begin + capacity * sizeof(NodeT);
+        }
+    };
+
+    static_assert(alignof(NodeT) <= ARENA_PAGE, "arena slots are page-aligned at most");
+    static_assert(sizeof(NodeT) >= sizeof(std::size_t), "a hole stores the index of the next one");
+
+    // A new, empty arena with room for `capacity` nodes, or nullptr if its
+    // address cannot be entered in the PageMap (beyond 48 bits)
+    static Block* open(std::size_t capacity, const Backing& backing = Backing()) {
+        std::size_t bytes = capacity * sizeof(NodeT);
+        Mapping memory = Mapping::allocate(bytes, backing);
+        if (!PageMap::covers(memory.begin, bytes)) {
+            memory.release();
+            return nullptr;
+        }
+        State& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        Block* block = nullptr;
+        try {
+            if (s.spare.empty()) {
+                s.spare.reserve(s.descriptors.size() + 1);   // release() can always give it back
+                s.descriptors.push_back(std::unique_ptr<Block>(new Block));
+                s.spare.push_back(s.descriptors.back().get());
+            }
+            block = s.spare.back();
+            s.spare.pop_back();
+            s.pages.set(memory.begin, bytes, block);
+        } catch (...) {
+            s.pages.clear(memory.begin, bytes);
+            if (block != nullptr) s.spare.push_back(block);
+            memory.release();
+            throw;
+        }
+        block->begin = memory.begin;
+        block->capacity = capacity;
+        block->used = 0;
+        block->memory = memory;
+        block->firstHole = NO_HOLE;
+        block->frontier.store(nullptr, std::memory_order_relaxed);
+        block->open.store(true, std::memory_order_relaxed);
+        block->refs.store(1, std::memory_order_release);
+        s.count.fetch_add(1, std::memory_order_relaxed);
+        return block;
+    }
+
+    // No more nodes will be moved in: the arena is freed with its last node
+    static void close(Block* block) {
+        block->open.store(false, std::memory_order_relaxed);
+        block->frontier.store(nullptr, std::memory_order_relaxed);
+        release(state(), block);
+    }
+
+    // `added` nodes were constructed in slots handed out since the last call
+    static void commit(Block* block, std::size_t added) {
+        block->refs.fetch_add(added, std::memory_order_relaxed);
+    }
+
+    // operator new for arena-capable node types: a hole of the arena that
+    // last got one, else the heap
+    static void* allocate(std::size_t bytes) {
+        State& s = state();
+        Block* block = s.hint.load(std::memory_order_acquire);   // pairs with deallocate()
+        if (block != nullptr && bytes == sizeof(NodeT)) {
+            if (acquire(block)) {
+                lockHoles(block);
+                std::size_t slot = block->firstHole;
+                unsigned char* at = nullptr;
+                if (slot != NO_HOLE) {
+                    at = block->begin + slot * sizeof(NodeT);
+                    std::memcpy(&block->firstHole, at, sizeof(std::size_t));
+                }
+                unlockHoles(block);
+                if (at != nullptr) return at;   // the reference taken is the new node's
+                release(s, block);
+            }
+            s.hint.compare_exchange_strong(block, nullptr, std::memory_order_relaxed);   // out of holes
+        }
+        return ::operator new(bytes);
+    }
+
+    // operator delete for arena-capable node types
+    static void deallocate(void* p, std::size_t bytes) {
+        State& s = state();
+        if (s.count.load(std::memory_order_relaxed) != 0) {
+            Block* block = static_cast<Block*>(s.pages.find(p));
+            if (block != nullptr) {
+                NodeT* node = static_cast<NodeT*>(p);
+                block->frontier.compare_exchange_strong(node, nullptr, std::memory_order_relaxed);
+                std::size_t slot = static_cast<std::size_t>(static_cast<unsigned char*>(p) - block->begin) / sizeof(NodeT);
+                lockHoles(block);
+                std::memcpy(p, &block->firstHole, sizeof(std::size_t));
+                block->firstHole = slot;
+                unlockHoles(block);
+                s.hint.store(block, std::memory_order_release);
+                release(s, block);
+                return;
+            }
+        }
+        ::operator delete(p, bytes);
+    }
+
+    // The arena holding p, or nullptr for a heap node (MemoryUsage.h)
+    static const Block* arenaOf(const void* p) {
+        State& s = state();
+        if (s.count.load(std::memory_order_relaxed) == 0) return nullptr;
+        return static_cast<const Block*>(s.pages.find(p));
+    }
+
+    // Arena blocks of this node type currently alive (memory held until
+    // their last node is deleted)
+    static std::size_t blockCount() { return state().count.load(std::memory_order_relaxed); }
+
+private:
+    struct State {
+        PageMap pages;                     // zeroed: static storage
+        std::atomic<Block*> hint{nullptr}; // arena that most recently got a hole
+        std::atomic<std::size_t> count{0};
+        std::mutex mutex;                  // arena creation / release only
+        std::vector<std::unique_ptr<Block>> descriptors;
+        std::vector<Block*> spare;         // descriptors not in use
+    };
+
+    static State& state() {
+        static State s;
+        return s;
+    }
+
+    // Take a reference unless the block is already gone (refs == 0)
+    static bool acquire(Block* block) {
+        std::size_t refs = block->refs.load(std::memory_order_relaxed);
+        while (refs != 0) {
+            if (block->refs.compare_exchange_weak(refs, refs + 1, std::memory_order_acquire)) return true;
+        }
+        return false;
+    }
+
+    static void release(State& s, Block* block) {
+        if (block->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        // last reference: nobody can reach the block any more
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.pages.clear(block->begin, block->capacity * sizeof(NodeT));
+        Mapping memory = block->memory;
+        block->begin = nullptr;
+        block->capacity = 0;
+        s.spare.push_back(block);          // capacity reserved in open()
+        s.count.fetch_sub(1, std::memory_order_relaxed);
+        memory.release();
+    }
+
+    static void lockHoles(Block* block) {
+        while (block->holesLock.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+    static void unlockHoles(Block* block) { block->holesLock.clear(std::memory_order_release); }
+};
+
+// ----------------------------------------------------------------------------
+// Compactor<NodeT>: one list's (possibly sliced) compaction
+//
+// Works on any null-terminated chain of nodes with data/next; if the node
+// also has `prev`, the back links are fixed too.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename = void>
+struct hasPrev : std::false_type {};
+template <typename NodeT>
+struct hasPrev<NodeT, std::void_t<decltype(&NodeT::prev)>> : std::true_type {};
+
+template <typename NodeT>
+class Compactor {
+public:
+    // Default for step(): nobody else holds node pointers
+    struct IgnoreMoves {
+        void operator()(NodeT*, NodeT*) const {}
+    };
+
+    using Block = typename Registry<NodeT>::Block;
+
+    Compactor() = default;
+    ~Compactor() { abandon(); }
+
+    // A copied list starts without a compaction in progress (same backing)
+    Compactor(const Compactor& other) : backing(other.backing) {}
+    Compactor& operator=(const Compactor& other) {
+        backing = other.backing;
+        return *this;
+    }
+
+    bool active() const { return target != nullptr; }
+    std::size_t movedNodes() const { return moved; }   // in the current / last pass
+
+    // Memory for the arenas of later passes
+    void setBacking(const Backing& b) { backing = b; }
+    const Backing& requestedBacking() const { return backing; }
+    // What the current / last pass actually got
+    Backing::Pages obtainedPages() const { return obtained.pages; }
+    bool numaApplied() const { return obtained.numaApplied; }
+
+    // Move up to `budget` nodes of the chain starting at `head` into the
+    // arena. The first call of a pass sizes the arena for `count` nodes.
+    // `tail` (if given) is kept pointing at the last node.
+    // onMove(from, to) runs for each node moved, once `to` is linked in and
+    // before `from` is deleted (from->data has been moved out by then).
+    // Returns true when the pass is complete (the next call starts a new one).
+    template <typename OnMove = IgnoreMoves>
+    bool step(NodeT*& head, std::size_t count, std::size_t budget, NodeT** tail = nullptr,
+              OnMove onMove = OnMove()) {
+        if (target == nullptr) {
+            moved = 0;
+            if (head == nullptr || count == 0) return true;
+            target = Registry<NodeT>::open(count, backing);
+            if (target == nullptr) return true;   // no arena for this address range
+            obtained = target->memory;
+        }
+
+        NodeT* pred = target->frontier.load(std::memory_order_relaxed);   // nullptr: (re)start at the head
+        NodeT* cur = (pred != nullptr) ? pred->next : head;
+        std::size_t added = 0;
+        bool full = false;
+        for (; cur != nullptr && budget > 0; budget--) {
+            if (target->contains(cur)) {       // already moved (after a restart)
+                pred = cur;
+                cur = cur->next;
+                continue;
+            }
+            if (target->used == target->capacity) {   // list grew since the pass began
+                full = true;
+                break;
+            }
+            void* slot = target->begin + target->used++ * sizeof(NodeT);
+            NodeT* copy = ::new (slot) NodeT(std::move(cur->data));
+            added++;
+            copy->next = cur->next;
+            if constexpr (hasPrev<NodeT>::value) {
+                copy->prev = cur->prev;
+                if (copy->next != nullptr) copy->next->prev = copy;
+            }
+            if (pred != nullptr) pred->next = copy;
+            else head = copy;
+            if (tail != nullptr && copy->next == nullptr) *tail = copy;
+            onMove(cur, copy);
+            delete cur;
+            pred = copy;
+            cur = copy->next;
+        }
+        Registry<NodeT>::commit(target, added);
+        moved += added;
+        target->frontier.store(pred, std::memory_order_relaxed);
+
+        if (cur == nullptr || full) {
+            abandon();
+            return true;
+        }
+        return false;
+    }
+
+    // End the current pass where it is (nodes already moved stay in the arena)
+    void abandon() {
+        if (target == nullptr) return;
+        Registry<NodeT>::close(target);
+        target = nullptr;
+    }
+
+private:
+    Block* target = nullptr;
+    std::size_t moved = 0;
+    Backing backing;
+    Mapping obtained;
+};
+
+// ----------------------------------------------------------------------------
+// buildChain: `count` NEW nodes in one arena block, linked in order
+//
+// For loading a whole list at once (deserialize(), Serialization.h): one
+// allocation instead of `count`, and the nodes come out packed in traversal
+// order, as after compact(). next() returns the next value. Returns the
+// first node (nullptr if count is 0); *tail, if given, gets the last one.
+// `prev` links are set too when the node has them. The nodes are deleted
+// one by one as usual; the block goes away with the last of them.
+// Chains smaller than one ARENA_PAGE are built with plain `new` (an arena
+// would round them up to a whole page).
+// If next() throws, the nodes built so far are deleted again.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename Next>
+NodeT* buildChain(std::size_t count, Next next, NodeT** tail = nullptr, const Backing& backing = Backing()) {
+    if (tail != nullptr) *tail = nullptr;
+    if (count == 0) return nullptr;
+    using Block = typename Registry<NodeT>::Block;
+    Block* block = (count * sizeof(NodeT) >= ARENA_PAGE) ? Registry<NodeT>::open(count, backing) : nullptr;
+    NodeT* head = nullptr;
+    NodeT* last = nullptr;
+    std::size_t built = 0;
+    try {
+        for (; built < count; built++) {
+            NodeT* node;
+            if (block != nullptr) {
+                node = ::new (block->begin + built * sizeof(NodeT)) NodeT(next());
+                block->used++;
+            } else {
+                node = new NodeT(next());
+            }
+            if constexpr (hasPrev<NodeT>::value) node->prev = last;
+            if (last != nullptr) last->next = node;
+            else head = node;
+            last = node;
+        }
+    } catch (...) {
+        if (block != nullptr) {
+            Registry<NodeT>::commit(block, built);
+            Registry<NodeT>::close(block);
+        }
+        while (head != nullptr) {
+            NodeT* following = (head == last) ? nullptr : head->next;
+            delete head;
+            head = following;
+        }
+        throw;
+    }
+    last->next = nullptr;
+    if (block != nullptr) {
+        Registry<NodeT>::commit(block, count);
+        Registry<NodeT>::close(block);
+    }
+    if (tail != nullptr) *tail = last;
+    return head;
+}
+
+// ----------------------------------------------------------------------------
+// Traversal time, measured by compact() before and after moving the nodes
+//
+// The walk only follows `next` (so it works for any T): the cost of the
+// pointer chase itself, which is what compaction changes.
+// ----------------------------------------------------------------------------
+struct CompactReport {
+    std::size_t nodes = 0;
+    std::size_t movedNodes = 0;
+    double nsPerNodeBefore = 0.0;   // one full walk along `next`
+    double nsPerNodeAfter = 0.0;
+    Backing::Pages pages = Backing::Pages::Heap;   // what the arena got
+    bool numaApplied = false;
+
+    double speedup() const { return nsPerNodeAfter > 0.0 ? nsPerNodeBefore / nsPerNodeAfter : 0.0; }
+};
+
+template <typename NodeT>
+double traversalNsPerNode(const NodeT* first, std::size_t count) {
+    if (count == 0) return 0.0;
+    auto start = std::chrono::steady_clock::now();
+    std::size_t checksum = 0;
+    for (const NodeT* node = first; node != nullptr; node = node->next) {
+        checksum += static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(node->next) & 1u);   // loads next only
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    static std::atomic<std::size_t> sink{0};   // keeps the walk from being optimised away
+    sink.fetch_add(checksum, std::memory_order_relaxed);
+    return elapsed.count() / static_cast<double>(count);
+}
+
+} // namespace nodearena
+
+#endif // NODE_ARENA_H
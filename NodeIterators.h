@@ -0,0 +1,246 @@
+// Node Iterators Header File
+#ifndef NODE_ITERATORS_H
+#define NODE_ITERATORS_H
+
+#include <cstddef>  // std::ptrdiff_t
+#include <iterator> // iterator tags
+#include <type_traits> // std::remove_const, std::enable_if
+
+/*
+Why shared iterator templates?
+- Every hand-written list here walks nodes the same way: follow `next`
+  (and `prev` for the doubly linked ones) until nullptr.
+- Writing that walk ONCE as an iterator lets every container hand out
+  begin()/end(), which is all <algorithm>, range-for, the parallel STL
+  (std::execution) and C++20 ranges need.
+
+The templates only assume the node has `data` and `next` members
+(plus `prev` for the bidirectional iterator).
+
+  NodeIterator<NodeT, ValueT>              forward, nullptr-terminated chain
+  BidirectionalNodeIterator<NodeT, ValueT> adds operator-- (needs prev)
+  RingIterator<NodeT, ValueT>              ONE lap around a circular list
+  CircularCursor<NodeT, ValueT>            endless cursor around a ring
+
+ValueT is `int` / `T` for mutable iterators and `const int` / `const T`
+for const_iterators. An iterator converts to the matching const_iterator
+(as with the standard containers), so `const_iterator it = list.begin();`
+and `it != list.cend()` compile.
+*/
+
+// NodeT / ValueT are the const versions of OtherNode / OtherValue (and the
+// others are not const): the iterator -> const_iterator conversion
+template <typename NodeT, typename OtherNode, typename ValueT, typename OtherValue>
+struct IsConstOf
+    : std::integral_constant<bool, std::is_same<NodeT, const OtherNode>::value && !std::is_const<OtherNode>::value &&
+                                       std::is_same<ValueT, const OtherValue>::value &&
+                                       !std::is_const<OtherValue>::value> {};
+
+// ----------------------------------------------------------------------------
+// Forward iterator over a nullptr-terminated singly linked chain
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename ValueT>
+class NodeIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<ValueT>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueT*;
+    using reference = ValueT&;
+
+    NodeIterator() : node_(nullptr) {}
+    explicit NodeIterator(NodeT* node) : node_(node) {}
+
+    // iterator -> const_iterator (never the other way round)
+    template <typename OtherNode, typename OtherValue,
+              typename = typename std::enable_if<IsConstOf<NodeT, OtherNode, ValueT, OtherValue>::value>::type>
+    NodeIterator(const NodeIterator<OtherNode, OtherValue>& other) : node_(other.node_) {}
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    NodeIterator& operator++() {
+        node_ = node_->next;
+        return *this;
+    }
+
+    NodeIterator operator++(int) {
+        NodeIterator old = *this;
+        node_ = node_->next;
+        return old;
+    }
+
+    friend bool operator==(const NodeIterator& a, const NodeIterator& b) { return a.node_ == b.node_; }
+    friend bool operator!=(const NodeIterator& a, const NodeIterator& b) { return a.node_ != b.node_; }
+
+    NodeT* node() const { return node_; } // underlying node (for splice-style helpers)
+
+private:
+    template <typename, typename> friend class NodeIterator;
+    NodeT* node_;
+};
+
+// ----------------------------------------------------------------------------
+// Bidirectional iterator over a nullptr-terminated doubly linked chain
+//
+// end() is represented by node_ == nullptr. Stepping BACK from end() needs
+// the last node, so the iterator also remembers where to find it:
+//   - tailIsKnown == true : *anchor_ is the tail pointer (e.g. TemplatedDeque::rear_)
+//   - tailIsKnown == false: *anchor_ is the head pointer; we walk to the tail
+//     (O(n), but only once per reverse traversal)
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename ValueT>
+class BidirectionalNodeIterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename std::remove_const<ValueT>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueT*;
+    using reference = ValueT&;
+
+    BidirectionalNodeIterator() : node_(nullptr), anchor_(nullptr), tailIsKnown_(false) {}
+    BidirectionalNodeIterator(NodeT* node, NodeT* const* anchor, bool tailIsKnown)
+        : node_(node), anchor_(anchor), tailIsKnown_(tailIsKnown) {}
+
+    // iterator -> const_iterator (never the other way round)
+    template <typename OtherNode, typename OtherValue,
+              typename = typename std::enable_if<IsConstOf<NodeT, OtherNode, ValueT, OtherValue>::value>::type>
+    BidirectionalNodeIterator(const BidirectionalNodeIterator<OtherNode, OtherValue>& other) : node_(other.node_), anchor_(other.anchor_), tailIsKnown_(other.tailIsKnown_) {}
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    BidirectionalNodeIterator& operator++() {
+        node_ = node_->next;
+        return *this;
+    }
+
+    BidirectionalNodeIterator operator++(int) {
+        BidirectionalNodeIterator old = *this;
+        node_ = node_->next;
+        return old;
+    }
+
+    BidirectionalNodeIterator& operator--() {
+        if (node_ != nullptr) {
+            node_ = node_->prev;
+        } else if (tailIsKnown_) {
+            node_ = *anchor_;
+        } else {
+            NodeT* tail = *anchor_;
+            while (tail != nullptr && tail->next != nullptr) tail = tail->next;
+            node_ = tail;
+        }
+        return *this;
+    }
+
+    BidirectionalNodeIterator operator--(int) {
+        BidirectionalNodeIterator old = *this;
+        --(*this);
+        return old;
+    }
+
+    friend bool operator==(const BidirectionalNodeIterator& a, const BidirectionalNodeIterator& b) {
+        return a.node_ == b.node_;
+    }
+    friend bool operator!=(const BidirectionalNodeIterator& a, const BidirectionalNodeIterator& b) {
+        return a.node_ != b.node_;
+    }
+
+    NodeT* node() const { return node_; }
+
+private:
+    template <typename, typename> friend class BidirectionalNodeIterator;
+    NodeT*        node_;
+    NodeT* const* anchor_;
+    bool          tailIsKnown_;
+};
+
+// ----------------------------------------------------------------------------
+// Forward iterator for ONE lap around a circular list
+//
+// In a ring there is no nullptr to stop at: begin() and "one lap later"
+// point at the same node. The iterator therefore also counts laps:
+//   begin() = (head, lap 0)     end() = (head, lap 1)
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename ValueT>
+class RingIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<ValueT>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueT*;
+    using reference = ValueT&;
+
+    RingIterator() : node_(nullptr), head_(nullptr), lap_(0) {}
+    RingIterator(NodeT* node, NodeT* head, std::size_t lap) : node_(node), head_(head), lap_(lap) {}
+
+    // iterator -> const_iterator (never the other way round)
+    template <typename OtherNode, typename OtherValue,
+              typename = typename std::enable_if<IsConstOf<NodeT, OtherNode, ValueT, OtherValue>::value>::type>
+    RingIterator(const RingIterator<OtherNode, OtherValue>& other) : node_(other.node_), head_(other.head_), lap_(other.lap_) {}
+
+    reference operator*() const { return node_->data; }
+    pointer operator->() const { return &node_->data; }
+
+    RingIterator& operator++() {
+        node_ = node_->next;
+        if (node_ == head_) ++lap_;
+        return *this;
+    }
+
+    RingIterator operator++(int) {
+        RingIterator old = *this;
+        ++(*this);
+        return old;
+    }
+
+    friend bool operator==(const RingIterator& a, const RingIterator& b) {
+        return a.node_ == b.node_ && a.lap_ == b.lap_;
+    }
+    friend bool operator!=(const RingIterator& a, const RingIterator& b) { return !(a == b); }
+
+    NodeT* node() const { return node_; }
+
+private:
+    template <typename, typename> friend class RingIterator;
+    NodeT*      node_;
+    NodeT*      head_;
+    std::size_t lap_;
+};
+
+// ----------------------------------------------------------------------------
+// CircularCursor: keeps going around the ring forever
+//
+// Useful for round-robin scheduling: advance() never reaches an "end".
+// An empty ring gives a cursor with isValid() == false.
+// ----------------------------------------------------------------------------
+template <typename NodeT, typename ValueT>
+class CircularCursor {
+public:
+    CircularCursor() : node_(nullptr) {}
+    explicit CircularCursor(NodeT* start) : node_(start) {}
+
+    bool isValid() const { return node_ != nullptr; }
+    ValueT& value() const { return node_->data; }
+
+    // move to the next node (wraps from the last node back to head)
+    CircularCursor& advance() {
+        node_ = node_->next;
+        return *this;
+    }
+
+    // return the current value, then move on
+    ValueT& next() {
+        ValueT& current = node_->data;
+        node_ = node_->next;
+        return current;
+    }
+
+    NodeT* node() const { return node_; }
+
+private:
+    NodeT* node_;
+};
+
+#endif // NODE_ITERATORS_H
@@ -0,0 +1,372 @@
+// Ring Deque Header File
+#ifndef RING_DEQUE_H
+#define RING_DEQUE_H
+
+#include <algorithm>   // std::min, std::max, std::rotate
+#include <cstddef>     // std::size_t
+#include <cstring>     // std::memcpy
+#include <new>         // ::operator new / delete
+#include <stdexcept>   // std::runtime_error
+#include <type_traits> // std::is_trivially_copyable, std::conditional_t
+#include <utility>     // std::swap
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>  // memfd_create, mmap
+#include <unistd.h>    // ftruncate, sysconf, close
+#endif
+
+#include "../MemoryUsage.h" // memoryUsage() breakdown
+#include "TemplatedDeque.h"
+
+/*
+RingDeque: a contiguous deque for trivially copyable T (char, int, structs
+of plain fields)
+
+TemplatedDeque allocates one node per element: a text stream of 1 MB costs a
+million new/delete pairs and 32 bytes of node per char. For plain bytes the
+natural structure is a RING BUFFER: one array, a head index, a count.
+  - push/pop at either end: write one slot, move an index
+  - bulk push/pop: memcpy, which glibc runs with the widest vector moves the
+    CPU has (SSE2/AVX2/AVX-512, or "rep movsb") - the SIMD copy comes free
+
+The catch with rings is the WRAP POINT: data that runs off the end of the
+array continues at index 0, so a block of n elements may be two pieces.
+
+The double-mapping trick (Linux, large buffers):
+  - create an in-memory file (memfd_create) of B bytes
+  - reserve 2B bytes of address space and map the SAME file twice, back to
+    back:    [ pages 0..k ][ pages 0..k again ]
+  - byte i and byte i + B are the same physical memory
+So a block that wraps can be read AND written as one contiguous range
+starting at head: no split, no copy. contiguous() returns the whole deque
+as one array for free.
+
+Small buffers (under MIRROR_MIN_BYTES) use a plain heap array (three mmaps
+per deque would cost more than they save) and split bulk copies at the wrap.
+Elsewhere (not Linux, memfd unavailable) the heap array is used too.
+
+DequeFor<T> picks RingDeque for trivially copyable T and TemplatedDeque
+for everything else; both have insertFront / insertRear / deleteFront /
+deleteRear / peekFront / peekRear / isEmpty / size / clear.
+*/
+
+namespace ringbuffer {
+
+// Buffers this large (bytes) and up are double-mapped when possible
+const std::size_t MIRROR_MIN_BYTES = 64 * 1024;
+
+inline std::size_t pageSize() {
+#if defined(__linux__)
+    static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return page;
+#else
+    return 4096;
+#endif
+}
+
+inline std::size_t gcd(std::size_t a, std::size_t b) {
+    while (b != 0) {
+        std::size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Raw storage: `bytes` usable bytes at `base`; when mirrored, base[bytes..2*bytes)
+// is the same memory again
+class Buffer {
+public:
+    Buffer() = default;
+    ~Buffer() { release(); }
+
+    Buffer(Buffer&& other) noexcept { swap(other); }
+    Buffer& operator=(Buffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    // At least `minBytes` bytes, a multiple of `unit`. Double-mapped if
+    // allowed, large enough and supported; heap otherwise.
+    static Buffer allocate(std::size_t minBytes, std::size_t unit, bool allowMirror) {
+        Buffer buffer;
+        if (allowMirror && minBytes >= MIRROR_MIN_BYTES && buffer.mapMirrored(minBytes, unit)) return buffer;
+        std::size_t bytes = (minBytes + unit - 1) / unit * unit;
+        buffer.base_ = static_cast<unsigned char*>(::operator new(bytes));
+        buffer.bytes_ = bytes;
+        return buffer;
+    }
+
+    unsigned char* base() const { return base_; }
+    std::size_t bytes() const { return bytes_; }
+    bool mirrored() const { return mirrored_; }
+
+    void release() {
+        if (base_ == nullptr) return;
+#if defined(__linux__)
+        if (mirrored_) munmap(base_, 2 * bytes_);
+        else ::operator delete(base_);
+#else
+        ::operator delete(base_);
+#endif
+        base_ = nullptr;
+        bytes_ = 0;
+        mirrored_ = false;
+    }
+
+private:
+    unsigned char* base_ = nullptr;
+    std::size_t bytes_ = 0;
+    bool mirrored_ = false;
+
+    void swap(Buffer& other) {
+        std::swap(base_, other.base_);
+        std::swap(bytes_, other.bytes_);
+        std::swap(mirrored_, other.mirrored_);
+    }
+
+    bool mapMirrored(std::size_t minBytes, std::size_t unit) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+        // both halves must start on a page AND on an element boundary
+        std::size_t page = pageSize();
+        std::size_t step = unit / gcd(unit, page) * page;   // lcm(unit, page)
+        std::size_t bytes = (minBytes + step - 1) / step * step;
+
+        int fd = memfd_create("RingDeque", MFD_CLOEXEC);
+        if (fd < 0) return false;
+        if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            close(fd);
+            return false;
+        }
+        // reserve 2B of address space, then put the file in both halves
+        void* region = mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        unsigned char* base = static_cast<unsigned char*>(region);
+        bool ok = mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == base &&
+                  mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == base + bytes;
+        close(fd);   // the mappings keep the memory alive
+        if (!ok) {
+            munmap(region, 2 * bytes);
+            return false;
+        }
+        base_ = base;
+        bytes_ = bytes;
+        mirrored_ = true;
+        return true;
+#else
+        (void)minBytes;
+        (void)unit;
+        return false;
+#endif
+    }
+};
+
+} // namespace ringbuffer
+
+template <typename T>
+class RingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "RingDeque copies elements with memcpy");
+
+private:
+    ringbuffer::Buffer buffer_;
+    T* slots_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t head_ = 0;    // slot of the front element
+    std::size_t count_ = 0;
+    bool allowMirror_ = true;
+
+    std::size_t wrap(std::size_t i) const { return i >= capacity_ ? i - capacity_ : i; }
+
+    // Copy the first n elements (front first) to out; one memcpy when mirrored
+    void copyFront(std::size_t n, T* out) const {
+        if (buffer_.mirrored() || head_ + n <= capacity_) {
+            std::memcpy(out, slots_ + head_, n * sizeof(T));
+        } else {
+            std::size_t first = capacity_ - head_;
+            std::memcpy(out, slots_ + head_, first * sizeof(T));
+            std::memcpy(out + first, slots_, (n - first) * sizeof(T));
+        }
+    }
+
+    void grow(std::size_t needed) {
+        std::size_t wanted = std::max<std::size_t>({needed, capacity_ * 2, 16});
+        ringbuffer::Buffer bigger = ringbuffer::Buffer::allocate(wanted * sizeof(T), sizeof(T), allowMirror_);
+        T* slots = reinterpret_cast<T*>(bigger.base());
+        if (count_ != 0) copyFront(count_, slots);
+        buffer_ = std::move(bigger);
+        slots_ = slots;
+        capacity_ = buffer_.bytes() / sizeof(T);
+        head_ = 0;
+    }
+
+public:
+    RingDeque() = default;
+
+    // Start with room for `capacity` elements; mirror = false keeps the
+    // plain heap array even for large buffers
+    explicit RingDeque(std::size_t capacity, bool mirror = true) : allowMirror_(mirror) { reserve(capacity); }
+
+    RingDeque(RingDeque&& other) noexcept { swap(other); }
+    RingDeque& operator=(RingDeque&& other) noexcept {
+        swap(other);
+        return *this;
+    }
+    RingDeque(const RingDeque&) = delete;
+    RingDeque& operator=(const RingDeque&) = delete;
+
+    void swap(RingDeque& other) noexcept {
+        std::swap(buffer_, other.buffer_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(count_, other.count_);
+        std::swap(allowMirror_, other.allowMirror_);
+    }
+
+    bool isEmpty() const { return count_ == 0; }
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return capacity_; }
+    bool isMirrored() const { return buffer_.mirrored(); }
+    void clear() { head_ = count_ = 0; }
+
+    // Room for n elements in total without growing
+    void reserve(std::size_t n) {
+        if (n > capacity_) grow(n);
+    }
+
+    // Payload = live slots; free slots and the object are overhead. A
+    // mirrored buffer takes 2x the ADDRESS space but not 2x the memory.
+    memusage::MemoryUsage memoryUsage() const {
+        std::size_t bytes = buffer_.bytes();
+        memusage::MemoryUsage usage = memusage::arrayUsage<T>(count_, sizeof(*this) + bytes);
+        if (bytes != 0) {
+            if (!buffer_.mirrored()) usage.allocatorSlackBytes = memusage::mallocBlockSize(bytes) - bytes;
+            usage.heapBlocks = 1;
+        }
+        return usage;
+    }
+
+    // ------------------------------------------------------------------------
+    // One element at a time (TemplatedDeque's interface), O(1) amortized
+    // ------------------------------------------------------------------------
+    void insertFront(const T& value) {
+        if (count_ == capacity_) grow(count_ + 1);
+        head_ = head_ == 0 ? capacity_ - 1 : head_ - 1;
+        slots_[head_] = value;
+        count_++;
+    }
+
+    void insertRear(const T& value) {
+        if (count_ == capacity_) grow(count_ + 1);
+        slots_[wrap(head_ + count_)] = value;
+        count_++;
+    }
+
+    T deleteFront() {
+        if (isEmpty()) {
+            throw std::runtime_error("deleteFront() called on empty deque");
+        }
+        T removedValue = slots_[head_];
+        head_ = wrap(head_ + 1);
+        count_--;
+        return removedValue;
+    }
+
+    T deleteRear() {
+        if (isEmpty()) {
+            throw std::runtime_error("deleteRear() called on empty deque");
+        }
+        count_--;
+        return slots_[wrap(head_ + count_)];
+    }
+
+    const T& peekFront() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekFront() called on empty deque");
+        }
+        return slots_[head_];
+    }
+
+    const T& peekRear() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekRear() called on empty deque");
+        }
+        return slots_[wrap(head_ + count_ - 1)];
+    }
+
+    // i-th element from the front (no range check)
+    const T& operator[](std::size_t i) const { return slots_[wrap(head_ + i)]; }
+
+    // ------------------------------------------------------------------------
+    // Bulk operations: memcpy across the wrap point
+    // ------------------------------------------------------------------------
+    // Append n elements at the rear, in order
+    void pushBackBulk(const T* data, std::size_t n) {
+        if (n == 0) return;
+        reserve(count_ + n);
+        std::size_t tail = wrap(head_ + count_);
+        if (buffer_.mirrored() || tail + n <= capacity_) {
+            std::memcpy(slots_ + tail, data, n * sizeof(T));   // runs on into the mirror
+        } else {
+            std::size_t first = capacity_ - tail;
+            std::memcpy(slots_ + tail, data, first * sizeof(T));
+            std::memcpy(slots_, data + first, (n - first) * sizeof(T));
+        }
+        count_ += n;
+    }
+
+    // Remove up to n elements from the front, copying them to out (if not
+    // null). Returns how many were removed.
+    std::size_t popFrontBulk(std::size_t n, T* out) {
+        n = std::min(n, count_);
+        if (out != nullptr && n != 0) copyFront(n, out);
+        head_ = wrap(head_ + n);
+        count_ -= n;
+        if (count_ == 0) head_ = 0;
+        return n;
+    }
+
+#if __cplusplus >= 202002L
+    void pushBackBulk(std::span<const T> data) { pushBackBulk(data.data(), data.size()); }
+
+    std::size_t popFrontBulk(std::size_t n, std::span<T> out) {
+        return popFrontBulk(std::min(n, out.size()), out.data());
+    }
+#endif
+
+    // ------------------------------------------------------------------------
+    // The whole deque, front to rear, as ONE array of size() elements.
+    // Mirrored: free, whatever the wrap. Heap: wrapped contents are rotated
+    // to the start of the array first (O(n) once). Valid until the next
+    // insert or reserve.
+    // ------------------------------------------------------------------------
+    const T* contiguous() {
+        if (!buffer_.mirrored() && head_ + count_ > capacity_) {
+            std::rotate(slots_, slots_ + head_, slots_ + capacity_);
+            head_ = 0;
+        }
+        return slots_ + head_;
+    }
+
+#if __cplusplus >= 202002L
+    std::span<const T> view() { return std::span<const T>(contiguous(), count_); }
+#endif
+};
+
+// The deque to use for T: contiguous ring for trivially copyable types,
+// node-based TemplatedDeque otherwise
+template <typename T>
+using DequeFor = std::conditional_t<std::is_trivially_copyable<T>::value, RingDeque<T>, TemplatedDeque<T>>;
+
+#endif // RING_DEQUE_H
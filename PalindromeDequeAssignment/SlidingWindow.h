@@ -0,0 +1,285 @@
+// Sliding Window Header File
+#ifndef SLIDING_WINDOW_H
+#define SLIDING_WINDOW_H
+
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::less, std::greater
+#include <memory>     // std::unique_ptr
+#include <stdexcept>  // std::runtime_error, std::invalid_argument
+#include <utility>    // std::move
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "../MemoryUsage.h" // memoryUsage() breakdown
+#include "TemplatedDeque.h"
+
+/*
+Sliding-window min / max with a MONOTONIC DEQUE
+
+Problem: a stream of samples arrives one at a time; after each one we want the
+minimum (or maximum) of the last N samples.
+- Naive: keep the last N samples in a deque and scan them => O(N) per sample.
+- Monotonic deque: amortized O(1) per sample.
+
+Idea (shown for the minimum):
+- The deque stores (value, index) entries whose values INCREASE front -> rear.
+- A new sample x first removes every rear entry whose value is >= x: those
+  samples are older AND not smaller, so while x is in the window they can
+  never be the minimum again.
+- x is then appended at the rear.
+- The front entry is the minimum of the window. It is removed once its index
+  slides out of the window.
+
+Every sample is inserted once and removed at most once => O(1) amortized,
+and the deque never holds more than N entries.
+
+Example (window 3):   samples 5 3 4 1 2
+    push 5  deque [5]        min 5
+    push 3  deque [3]        min 3   (5 removed: older and larger)
+    push 4  deque [3 4]      min 3
+    push 1  deque [1]        min 1   (3 and 4 removed)
+    push 2  deque [1 2]      min 1
+
+Ties: an older EQUAL value is removed too, so bestIndex() (argmin / argmax)
+reports the MOST RECENT position of the extreme value in the window.
+
+Storage: the adapter only needs insertRear / deleteFront / deleteRear /
+peekFront / peekRear / isEmpty, so it can sit on:
+- TemplatedDeque (default): one heap node per entry
+- RingWindowDeque (below): one contiguous power-of-two array, no allocation
+  once it has grown to the window size
+*/
+
+namespace window {
+
+// One deque entry: the sample and its position in the stream (0, 1, 2, ...)
+template <typename T>
+struct WindowEntry {
+    T value;
+    std::uint64_t index;
+};
+
+// ----------------------------------------------------------------------------
+// RingWindowDeque: contiguous deque with TemplatedDeque's interface
+//
+// A circular array whose capacity is a power of two, so "wrap around" is a
+// bitwise AND instead of a modulo. It doubles when full (amortized O(1));
+// in a sliding window that only happens until it holds `window` entries.
+// ----------------------------------------------------------------------------
+template <typename T>
+class RingWindowDeque {
+private:
+    std::unique_ptr<T[]> slots_;
+    std::size_t mask_ = 0;  // capacity - 1 (capacity is a power of two)
+    std::size_t head_ = 0;  // slot of the front element
+    std::size_t count_ = 0;
+
+    void grow() {
+        std::size_t capacity = slots_ ? (mask_ + 1) * 2 : 16;
+        std::unique_ptr<T[]> bigger(new T[capacity]);
+        for (std::size_t i = 0; i < count_; i++) {
+            bigger[i] = std::move(slots_[(head_ + i) & mask_]);
+        }
+        slots_ = std::move(bigger);
+        mask_ = capacity - 1;
+        head_ = 0;
+    }
+
+public:
+    RingWindowDeque() = default;
+
+    bool isEmpty() const { return count_ == 0; }
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return slots_ ? mask_ + 1 : 0; }
+    void clear() { head_ = count_ = 0; }
+
+    // Bytes used: live slots are payload, free slots + the object are overhead
+    memusage::MemoryUsage memoryUsage() const {
+        std::size_t bytes = capacity() * sizeof(T);
+        memusage::MemoryUsage usage = memusage::arrayUsage<T>(count_, sizeof(*this) + bytes);
+        if (bytes != 0) {
+            usage.allocatorSlackBytes = memusage::mallocBlockSize(bytes) - bytes;
+            usage.heapBlocks = 1;
+        }
+        return usage;
+    }
+
+    void insertFront(const T& value) {
+        if (count_ == capacity()) grow();
+        head_ = (head_ - 1) & mask_;
+        slots_[head_] = value;
+        count_++;
+    }
+
+    void insertRear(const T& value) {
+        if (count_ == capacity()) grow();
+        slots_[(head_ + count_) & mask_] = value;
+        count_++;
+    }
+
+    T deleteFront() {
+        if (isEmpty()) {
+            throw std::runtime_error("deleteFront() called on empty deque");
+        }
+        T removedValue = std::move(slots_[head_]);
+        head_ = (head_ + 1) & mask_;
+        count_--;
+        return removedValue;
+    }
+
+    T deleteRear() {
+        if (isEmpty()) {
+            throw std::runtime_error("deleteRear() called on empty deque");
+        }
+        count_--;
+        return std::move(slots_[(head_ + count_) & mask_]);
+    }
+
+    const T& peekFront() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekFront() called on empty deque");
+        }
+        return slots_[head_];
+    }
+
+    const T& peekRear() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekRear() called on empty deque");
+        }
+        return slots_[(head_ + count_ - 1) & mask_];
+    }
+};
+
+// ----------------------------------------------------------------------------
+// MonotonicDeque: best (min under std::less, max under std::greater) of the
+// last `window` samples, amortized O(1) per sample.
+//
+// Backend is the deque template that stores the entries (see above).
+// ----------------------------------------------------------------------------
+template <typename T, typename Compare = std::less<T>, template <typename> class Backend = TemplatedDeque>
+class MonotonicDeque {
+private:
+    Backend<WindowEntry<T>> deque_;
+    std::size_t window_;
+    std::uint64_t seen_ = 0; // samples pushed so far = index of the next one
+    Compare comp_;
+
+public:
+    explicit MonotonicDeque(std::size_t window, Compare comp = Compare()) : window_(window), comp_(comp) {
+        if (window == 0) {
+            throw std::invalid_argument("MonotonicDeque: window size must be at least 1");
+        }
+    }
+
+    // Add one sample (amortized O(1))
+    void push(const T& value) {
+        // 1) rear entries that are not better than the new sample can never be the answer again
+        while (!deque_.isEmpty() && !comp_(deque_.peekRear().value, value)) {
+            deque_.deleteRear();
+        }
+        deque_.insertRear(WindowEntry<T>{value, seen_});
+        seen_++;
+
+        // 2) the window moved one step: at most one entry (the oldest) falls out
+        if (deque_.peekFront().index + window_ < seen_) {
+            deque_.deleteFront();
+        }
+    }
+
+    // Push a whole batch. If `out` is given, out[i] = best() right after data[i].
+    void update(const T* data, std::size_t n, T* out = nullptr) {
+        for (std::size_t i = 0; i < n; i++) {
+            push(data[i]);
+            if (out != nullptr) out[i] = deque_.peekFront().value;
+        }
+    }
+
+#if __cplusplus >= 202002L
+    void update(std::span<const T> samples) { update(samples.data(), samples.size()); }
+
+    void update(std::span<const T> samples, std::span<T> out) {
+        if (out.size() < samples.size()) {
+            throw std::invalid_argument("MonotonicDeque::update: output span is shorter than the input");
+        }
+        update(samples.data(), samples.size(), out.data());
+    }
+#endif
+
+    // Min / max of the current window (throws if nothing was pushed yet)
+    const T& best() const { return deque_.peekFront().value; }
+
+    // Stream position of best() (argmin / argmax); the newest one on ties
+    std::uint64_t bestIndex() const { return deque_.peekFront().index; }
+
+    bool isEmpty() const { return deque_.isEmpty(); }
+    std::size_t windowSize() const { return window_; }
+    std::uint64_t count() const { return seen_; }
+    std::size_t entries() const { return deque_.size(); } // <= windowSize()
+
+    // Forget every sample; the next push() has index 0 again
+    void clear() {
+        deque_.clear();
+        seen_ = 0;
+    }
+
+    memusage::MemoryUsage memoryUsage() const {
+        memusage::MemoryUsage usage = deque_.memoryUsage();
+        usage.overheadBytes += sizeof(*this) - sizeof(deque_);
+        return usage;
+    }
+};
+
+template <typename T, template <typename> class Backend = TemplatedDeque>
+using SlidingWindowMin = MonotonicDeque<T, std::less<T>, Backend>;
+
+template <typename T, template <typename> class Backend = TemplatedDeque>
+using SlidingWindowMax = MonotonicDeque<T, std::greater<T>, Backend>;
+
+// ----------------------------------------------------------------------------
+// SlidingWindowMinMax: both extremes of the same window in one pass
+// ----------------------------------------------------------------------------
+template <typename T, template <typename> class Backend = TemplatedDeque>
+class SlidingWindowMinMax {
+private:
+    SlidingWindowMin<T, Backend> min_;
+    SlidingWindowMax<T, Backend> max_;
+
+public:
+    explicit SlidingWindowMinMax(std::size_t window) : min_(window), max_(window) {}
+
+    void push(const T& value) {
+        min_.push(value);
+        max_.push(value);
+    }
+
+    // Push a batch; outMin / outMax (either may be null) receive the window
+    // extremes after every sample
+    void update(const T* data, std::size_t n, T* outMin = nullptr, T* outMax = nullptr) {
+        min_.update(data, n, outMin);
+        max_.update(data, n, outMax);
+    }
+
+#if __cplusplus >= 202002L
+    void update(std::span<const T> samples) { update(samples.data(), samples.size()); }
+#endif
+
+    const T& min() const { return min_.best(); }
+    const T& max() const { return max_.best(); }
+    std::uint64_t argmin() const { return min_.bestIndex(); }
+    std::uint64_t argmax() const { return max_.bestIndex(); }
+
+    bool isEmpty() const { return min_.isEmpty(); }
+    std::size_t windowSize() const { return min_.windowSize(); }
+    std::uint64_t count() const { return min_.count(); }
+
+    void clear() {
+        min_.clear();
+        max_.clear();
+    }
+};
+
+} // namespace window
+
+#endif // SLIDING_WINDOW_H
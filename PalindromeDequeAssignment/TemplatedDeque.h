@@ -2,7 +2,16 @@
 #ifndef TEMPLATED_DEQUE_H
 #define TEMPLATED_DEQUE_H
 
+#include <cstddef>   // for std::size_t
 #include <stdexcept> // for std::runtime_error
+#include <string>
+
+#include "../Instrumentation.h" // DS_COUNT_* hooks (no-ops unless -DDS_INSTRUMENT)
+#include "../ListSnapshot.h"   // on-disk snapshot format (saveSnapshot / loadSnapshot)
+#include "../MemoryUsage.h"    // memoryUsage() breakdown
+#include "../NodeArena.h"      // compact(): nodes moved into one arena
+#include "../NodeIterators.h"  // shared bidirectional node iterator
+#include "../Serialization.h"  // binary format (serialize / deserialize)
 
 /*
 Why a generic (templated) deque matters:
@@ -18,6 +27,13 @@ struct Node {
     Node* next;
     Node* prev;
     explicit Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+
+    // compact() may move nodes into an arena: delete finds out which,
+    // and new refills the arena's holes
+    static void* operator new(std::size_t bytes) { return nodearena::Registry<Node>::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) {
+        nodearena::Registry<Node>::deallocate(p, bytes);
+    }
 };
 
 // Templated Deque class implemented using a doubly linked list
@@ -26,21 +42,61 @@ class TemplatedDeque {
 private:
     Node<T>* front_;
     Node<T>* rear_;
+    std::size_t size_;
+    nodearena::Compactor<Node<T>> compactor_;   // compactStep() progress
 
 public:
-    TemplatedDeque() : front_(nullptr), rear_(nullptr) {}
+    // Bidirectional iterators, front -> rear. rear_ is known, so --end() is O(1).
+    using iterator = BidirectionalNodeIterator<Node<T>, T>;
+    using const_iterator = BidirectionalNodeIterator<const Node<T>, const T>;
+
+    TemplatedDeque() : front_(nullptr), rear_(nullptr), size_(0) {}
 
     ~TemplatedDeque() {
+        clear();
+    }
+
+    // Remove every element (O(n))
+    void clear() {
+        compactor_.abandon();
         while (!isEmpty()) {
             deleteFront();
         }
     }
 
     bool isEmpty() const { return front_ == nullptr; }
+    std::size_t size() const { return size_; }
+
+    // Look at the front / rear element without removing it (O(1))
+    const T& peekFront() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekFront() called on empty deque");
+        }
+        return front_->data;
+    }
+
+    const T& peekRear() const {
+        if (isEmpty()) {
+            throw std::runtime_error("peekRear() called on empty deque");
+        }
+        return rear_->data;
+    }
+
+    // Bytes used: payload, prev/next links, malloc slack, fragmentation (O(n))
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::nodeChainUsage<Node<T>, T>(front_, size_, sizeof(*this));
+    }
+
+    iterator begin() { return iterator(front_, &rear_, true); }
+    iterator end() { return iterator(nullptr, &rear_, true); }
+    const_iterator begin() const { return const_iterator(front_, &rear_, true); }
+    const_iterator end() const { return const_iterator(nullptr, &rear_, true); }
 
     // Insert element at the front (O(1))
     void insertFront(const T& value) {
+        DS_COUNT_OP("TemplatedDeque", "insertFront");
         Node<T>* newNode = new Node<T>(value);
+        DS_COUNT_ALLOC("TemplatedDeque");
         if (isEmpty()) {
             front_ = rear_ = newNode;
         } else {
@@ -48,11 +104,14 @@ public:
             front_->prev = newNode;
             front_ = newNode;
         }
+        size_++;
     }
 
     // Insert element at the rear (O(1))
     void insertRear(const T& value) {
+        DS_COUNT_OP("TemplatedDeque", "insertRear");
         Node<T>* newNode = new Node<T>(value);
+        DS_COUNT_ALLOC("TemplatedDeque");
         if (isEmpty()) {
             front_ = rear_ = newNode;
         } else {
@@ -60,10 +119,12 @@ public:
             rear_->next = newNode;
             rear_ = newNode;
         }
+        size_++;
     }
 
     // Delete element from the front and RETURN it (O(1))
     T deleteFront() {
+        DS_COUNT_OP("TemplatedDeque", "deleteFront");
         if (isEmpty()) {
             throw std::runtime_error("deleteFront() called on empty deque");
         }
@@ -80,11 +141,14 @@ public:
         }
 
         delete temp;
+        DS_COUNT_FREE("TemplatedDeque");
+        size_--;
         return removedValue;
     }
 
     // Delete element from the rear and RETURN it (O(1))
     T deleteRear() {
+        DS_COUNT_OP("TemplatedDeque", "deleteRear");
         if (isEmpty()) {
             throw std::runtime_error("deleteRear() called on empty deque");
         }
@@ -101,8 +165,68 @@ public:
         }
 
         delete temp;
+        DS_COUNT_FREE("TemplatedDeque");
+        size_--;
         return removedValue;
     }
+
+    // Move every node into one arena, front to rear (see NodeArena.h):
+    // a long-lived deque's nodes end up scattered over the heap, and each
+    // hop of a walk becomes a cache (and, when huge, TLB) miss.
+    // compactStep() does the same in slices of at most maxNodes nodes and
+    // returns true when done. Both invalidate iterators.
+    nodearena::CompactReport compact() {
+        DS_COUNT_OP("TemplatedDeque", "compact");
+        nodearena::CompactReport report;
+        report.nodes = size_;
+        report.nsPerNodeBefore = nodearena::traversalNsPerNode(front_, size_);
+        compactor_.abandon();   // a sliced pass in progress starts over
+        while (!compactor_.step(front_, size_, SIZE_MAX, &rear_)) {}
+        report.movedNodes = compactor_.movedNodes();
+        report.nsPerNodeAfter = nodearena::traversalNsPerNode(front_, size_);
+        report.pages = compactor_.obtainedPages();
+        report.numaApplied = compactor_.numaApplied();
+        return report;
+    }
+
+    bool compactStep(std::size_t maxNodes) {
+        DS_COUNT_OP("TemplatedDeque", "compactStep");
+        return compactor_.step(front_, size_, maxNodes, &rear_);
+    }
+
+    // Huge pages / NUMA policy for the arenas of later passes (Linux only)
+    void setArenaBacking(const nodearena::Backing& backing) { compactor_.setBacking(backing); }
+
+    // Write front -> rear to a snapshot file (T must be trivially copyable)
+    void saveSnapshot(const std::string& path) const {
+        snapshot::SnapshotWriter<T> writer(path, snapshot::Kind::TemplatedDeque);
+        for (const Node<T>* cur = front_; cur != nullptr; cur = cur->next) {
+            writer.append(cur->data);
+        }
+        writer.finish();
+    }
+
+    // Replace the contents with a mapped snapshot (one insertRear per element, O(n))
+    void loadSnapshot(const snapshot::SnapshotView<T>& view) {
+        clear();
+        for (const T& value : view) {
+            insertRear(value);
+        }
+    }
+
+    // Binary serialization front -> rear (format in Serialization.h)
+    void serialize(const std::string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        serial::save<T>(path, serial::Kind::TemplatedDeque, begin(), end(), size_, encoding);
+    }
+
+    // Replace the contents; every node is built inside ONE allocation
+    void deserialize(const std::string& path) {
+        serial::Reader<T> in(path);
+        clear();
+        front_ = nodearena::buildChain<Node<T>>(in.size(), [&in] { return in.next(); }, &rear_);
+        size_ = in.size();
+        DS_COUNT_ALLOCS("TemplatedDeque", size_);
+    }
 };
 
 #endif // TEMPLATED_DEQUE_H
@@ -0,0 +1,521 @@
+// Serialization Header File
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // fixed-width header fields
+#include <cstring>     // std::memcpy, std::memcmp
+#include <cstdio>      // std::FILE (portable fallback)
+#include <iterator>    // std::next
+#include <limits>      // std::numeric_limits
+#include <stdexcept>   // std::runtime_error
+#include <string>
+#include <type_traits> // std::is_trivially_copyable, std::is_integral
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>      // errno, EINTR
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <sys/uio.h>   // writev, iovec
+#include <unistd.h>    // write, pwrite, close
+#endif
+
+/*
+Binary serialization: save a container to a file and load it back
+
+Snapshots (ListSnapshot.h) are for mapping a list straight from disk. This
+format is for STORING and SENDING one: smaller, self-describing, and
+readable by any of the containers:
+
+    offset 0    Header (40 bytes, native byte order)
+    offset 40   payloadBytes bytes of elements, in traversal order
+
+Encodings of the payload:
+  Raw          the element bytes, sizeof(T) each (any trivially copyable T)
+  Varint       integers only: LEB128, 7 bits per byte, small numbers take
+               1-2 bytes; signed values are zigzag-mapped first
+               (0, -1, 1, -2 ... -> 0, 1, 2, 3 ...)
+  DeltaVarint  integers only: the first value, then each value minus the
+               one before it, zigzag + LEB128. A sorted list of ids that
+               are close together shrinks to about 1 byte per element.
+  Auto         (when saving) DeltaVarint for an integer list that is
+               sorted, Raw for everything else. Checking the order costs
+               one extra walk of the list.
+
+Raw is written with writev(), 1024 iovecs per system call, pointing at
+the container's own memory where that pays: an array (SimpleQueue) is one
+iovec and is written without a copy, and so are node values of at least
+DIRECT_BYTES. Small node values are copied into a 64 KiB buffer instead:
+an iovec costs the kernel more than copying 4 or 8 bytes. The varint
+encodings produce new bytes and always go through that buffer.
+
+Reading maps the file, checks the header and decodes one value at a time
+(Reader::next); the node lists hand next() to nodearena::buildChain, which
+builds every node inside ONE allocation. A wrong magic, element size,
+truncated payload or count that does not fit throws std::runtime_error.
+*/
+
+namespace serial {
+
+// Which container wrote the file (informational; any container can read it).
+// The first values match snapshot::Kind.
+enum class Kind : std::uint32_t {
+    Unknown = 0,
+    LinkedList = 1,
+    LinkedListImplementation = 2,
+    DoublyLinkedList = 3,
+    CircularLinkedList = 4,
+    TemplatedDeque = 5,
+    StackListImp = 6,
+    SimpleQueue = 7
+};
+
+enum class Encoding : std::uint16_t {
+    Auto = 0,   // only as a request to save(); never stored
+    Raw = 1,
+    Varint = 2,
+    DeltaVarint = 3
+};
+
+const std::size_t DIRECT_BYTES = 256;  // Raw node values at least this big are written in place, not copied
+const std::uint32_t FLAG_SORTED = 1u; // elements are in non-decreasing order (checked by Auto)
+
+struct Header {
+    char          magic[8];     // "DSBIN001"
+    std::uint16_t version;      // format version (currently 1)
+    std::uint16_t encoding;     // serial::Encoding
+    std::uint32_t elementSize;  // sizeof(T) of the writer, checked by the reader
+    std::uint32_t kind;         // serial::Kind of the writer
+    std::uint32_t flags;        // FLAG_* bits
+    std::uint64_t count;        // number of elements
+    std::uint64_t payloadBytes; // bytes after the header
+};
+
+static_assert(sizeof(Header) == 40, "serialization header must stay 40 bytes");
+
+const char MAGIC[8] = {'D', 'S', 'B', 'I', 'N', '0', '0', '1'};
+const std::uint16_t VERSION = 1;
+
+// Integers (not bool) can use the varint encodings
+template <typename T>
+struct IsVarintType
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8> {};
+
+// T <-> 64 bits: signed values are sign-extended, so differences wrap correctly
+template <typename T>
+std::uint64_t toBits(T value) {
+    if constexpr (std::is_signed<T>::value) return static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+    else return static_cast<std::uint64_t>(value);
+}
+
+template <typename T>
+T fromBits(std::uint64_t bits) {
+    if constexpr (std::is_signed<T>::value) return static_cast<T>(static_cast<std::int64_t>(bits));
+    else return static_cast<T>(bits);
+}
+
+inline std::uint64_t zigzag(std::uint64_t bits) {
+    return (bits << 1) ^ (0 - (bits >> 63));
+}
+
+inline std::uint64_t unzigzag(std::uint64_t code) {
+    return (code >> 1) ^ (0 - (code & 1));
+}
+
+// LEB128: returns the number of bytes written (1..10)
+inline std::size_t putVarint(std::uint64_t value, unsigned char* out) {
+    std::size_t n = 0;
+    while (value >= 0x80) {
+        out[n++] = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    out[n++] = static_cast<unsigned char>(value);
+    return n;
+}
+
+// ----------------------------------------------------------------------------
+// Output: a file written with writev (POSIX) or fwrite (elsewhere)
+// ----------------------------------------------------------------------------
+class Output {
+public:
+    explicit Output(const std::string& path) {
+#if !defined(_WIN32)
+        fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) throw std::runtime_error("cannot open for writing: " + path);
+#else
+        file_ = std::fopen(path.c_str(), "wb");
+        if (file_ == nullptr) throw std::runtime_error("cannot open for writing: " + path);
+#endif
+    }
+
+    Output(const Output&) = delete;
+    Output& operator=(const Output&) = delete;
+
+    ~Output() {
+#if !defined(_WIN32)
+        if (fd_ >= 0) ::close(fd_);
+#else
+        if (file_ != nullptr) std::fclose(file_);
+#endif
+    }
+
+    // Queue `bytes` at `data` (which must stay valid until flush); merged
+    // with the previous piece when it continues it
+    void gather(const void* data, std::size_t bytes) {
+        if (count_ != 0) {
+            Piece& last = pieces_[count_ - 1];
+            if (static_cast<const unsigned char*>(last.data) + last.bytes == data) {
+                last.bytes += bytes;
+                return;
+            }
+        }
+        if (count_ == MAX_PIECES) flush();
+        pieces_[count_++] = Piece{data, bytes};
+    }
+
+    // Write every queued piece
+    void flush() {
+#if !defined(_WIN32)
+        iovec vec[MAX_PIECES];
+        for (std::size_t i = 0; i < count_; i++) {
+            vec[i].iov_base = const_cast<void*>(pieces_[i].data);
+            vec[i].iov_len = pieces_[i].bytes;
+        }
+        iovec* first = vec;
+        std::size_t left = count_;
+        while (left != 0) {
+            ssize_t put = ::writev(fd_, first, static_cast<int>(left));
+            if (put < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("serialization write failed");
+            }
+            // skip what was written; a partly written piece is trimmed
+            std::size_t done = static_cast<std::size_t>(put);
+            while (left != 0 && done >= first->iov_len) {
+                done -= first->iov_len;
+                first++;
+                left--;
+            }
+            if (left != 0) {
+                first->iov_base = static_cast<char*>(first->iov_base) + done;
+                first->iov_len -= done;
+            }
+        }
+#else
+        for (std::size_t i = 0; i < count_; i++) {
+            if (std::fwrite(pieces_[i].data, 1, pieces_[i].bytes, file_) != pieces_[i].bytes) {
+                throw std::runtime_error("serialization write failed");
+            }
+        }
+#endif
+        count_ = 0;
+    }
+
+    // Overwrite the header at offset 0 (after the payload has been written)
+    void rewriteHeader(const Header& header) {
+        flush();
+#if !defined(_WIN32)
+        if (::pwrite(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+            throw std::runtime_error("serialization header write failed");
+        }
+#else
+        if (std::fseek(file_, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+            throw std::runtime_error("serialization header write failed");
+        }
+#endif
+    }
+
+    void close() {
+        flush();
+#if !defined(_WIN32)
+        int fd = fd_;
+        fd_ = -1;
+        if (::close(fd) != 0) throw std::runtime_error("serialization close failed");
+#else
+        std::FILE* file = file_;
+        file_ = nullptr;
+        if (std::fclose(file) != 0) throw std::runtime_error("serialization close failed");
+#endif
+    }
+
+private:
+    struct Piece {
+        const void* data;
+        std::size_t bytes;
+    };
+    static const std::size_t MAX_PIECES = 1024;   // IOV_MAX on Linux
+
+#if !defined(_WIN32)
+    int fd_ = -1;
+#else
+    std::FILE* file_ = nullptr;
+#endif
+    Piece pieces_[MAX_PIECES];
+    std::size_t count_ = 0;
+};
+
+// ----------------------------------------------------------------------------
+// save(): write `count` elements from [first, last) (traversal order).
+// The iterators must yield references into the container (node values or
+// array slots), so Raw can point writev straight at them.
+// ----------------------------------------------------------------------------
+template <typename T, typename It>
+void save(const std::string& path, Kind kind, It first, It last, std::size_t count,
+          Encoding encoding = Encoding::Auto) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "binary serialization stores raw element bytes, so T must be trivially copyable");
+
+    std::uint32_t flags = 0;
+    if (encoding == Encoding::Auto) {
+        encoding = Encoding::Raw;
+        if constexpr (IsVarintType<T>::value) {
+            bool sorted = true;
+            if (first != last) {
+                for (It prev = first, it = std::next(first); it != last; prev = it, ++it) {
+                    if (*it < *prev) {
+                        sorted = false;
+                        break;
+                    }
+                }
+            }
+            if (sorted) {
+                encoding = Encoding::DeltaVarint;
+                flags |= FLAG_SORTED;
+            }
+        }
+    }
+    if constexpr (!IsVarintType<T>::value) {
+        if (encoding != Encoding::Raw) throw std::runtime_error("varint encodings need an integer element type");
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.encoding = static_cast<std::uint16_t>(encoding);
+    header.elementSize = static_cast<std::uint32_t>(sizeof(T));
+    header.kind = static_cast<std::uint32_t>(kind);
+    header.flags = flags;
+    header.count = count;
+
+    Output out(path);
+    std::size_t written = 0;
+    const std::size_t BUFFER_BYTES = 1 << 16;
+    std::vector<unsigned char> buffer(BUFFER_BYTES);
+    if (encoding == Encoding::Raw) {
+        header.payloadBytes = static_cast<std::uint64_t>(count) * sizeof(T);
+        out.gather(&header, sizeof(header));
+        if constexpr (std::is_pointer<It>::value) {
+            // an array: one piece, written in place
+            written = static_cast<std::size_t>(last - first);
+            out.gather(first, written * sizeof(T));
+        } else if constexpr (sizeof(T) >= DIRECT_BYTES) {
+            for (; first != last; ++first, ++written) out.gather(&*first, sizeof(T));
+        } else {
+            // Node values are never adjacent, and one small iovec per value
+            // costs the kernel more than copying it: stage them
+            std::size_t used = 0;
+            for (; first != last; ++first, ++written) {
+                if (BUFFER_BYTES - used < sizeof(T)) {
+                    out.gather(buffer.data(), used);
+                    out.flush();
+                    used = 0;
+                }
+                std::memcpy(buffer.data() + used, &*first, sizeof(T));
+                used += sizeof(T);
+            }
+            out.gather(buffer.data(), used);
+        }
+        out.flush();
+    } else if constexpr (IsVarintType<T>::value) {
+        std::size_t used = sizeof(header);   // header placeholder, rewritten below
+        std::uint64_t payload = 0;
+        std::uint64_t previous = 0;
+        bool delta = encoding == Encoding::DeltaVarint;
+        for (; first != last; ++first, ++written) {
+            if (BUFFER_BYTES - used < 10) {
+                out.gather(buffer.data(), used);
+                out.flush();
+                payload += used;
+                used = 0;
+            }
+            std::uint64_t bits = toBits<T>(*first);
+            std::uint64_t code;
+            if (delta) code = zigzag(bits - previous);
+            else code = std::is_signed<T>::value ? zigzag(bits) : bits;
+            previous = bits;
+            used += putVarint(code, buffer.data() + used);
+        }
+        out.gather(buffer.data(), used);
+        out.flush();
+        payload += used;
+        header.payloadBytes = payload - sizeof(header);
+        out.rewriteHeader(header);
+    }
+    if (written != count) throw std::runtime_error("serialization: container size and element count disagree");
+    out.close();
+}
+
+// ----------------------------------------------------------------------------
+// Reader<T>: a serialized file, mapped and checked; values come out one at
+// a time with next(), or in bulk with readInto()
+// ----------------------------------------------------------------------------
+template <typename T>
+class Reader {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "binary serialization stores raw element bytes, so T must be trivially copyable");
+
+private:
+    const unsigned char* base_ = nullptr;   // the mapping (or heap copy)
+    std::size_t length_ = 0;
+    const unsigned char* pos_ = nullptr;    // next payload byte
+    const unsigned char* end_ = nullptr;
+    Header header_;
+    std::size_t read_ = 0;                  // values handed out
+    std::uint64_t previous_ = 0;            // DeltaVarint running value
+
+    void release() noexcept {
+        if (base_ == nullptr) return;
+#if !defined(_WIN32)
+        munmap(const_cast<unsigned char*>(base_), length_);
+#else
+        delete[] base_;
+#endif
+        base_ = nullptr;
+    }
+
+    [[noreturn]] void fail(const char* what) const {
+        throw std::runtime_error(std::string("serialization: ") + what);
+    }
+
+    std::uint64_t getVarint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (pos_ == end_) fail("payload truncated");
+            unsigned char byte = *pos_++;
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        fail("varint longer than 10 bytes");
+    }
+
+    void map(const std::string& path) {
+#if !defined(_WIN32)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("cannot open serialized file: " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+            ::close(fd);
+            throw std::runtime_error("serialized file too small: " + path);
+        }
+        length_ = static_cast<std::size_t>(st.st_size);
+        void* mapping = mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd); // the mapping keeps the file alive
+        if (mapping == MAP_FAILED) throw std::runtime_error("cannot mmap serialized file: " + path);
+        base_ = static_cast<const unsigned char*>(mapping);
+        madvise(mapping, length_, MADV_SEQUENTIAL);
+#else
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (f == nullptr) throw std::runtime_error("cannot open serialized file: " + path);
+        std::fseek(f, 0, SEEK_END);
+        long size = std::ftell(f);
+        std::fseek(f, 0, SEEK_SET);
+        length_ = size > 0 ? static_cast<std::size_t>(size) : 0;
+        unsigned char* buffer = new unsigned char[length_ > 0 ? length_ : 1];
+        std::size_t got = std::fread(buffer, 1, length_, f);
+        std::fclose(f);
+        base_ = buffer;
+        if (got != length_ || length_ < sizeof(Header)) {
+            release();
+            throw std::runtime_error("cannot read serialized file: " + path);
+        }
+#endif
+    }
+
+    void validate(const std::string& path) {
+        std::memcpy(&header_, base_, sizeof(header_));
+        if (std::memcmp(header_.magic, MAGIC, sizeof(MAGIC)) != 0 || header_.version != VERSION) {
+            throw std::runtime_error("not a serialized container: " + path);
+        }
+        if (header_.elementSize != sizeof(T)) {
+            throw std::runtime_error("serialized element size mismatch: " + path);
+        }
+        Encoding encoding = static_cast<Encoding>(header_.encoding);
+        bool varint = encoding == Encoding::Varint || encoding == Encoding::DeltaVarint;
+        if (encoding != Encoding::Raw && !(varint && IsVarintType<T>::value)) {
+            throw std::runtime_error("unsupported serialized encoding: " + path);
+        }
+        if (header_.payloadBytes > length_ - sizeof(Header) ||
+            (encoding == Encoding::Raw &&
+             (header_.payloadBytes % sizeof(T) != 0 || header_.count != header_.payloadBytes / sizeof(T))) ||
+            (varint && header_.count > header_.payloadBytes)) {   // a varint takes at least one byte
+            throw std::runtime_error("serialized file truncated: " + path);
+        }
+        pos_ = base_ + sizeof(Header);
+        end_ = pos_ + header_.payloadBytes;
+    }
+
+public:
+    explicit Reader(const std::string& path) {
+        map(path);
+        try {
+            validate(path);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    ~Reader() { release(); }
+
+    std::size_t size() const { return static_cast<std::size_t>(header_.count); }
+    Kind kind() const { return static_cast<Kind>(header_.kind); }
+    Encoding encoding() const { return static_cast<Encoding>(header_.encoding); }
+    bool isSorted() const { return (header_.flags & FLAG_SORTED) != 0; }
+
+    // The next value in traversal order (size() of them in all)
+    T next() {
+        if (read_ == size()) fail("read past the last element");
+        read_++;
+        T value;
+        switch (encoding()) {
+        case Encoding::Raw:
+            std::memcpy(&value, pos_, sizeof(T));
+            pos_ += sizeof(T);
+            return value;
+        case Encoding::DeltaVarint:
+            if constexpr (IsVarintType<T>::value) {
+                previous_ += unzigzag(getVarint());
+                return fromBits<T>(previous_);
+            }
+            break;
+        default:
+            if constexpr (IsVarintType<T>::value) {
+                std::uint64_t code = getVarint();
+                return fromBits<T>(std::is_signed<T>::value ? unzigzag(code) : code);
+            }
+            break;
+        }
+        fail("unsupported encoding");
+    }
+
+    // The next n values into an array (one memcpy for Raw)
+    void readInto(T* out, std::size_t n) {
+        if (n > size() - read_) fail("read past the last element");
+        if (encoding() == Encoding::Raw) {
+            if (n != 0) std::memcpy(out, pos_, n * sizeof(T));
+            pos_ += n * sizeof(T);
+            read_ += n;
+            return;
+        }
+        for (std::size_t i = 0; i < n; i++) out[i] = next();
+    }
+};
+
+} // namespace serial
+
+#endif // SERIALIZATION_H
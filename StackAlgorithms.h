@@ -0,0 +1,523 @@
+// Stack Algorithms Header File
+#ifndef STACK_ALGORITHMS_H
+#define STACK_ALGORITHMS_H
+
+#include <algorithm>   // std::reverse
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t, std::uint32_t
+#include <cstdlib>     // std::strtod
+#include <cstring>     // std::memcpy
+#include <limits>      // std::numeric_limits
+#include <stdexcept>   // std::invalid_argument, std::length_error
+#include <string>
+#include <type_traits> // std::true_type (capacity detection)
+#include <utility>     // std::pair
+#include <vector>
+
+/*
+Two classic stack algorithms, written ONCE for any of the repo's stacks
+(StackArrayImplementation, StackListImp, ...).
+
+1) expr: compiled arithmetic / filter expressions
+   - compile(): the SHUNTING-YARD algorithm turns "a + b * 2 > c" into a flat
+     RPN ("postfix") program:   a b 2 * + c >
+     Parsing happens ONCE; the program is then run for millions of inputs.
+   - evaluate(): runs the RPN program on a value stack:
+       operand  -> push it
+       operator -> pop its operands, push the result
+     compile() also computes the deepest the stack can get (maxDepth), so a
+     fixed-capacity array stack can be checked up front and never overflows.
+   - evaluateColumns(): one expression over COLUMNS of inputs (a[], b[], ...).
+     Instead of running the program once per row, every instruction runs on
+     a BLOCK of rows at a time; the stack holds pointers to blocks. The
+     interpreter overhead is paid once per block, and each instruction
+     becomes a tight loop the compiler can vectorize.
+
+2) graph: iterative depth-first search over a CSR graph
+   - CSR ("compressed sparse row"): the out-edges of vertex v are
+     targets[offsets[v] .. offsets[v+1]) in ONE array, so walking a vertex's
+     neighbours is a linear scan instead of pointer chasing.
+   - The DFS keeps an explicit stack of (vertex, next edge) frames instead of
+     recursing, so a deep graph cannot overflow the call stack; the stack
+     never holds more than one frame per vertex.
+
+Stack requirements: push(v), pop() returning the value itself (errpolicy::
+Silent / Print / Throw, not ReturnExpected), isEmpty(), size(). A stack with
+a static capacity() (the array stack) is checked before it could overflow.
+*/
+
+namespace stackalgo {
+
+// capacityOf<Stack>(): Stack::capacity() if it has one, else "unbounded"
+template <typename Stack, typename = void>
+struct HasCapacity : std::false_type {};
+
+template <typename Stack>
+struct HasCapacity<Stack, decltype(void(Stack::capacity()))> : std::true_type {};
+
+template <typename Stack>
+constexpr std::size_t capacityOf() {
+    if constexpr (HasCapacity<Stack>::value) {
+        return Stack::capacity();
+    } else {
+        return std::numeric_limits<std::size_t>::max();
+    }
+}
+
+} // namespace stackalgo
+
+// ============================================================================
+// 1) Expressions
+// ============================================================================
+namespace expr {
+
+// Grammar (lowest to highest precedence, all binary operators left-assoc):
+//   ||    &&    == !=    < <= > >=    + -    * /    unary - !    ( )
+// Operands: numbers (strtod syntax) and variable names bound by compile().
+// Booleans are 1.0 / 0.0; any non-zero value counts as true. && and || do
+// NOT short-circuit (both sides are always evaluated).
+enum class Op : std::uint8_t { Const, Var, Neg, Not, Add, Sub, Mul, Div, Lt, Le, Gt, Ge, Eq, Ne, And, Or };
+
+struct Instr {
+    Op op;
+    std::uint32_t arg;   // Const: index into constants, Var: variable index
+};
+
+struct Program {
+    std::vector<Instr> code;          // RPN, executed front to back
+    std::vector<double> constants;
+    std::size_t variableCount = 0;
+    std::size_t maxDepth = 0;         // deepest value stack the program needs
+};
+
+namespace detail {
+
+inline int precedence(Op op) {
+    switch (op) {
+    case Op::Or: return 1;
+    case Op::And: return 2;
+    case Op::Eq: case Op::Ne: return 3;
+    case Op::Lt: case Op::Le: case Op::Gt: case Op::Ge: return 4;
+    case Op::Add: case Op::Sub: return 5;
+    case Op::Mul: case Op::Div: return 6;
+    case Op::Neg: case Op::Not: return 7;
+    default: return 0;
+    }
+}
+
+inline bool isUnary(Op op) { return op == Op::Neg || op == Op::Not; }
+
+inline bool isNameChar(char c, bool first) {
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (!first && c >= '0' && c <= '9');
+}
+
+[[noreturn]] inline void syntaxError(const std::string& what, std::size_t column) {
+    throw std::invalid_argument("expr::compile: " + what + " at column " + std::to_string(column + 1));
+}
+
+// Emit one instruction and track the value-stack depth it leaves behind
+inline void emit(Program& program, std::size_t& depth, Instr instr, std::size_t column) {
+    if (instr.op == Op::Const || instr.op == Op::Var) {
+        depth++;
+    } else {
+        std::size_t operands = isUnary(instr.op) ? 1 : 2;
+        if (depth < operands) syntaxError("missing operand", column);
+        depth -= operands - 1;
+    }
+    if (depth > program.maxDepth) program.maxDepth = depth;
+    program.code.push_back(instr);
+}
+
+} // namespace detail
+
+// ----------------------------------------------------------------------------
+// compile(): shunting-yard, infix text -> RPN program
+//
+//   operand          -> straight to the output
+//   operator o       -> first move every stacked operator that binds at least
+//                       as tightly (strictly tighter for right-assoc unary)
+//                       to the output, then stack o
+//   "("              -> stack it;  ")" -> unstack to the matching "("
+//   end of input     -> unstack everything
+//
+// `variables` names the inputs in order: variables[i] is vars[i] /
+// columns[i] at evaluation time. Throws std::invalid_argument on bad input.
+// ----------------------------------------------------------------------------
+inline Program compile(const std::string& source, const std::vector<std::string>& variables) {
+    struct Pending {
+        Op op;
+        bool paren;       // a "(" marker rather than an operator
+        std::size_t column;
+    };
+
+    Program program;
+    program.variableCount = variables.size();
+    std::vector<Pending> operators;   // the "shunting" stack
+    std::size_t depth = 0;
+    bool expectOperand = true;        // start of input, after an operator or "("
+
+    auto popOperator = [&]() {
+        detail::emit(program, depth, Instr{operators.back().op, 0}, operators.back().column);
+        operators.pop_back();
+    };
+
+    std::size_t i = 0;
+    while (i < source.size()) {
+        char c = source[i];
+        std::size_t column = i;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            i++;
+            continue;
+        }
+
+        if (expectOperand) {
+            if ((c >= '0' && c <= '9') || c == '.') {
+                char* end = nullptr;
+                double value = std::strtod(source.c_str() + i, &end);
+                if (end == source.c_str() + i) detail::syntaxError("bad number", column);
+                i = static_cast<std::size_t>(end - source.c_str());
+                program.constants.push_back(value);
+                detail::emit(program, depth, Instr{Op::Const, static_cast<std::uint32_t>(program.constants.size() - 1)},
+                             column);
+                expectOperand = false;
+            } else if (detail::isNameChar(c, true)) {
+                std::size_t start = i;
+                while (i < source.size() && detail::isNameChar(source[i], false)) i++;
+                std::string name = source.substr(start, i - start);
+                std::size_t index = 0;
+                while (index < variables.size() && variables[index] != name) index++;
+                if (index == variables.size()) detail::syntaxError("unknown variable '" + name + "'", column);
+                detail::emit(program, depth, Instr{Op::Var, static_cast<std::uint32_t>(index)}, column);
+                expectOperand = false;
+            } else if (c == '(') {
+                operators.push_back(Pending{Op::Const, true, column});
+                i++;
+            } else if (c == '-' || c == '!') {
+                // Unary and right-associative: nothing is popped before it
+                operators.push_back(Pending{c == '-' ? Op::Neg : Op::Not, false, column});
+                i++;
+            } else {
+                detail::syntaxError(std::string("expected an operand, found '") + c + "'", column);
+            }
+            continue;
+        }
+
+        if (c == ')') {
+            while (!operators.empty() && !operators.back().paren) popOperator();
+            if (operators.empty()) detail::syntaxError("unmatched ')'", column);
+            operators.pop_back();
+            i++;
+            continue;
+        }
+
+        // A binary operator (one or two characters)
+        Op op;
+        char next = i + 1 < source.size() ? source[i + 1] : '\0';
+        std::size_t length = 1;
+        switch (c) {
+        case '+': op = Op::Add; break;
+        case '-': op = Op::Sub; break;
+        case '*': op = Op::Mul; break;
+        case '/': op = Op::Div; break;
+        case '<': op = next == '=' ? Op::Le : Op::Lt; length = next == '=' ? 2 : 1; break;
+        case '>': op = next == '=' ? Op::Ge : Op::Gt; length = next == '=' ? 2 : 1; break;
+        case '=':
+            if (next != '=') detail::syntaxError("use '==' for equality", column);
+            op = Op::Eq; length = 2; break;
+        case '!':
+            if (next != '=') detail::syntaxError("expected an operator, found '!'", column);
+            op = Op::Ne; length = 2; break;
+        case '&':
+            if (next != '&') detail::syntaxError("use '&&'", column);
+            op = Op::And; length = 2; break;
+        case '|':
+            if (next != '|') detail::syntaxError("use '||'", column);
+            op = Op::Or; length = 2; break;
+        default:
+            detail::syntaxError(std::string("expected an operator, found '") + c + "'", column);
+        }
+        while (!operators.empty() && !operators.back().paren &&
+               detail::precedence(operators.back().op) >= detail::precedence(op)) {
+            popOperator();
+        }
+        operators.push_back(Pending{op, false, column});
+        i += length;
+        expectOperand = true;
+    }
+
+    if (expectOperand) detail::syntaxError("expression ends without an operand", source.size());
+    while (!operators.empty()) {
+        if (operators.back().paren) detail::syntaxError("unmatched '('", operators.back().column);
+        popOperator();
+    }
+    return program;
+}
+
+// Throws std::length_error if the program could overflow Stack
+template <typename Stack>
+void checkCapacity(const Program& program) {
+    if (program.maxDepth > stackalgo::capacityOf<Stack>()) {
+        throw std::length_error("expr: expression needs a deeper stack (" + std::to_string(program.maxDepth) +
+                                " slots) than the stack type provides");
+    }
+}
+
+inline double truth(bool b) { return b ? 1.0 : 0.0; }
+
+// The arithmetic of one binary operator (shared by both evaluators)
+inline double apply(Op op, double a, double b) {
+    switch (op) {
+    case Op::Add: return a + b;
+    case Op::Sub: return a - b;
+    case Op::Mul: return a * b;
+    case Op::Div: return a / b;   // IEEE: x/0 is +-inf, 0/0 is NaN
+    case Op::Lt: return truth(a < b);
+    case Op::Le: return truth(a <= b);
+    case Op::Gt: return truth(a > b);
+    case Op::Ge: return truth(a >= b);
+    case Op::Eq: return truth(a == b);
+    case Op::Ne: return truth(a != b);
+    case Op::And: return truth(a != 0.0 && b != 0.0);
+    case Op::Or: return truth(a != 0.0 || b != 0.0);
+    default: return 0.0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// evaluate(): run the program for ONE row of inputs (vars[0..variableCount))
+//
+// `stack` holds doubles and must start empty (it is empty again afterwards).
+// Call checkCapacity<Stack>(program) once before evaluating in a loop.
+// ----------------------------------------------------------------------------
+template <typename Stack>
+double evaluate(const Program& program, const double* vars, Stack& stack) {
+    for (const Instr& instr : program.code) {
+        switch (instr.op) {
+        case Op::Const: stack.push(program.constants[instr.arg]); break;
+        case Op::Var: stack.push(vars[instr.arg]); break;
+        case Op::Neg: stack.push(-stack.pop()); break;
+        case Op::Not: stack.push(truth(stack.pop() == 0.0)); break;
+        default: {
+            double b = stack.pop();   // right operand is on top
+            double a = stack.pop();
+            stack.push(apply(instr.op, a, b));
+            break;
+        }
+        }
+    }
+    return stack.pop();
+}
+
+// ----------------------------------------------------------------------------
+// evaluateColumns(): out[r] = program(columns[0][r], columns[1][r], ...)
+//
+// Block-at-a-time: `stack` holds `const double*` pointers, each to BLOCK
+// values (an input column slice, a broadcast constant, or a scratch block).
+// An operator writes into the scratch block of the stack slot it leaves its
+// result in, so the scratch space is maxDepth blocks, allocated once.
+// ----------------------------------------------------------------------------
+const std::size_t BLOCK = 256;
+
+namespace detail {
+
+template <typename F>
+inline void unaryBlock(double* dst, const double* a, std::size_t n, F f) {
+    for (std::size_t i = 0; i < n; i++) dst[i] = f(a[i]);
+}
+
+template <typename F>
+inline void binaryBlock(double* dst, const double* a, const double* b, std::size_t n, F f) {
+    for (std::size_t i = 0; i < n; i++) dst[i] = f(a[i], b[i]);
+}
+
+// One operator over a block; the switch is outside the loop so every case
+// is its own simple loop
+inline void applyBlock(Op op, double* dst, const double* a, const double* b, std::size_t n) {
+    switch (op) {
+    case Op::Add: binaryBlock(dst, a, b, n, [](double x, double y) { return x + y; }); break;
+    case Op::Sub: binaryBlock(dst, a, b, n, [](double x, double y) { return x - y; }); break;
+    case Op::Mul: binaryBlock(dst, a, b, n, [](double x, double y) { return x * y; }); break;
+    case Op::Div: binaryBlock(dst, a, b, n, [](double x, double y) { return x / y; }); break;
+    case Op::Lt: binaryBlock(dst, a, b, n, [](double x, double y) { return x < y ? 1.0 : 0.0; }); break;
+    case Op::Le: binaryBlock(dst, a, b, n, [](double x, double y) { return x <= y ? 1.0 : 0.0; }); break;
+    case Op::Gt: binaryBlock(dst, a, b, n, [](double x, double y) { return x > y ? 1.0 : 0.0; }); break;
+    case Op::Ge: binaryBlock(dst, a, b, n, [](double x, double y) { return x >= y ? 1.0 : 0.0; }); break;
+    case Op::Eq: binaryBlock(dst, a, b, n, [](double x, double y) { return x == y ? 1.0 : 0.0; }); break;
+    case Op::Ne: binaryBlock(dst, a, b, n, [](double x, double y) { return x != y ? 1.0 : 0.0; }); break;
+    case Op::And:
+        binaryBlock(dst, a, b, n, [](double x, double y) { return (x != 0.0) & (y != 0.0) ? 1.0 : 0.0; });
+        break;
+    case Op::Or:
+        binaryBlock(dst, a, b, n, [](double x, double y) { return (x != 0.0) | (y != 0.0) ? 1.0 : 0.0; });
+        break;
+    case Op::Neg: unaryBlock(dst, a, n, [](double x) { return -x; }); break;
+    case Op::Not: unaryBlock(dst, a, n, [](double x) { return x == 0.0 ? 1.0 : 0.0; }); break;
+    default: break;
+    }
+}
+
+} // namespace detail
+
+template <typename PointerStack>
+void evaluateColumns(const Program& program, const double* const* columns, std::size_t rows, double* out,
+                     PointerStack& stack) {
+    std::vector<double> scratch(program.maxDepth * BLOCK);
+    std::vector<double> constantBlocks(program.constants.size() * BLOCK);
+    for (std::size_t k = 0; k < program.constants.size(); k++) {
+        for (std::size_t i = 0; i < BLOCK; i++) constantBlocks[k * BLOCK + i] = program.constants[k];
+    }
+
+    for (std::size_t row = 0; row < rows; row += BLOCK) {
+        std::size_t n = rows - row < BLOCK ? rows - row : BLOCK;
+        for (const Instr& instr : program.code) {
+            if (instr.op == Op::Const) {
+                stack.push(&constantBlocks[instr.arg * BLOCK]);
+            } else if (instr.op == Op::Var) {
+                stack.push(columns[instr.arg] + row);
+            } else {
+                const double* b = detail::isUnary(instr.op) ? nullptr : stack.pop();
+                const double* a = stack.pop();
+                double* dst = &scratch[stack.size() * BLOCK];   // slot the result will occupy
+                detail::applyBlock(instr.op, dst, a, b, n);
+                stack.push(dst);
+            }
+        }
+        const double* result = stack.pop();
+        std::memcpy(out + row, result, n * sizeof(double));
+    }
+}
+
+} // namespace expr
+
+// ============================================================================
+// 2) Depth-first search and topological sort over a CSR graph
+// ============================================================================
+namespace graph {
+
+struct CsrGraph {
+    std::vector<std::uint32_t> offsets;   // vertexCount() + 1 entries
+    std::vector<std::uint32_t> targets;   // one entry per edge
+
+    std::size_t vertexCount() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    std::size_t edgeCount() const { return targets.size(); }
+
+    // Build from an edge list with a counting sort (O(V + E)); edges of a
+    // vertex keep their input order
+    static CsrGraph fromEdges(std::size_t vertices, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& edges) {
+        CsrGraph g;
+        g.offsets.assign(vertices + 1, 0);
+        for (const auto& e : edges) {
+            if (e.first >= vertices || e.second >= vertices) {
+                throw std::invalid_argument("CsrGraph::fromEdges: vertex out of range");
+            }
+            g.offsets[e.first + 1]++;
+        }
+        for (std::size_t v = 0; v < vertices; v++) g.offsets[v + 1] += g.offsets[v];
+        g.targets.resize(edges.size());
+        std::vector<std::uint32_t> cursor(g.offsets.begin(), g.offsets.end() - 1);
+        for (const auto& e : edges) g.targets[cursor[e.first]++] = e.second;
+        return g;
+    }
+};
+
+// One DFS stack entry: the vertex and the next of its edges to explore
+struct DfsFrame {
+    std::uint32_t vertex;
+    std::uint32_t nextEdge;
+};
+
+namespace detail {
+
+template <typename Stack>
+void pushFrame(Stack& stack, DfsFrame frame) {
+    if (stack.size() >= stackalgo::capacityOf<Stack>()) {
+        throw std::length_error("graph: DFS stack capacity exceeded");
+    }
+    stack.push(frame);
+}
+
+} // namespace detail
+
+// ----------------------------------------------------------------------------
+// depthFirstOrder(): vertices reachable from `start`, in DFS preorder (the
+// order a recursive DFS would visit them). Vertices already marked in
+// `visited` are skipped, so repeated calls can cover a whole graph.
+// `stack` holds DfsFrame and must start empty.
+// ----------------------------------------------------------------------------
+template <typename Stack>
+void depthFirstOrder(const CsrGraph& g, std::uint32_t start, Stack& stack, std::vector<bool>& visited,
+                     std::vector<std::uint32_t>& order) {
+    if (visited[start]) return;
+    visited[start] = true;
+    order.push_back(start);
+    detail::pushFrame(stack, DfsFrame{start, g.offsets[start]});
+
+    while (!stack.isEmpty()) {
+        DfsFrame frame = stack.pop();
+        if (frame.nextEdge == g.offsets[frame.vertex + 1]) continue;   // all edges done: backtrack
+
+        std::uint32_t next = g.targets[frame.nextEdge++];
+        stack.push(frame);   // re-push the frame we just popped: always fits
+        if (!visited[next]) {
+            visited[next] = true;
+            order.push_back(next);
+            detail::pushFrame(stack, DfsFrame{next, g.offsets[next]});
+        }
+    }
+}
+
+template <typename Stack>
+std::vector<std::uint32_t> depthFirstOrder(const CsrGraph& g, std::uint32_t start, Stack& stack) {
+    std::vector<bool> visited(g.vertexCount(), false);
+    std::vector<std::uint32_t> order;
+    depthFirstOrder(g, start, stack, visited, order);
+    return order;
+}
+
+// ----------------------------------------------------------------------------
+// topologicalSort(): order with every edge u -> v having u before v.
+// Returns false (and leaves `order` unspecified) if the graph has a cycle.
+//
+// DFS with three colours: white = not seen, grey = on the stack, black =
+// finished. Reaching a grey vertex means a back edge, i.e. a cycle. Vertices
+// are emitted when they finish; reversing that gives the topological order.
+// ----------------------------------------------------------------------------
+template <typename Stack>
+bool topologicalSort(const CsrGraph& g, Stack& stack, std::vector<std::uint32_t>& order) {
+    enum Colour : std::uint8_t { White, Grey, Black };
+    std::size_t vertices = g.vertexCount();
+    std::vector<std::uint8_t> colour(vertices, White);
+    order.clear();
+    order.reserve(vertices);
+
+    for (std::uint32_t root = 0; root < vertices; root++) {
+        if (colour[root] != White) continue;
+        colour[root] = Grey;
+        detail::pushFrame(stack, DfsFrame{root, g.offsets[root]});
+
+        while (!stack.isEmpty()) {
+            DfsFrame frame = stack.pop();
+            if (frame.nextEdge == g.offsets[frame.vertex + 1]) {
+                colour[frame.vertex] = Black;
+                order.push_back(frame.vertex);
+                continue;
+            }
+            std::uint32_t next = g.targets[frame.nextEdge++];
+            stack.push(frame);
+            if (colour[next] == Grey) {
+                while (!stack.isEmpty()) stack.pop();   // leave the stack empty for the caller
+                return false;
+            }
+            if (colour[next] == White) {
+                colour[next] = Grey;
+                detail::pushFrame(stack, DfsFrame{next, g.offsets[next]});
+            }
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return true;
+}
+
+} // namespace graph
+
+#endif // STACK_ALGORITHMS_H
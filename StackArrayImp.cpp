@@ -1,66 +1,155 @@
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <type_traits>
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "StackAlgorithms.h" // expr:: compiled expressions, graph:: DFS (demo below)
 using namespace std;
 
-#define MAX 25   // Maximum size of the stack
-
+#define MAX 25   // Default maximum size of the stack
+
+// T           element type (int by default; any copyable type works)
+// Capacity    number of slots, fixed at compile time (default MAX)
+// ErrorPolicy decides how "full" / "empty" are reported (see ErrorPolicy.h).
+//             The default (Print) keeps the original messages on cout;
+//             errpolicy::Silent removes all I/O so push/pop can run in tight loops.
+//
+// With a non-printing policy every core operation is constexpr, so a stack
+// can be filled and read inside a constant expression (see the demo below).
+template <typename T = int, std::size_t Capacity = MAX, typename ErrorPolicy = errpolicy::Print>
 class StackArrayImplementation {
+    static_assert(Capacity > 0, "a stack needs at least one slot");
+    static_assert(Capacity <= static_cast<std::size_t>(INT_MAX), "top is an int index");
+
 private:
-    int ArrayStack[MAX];   // Fixed-size array
-    int top;               // Index of top element
+    T ArrayStack[Capacity];   // Fixed-size array
+    int top;                  // Index of top element
 
 public:
     // Constructor
-    StackArrayImplementation() {
-        top = -1;  // Stack is empty initially
-    }
+    constexpr StackArrayImplementation() : ArrayStack{}, top(-1) {}  // Stack is empty initially
+
+    static constexpr std::size_t capacity() { return Capacity; }
+    constexpr std::size_t size() const { return static_cast<std::size_t>(top + 1); }
 
     // Push an element onto the stack
-    void push(int value) {
-        if (top == MAX - 1) {
-            cout << "Stack is full. Cannot add more elements!" << endl;
+    constexpr typename ErrorPolicy::status_type push(const T& value) {
+        if (top == static_cast<int>(Capacity) - 1) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is full. Cannot add more elements!" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "StackArrayImplementation::push: stack is full");
         } else {
             top++;
             ArrayStack[top] = value;
-            cout << "Added " << value << " to the stack." << endl;
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Added " << value << " to the stack." << endl;
+            }
+            return ErrorPolicy::ok();
         }
     }
 
     // Pop an element from the stack
-    int pop() {
+    constexpr typename ErrorPolicy::template result<T> pop() {
         if (top == -1) {
-            cout << "Stack is empty. Nothing to pop!" << endl;
-            return -1; // Return a sentinel value for empty stack
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty. Nothing to pop!" << endl;
+            }
+            // Return a sentinel value for empty stack (or whatever the policy does)
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "StackArrayImplementation::pop: stack is empty",
+                                          errpolicy::sentinel<T>());
         } else {
-            int poppedValue = ArrayStack[top];
+            T poppedValue = ArrayStack[top];
             top--;
-            cout << "Removed " << poppedValue << " from the stack." << endl;
-            return poppedValue;
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Removed " << poppedValue << " from the stack." << endl;
+            }
+            return ErrorPolicy::value(poppedValue);
         }
     }
 
-    // Peek the top element
-    void peek() {
-        if (top == -1) {
-            cout << "Stack is empty. No top element." << endl;
+    // Bulk push: all n values or none. Trivially copyable T is copied with
+    // one memcpy instead of n separate pushes.
+    typename ErrorPolicy::status_type pushBulk(const T* values, std::size_t n) {
+        if (n > Capacity - size()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is full. Cannot add " << n << " elements!" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "StackArrayImplementation::pushBulk: not enough room");
+        }
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n != 0) std::memcpy(&ArrayStack[top + 1], values, n * sizeof(T));
         } else {
-            cout << "Top element: " << ArrayStack[top] << endl;
+            std::copy(values, values + n, &ArrayStack[top + 1]);
         }
+        top += static_cast<int>(n);
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Added " << n << " elements to the stack." << endl;
+        }
+        return ErrorPolicy::ok();
     }
 
-    int peek() const {
+    // Bulk pop: removes the top n values. `out` receives them bottom-to-top
+    // (the order they were pushed), so pushBulk(out, n) would restore them.
+    typename ErrorPolicy::status_type popBulk(T* out, std::size_t n) {
+        if (n > size()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack has fewer than " << n << " elements. Nothing popped!" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Underflow, "StackArrayImplementation::popBulk: not enough elements");
+        }
+        const T* first = &ArrayStack[top + 1 - static_cast<int>(n)];
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n != 0) std::memcpy(out, first, n * sizeof(T));
+        } else {
+            std::copy(first, first + n, out);
+        }
+        top -= static_cast<int>(n);
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Removed " << n << " elements from the stack." << endl;
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // Peek the top element (an empty stack is reported through ErrorPolicy)
+    constexpr typename ErrorPolicy::template result<T> peek() const {
         if (top == -1) {
-            cout << "Stack is empty. No top element." << endl;
-            return -1; // Return a sentinel value for empty stack
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty. No top element." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "StackArrayImplementation::peek: stack is empty",
+                                          errpolicy::sentinel<T>());
         } else {
-            return ArrayStack[top];
+            return ErrorPolicy::value(ArrayStack[top]);
         }
     }
 
     // Check if stack is empty
-    bool isEmpty() const {
+    constexpr bool isEmpty() const {
         return top == -1;
     }
 
+    constexpr bool isFull() const {
+        return top == static_cast<int>(Capacity) - 1;
+    }
+
+    // Memory footprint: the whole array lives inside the object, so all
+    // Capacity slots are paid for even when the stack is nearly empty
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::arrayUsage<T>(size(), sizeof(*this));
+    }
+
+    // The values through a buffered writer (fastio::Writer, FastIO.h), one
+    // per line, BOTTOM to top: the order pushBulk / fastio::appendAll would
+    // push them back in (display() prints top first)
+    template <typename Out>
+    void writeTo(Out& out) const {
+        out.writeValues(ArrayStack, size());
+    }
+
     // Display stack elements
     void display() {
         if (top == -1) {
@@ -76,7 +165,24 @@ public:
     }
 };
 
+// A stack built and emptied entirely at compile time
+constexpr int compileTimeStackSum() {
+    StackArrayImplementation<int, 8, errpolicy::Silent> s;
+    for (int i = 1; i <= 8; i++) s.push(i);
+    s.push(99);                       // full: rejected, returns false
+    int sum = 0;
+    while (!s.isEmpty()) sum += s.pop();
+    return sum;
+}
+static_assert(compileTimeStackSum() == 36, "constexpr push/pop");
+
 // Main function
+// (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+#ifndef DS_NO_DEMO_MAIN
+struct Key16 {   // a 16-byte trivially copyable key
+    unsigned long long hi, lo;
+};
+
 int main() {
     StackArrayImplementation s;
 
@@ -85,7 +191,7 @@ int main() {
     s.push(30);
 
     s.display();
-    s.peek();
+    cout << "Top element: " << s.peek() << endl;
 
     s.pop();
 
@@ -97,5 +203,47 @@ int main() {
 
     s.display();
 
+    // Same stack with a different error policy: no printing at all,
+    // errors come back inside the return value instead
+    StackArrayImplementation<int, MAX, errpolicy::ReturnExpected> quiet;
+    quiet.push(5);
+    auto first = quiet.pop();    // holds 5
+    auto second = quiet.pop();   // holds Error::Underflow
+    cout << "Expected pop: " << *first << ", then "
+         << (second ? "a value" : errpolicy::toString(second.error())) << endl;
+
+    // Other element types: 16-byte keys moved in bulk with memcpy
+    StackArrayImplementation<Key16, 64, errpolicy::Silent> keys;
+    Key16 batch[3] = {{1, 2}, {3, 4}, {5, 6}};
+    keys.pushBulk(batch, 3);
+    Key16 topKey = keys.pop();
+    cout << "Key16 stack: size " << keys.size() << ", popped {" << topKey.hi << ", " << topKey.lo << "}" << endl;
+
+    // Compiled expression: parsed ONCE into RPN, then run on an array stack
+    expr::Program rule = expr::compile("(price - cost) / price > 0.25 && qty >= 10", {"price", "cost", "qty"});
+    expr::checkCapacity<StackArrayImplementation<double, 16, errpolicy::Silent>>(rule);
+    StackArrayImplementation<double, 16, errpolicy::Silent> values;
+    double row[3] = {40.0, 28.0, 12.0};
+    cout << "RPN program: " << rule.code.size() << " instructions, stack depth " << rule.maxDepth
+         << "; margin rule on {40, 28, 12}: " << expr::evaluate(rule, row, values) << endl;
+
+    // ... or over whole columns, a block of rows per instruction
+    double price[4] = {40, 40, 10, 100}, cost[4] = {28, 35, 5, 50}, qty[4] = {12, 12, 3, 10};
+    const double* columns[3] = {price, cost, qty};
+    double passed[4];
+    StackArrayImplementation<const double*, 16, errpolicy::Silent> blocks;
+    expr::evaluateColumns(rule, columns, 4, passed, blocks);
+    cout << "Column results: " << passed[0] << " " << passed[1] << " " << passed[2] << " " << passed[3] << endl;
+
+    // Iterative DFS / topological sort over a CSR graph, same array stack
+    graph::CsrGraph tasks = graph::CsrGraph::fromEdges(5, {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}});
+    StackArrayImplementation<graph::DfsFrame, 16, errpolicy::Silent> frames;
+    vector<uint32_t> order;
+    graph::topologicalSort(tasks, frames, order);
+    cout << "Topological order:";
+    for (uint32_t v : order) cout << " " << v;
+    cout << endl;
+
     return 0;
-}
\ No newline at end of file
+}
+#endif // DS_NO_DEMO_MAIN
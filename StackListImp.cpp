@@ -1,5 +1,16 @@
+#include <cstddef>      // std::size_t
 #include <iostream>     // std::cout, std::endl  (I/O utilities)
 #include <stdexcept>    // std::underflow_error  (optional: safer error handling)
+#if __cplusplus >= 202002L
+#include <ranges>       // std::ranges::forward_range (concept check below)
+#endif
+
+#include "ErrorPolicy.h"     // errpolicy::Print / Silent / Throw / ReturnExpected / Callback
+#include "Instrumentation.h" // DS_COUNT_* hooks (active only with -DDS_INSTRUMENT)
+#include "MemoryUsage.h"    // memusage::MemoryUsage footprint breakdown
+#include "NodeArena.h"      // buildChain: every node of deserialize() in one block
+#include "NodeIterators.h" // NodeIterator: shared forward iterator over node chains
+#include "Serialization.h"  // serial::save / serial::Reader binary format
 
 // -----------------------------------------------------------------------------
 // STUDY NOTE: "using namespace std;"
@@ -12,15 +23,16 @@ using namespace std;
 // 1) Node: the building block of the linked list
 // ----------------------------------------------------------------------------
 // Each node stores:
-//   - data: the integer payload
+//   - data: the payload (type T; int unless you pick another type)
 //   - next: pointer to the next node (toward the bottom of the stack)
 //
 // VISUAL MODEL (top at left):
 //    top --> [data|next] --> [data|next] --> [data|nullptr]
 // ============================================================================
 
+template <typename T>
 struct Node {
-    int data;     // payload value stored in this node
+    T data;       // payload value stored in this node
     Node* next;   // link to next node in the chain (nullptr means "end")
 
     // ------------------------------------------------------------------------
@@ -37,7 +49,14 @@ struct Node {
     // - Converts to any pointer type safely; better than NULL/0 in many contexts.
     //   (cppreference, n.d.). [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
     // ------------------------------------------------------------------------
-    explicit Node(int val) : data(val), next(nullptr) {}
+    explicit Node(const T& val) : data(val), next(nullptr) {}
+
+    // deserialize() builds the nodes inside one arena: delete finds out which,
+    // and new refills the arena's holes (NodeArena.h)
+    static void* operator new(std::size_t bytes) { return nodearena::Registry<Node>::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) {
+        nodearena::Registry<Node>::deallocate(p, bytes);
+    }
 };
 
 // ============================================================================
@@ -65,11 +84,24 @@ struct Node {
 // - Modern guidance encourages safer ownership patterns and careful resource
 //   management to avoid leaks/dangling pointers. (Stroustrup & Sutter, 2025). [4](https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines)
 //
+// ERROR POLICY (template parameter, see ErrorPolicy.h):
+// - Decides what pop()/peek() do on an empty stack.
+// - errpolicy::Print (default): print "Stack is empty." and return -1, as before.
+// - errpolicy::Silent: just return -1 (no I/O compiled in at all).
+// - errpolicy::Throw: throw std::underflow_error (the "safer API" noted below).
+// - errpolicy::ReturnExpected: return Expected<T> holding Error::Underflow.
+//
+// ELEMENT TYPE:
+// - StackListImp<> stores ints; StackListImp<std::string> (or any copyable T)
+//   works the same way. The sentinel for non-numeric T is a default T{}.
+//
 // ============================================================================
 
+template <typename T = int, typename ErrorPolicy = errpolicy::Print>
 class StackListImp {
 private:
-    Node* top; // points to the top node; nullptr means "empty stack" [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
+    Node<T>* top; // points to the top node; nullptr means "empty stack" [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
+    std::size_t count; // number of nodes, so size() is O(1)
 
     // ------------------------------------------------------------------------
     // clear(): helper used by destructor and move assignment
@@ -85,19 +117,30 @@ private:
     // ------------------------------------------------------------------------
     void clear() noexcept {
         while (top != nullptr) {            // nullptr is a null pointer literal [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
-            Node* temp = top;               // hold current node
+            Node<T>* temp = top;            // hold current node
             top = top->next;                // advance first
             delete temp;                    // free node memory (matches new) [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
+            DS_COUNT_FREE("StackListImp");
         }
+        count = 0;
     }
 
 public:
+    // ------------------------------------------------------------------------
+    // Iterators: walk from the TOP of the stack down to the bottom.
+    //
+    // - Forward only (nodes only point "down").
+    // - Lets <algorithm> / range-for inspect the stack without popping it.
+    // ------------------------------------------------------------------------
+    using iterator = NodeIterator<Node<T>, T>;
+    using const_iterator = NodeIterator<const Node<T>, const T>;
+
     // ------------------------------------------------------------------------
     // Constructor: start with an empty stack
     // Member initializer list initializes `top` to nullptr before body runs.
     // (cppreference, n.d.). [1](https://tcs.rwth-aachen.de/docs/cpp/reference/en.cppreference.com/w/cpp/language/initializer_list.html)
     // ------------------------------------------------------------------------
-    StackListImp() : top(nullptr) {}
+    StackListImp() : top(nullptr), count(0) {}
 
     // ------------------------------------------------------------------------
     // RULE OF THREE / FIVE SAFETY:
@@ -120,8 +163,9 @@ public:
     // This is part of thinking through the "Rule of Five" when managing
     // resources manually. (cppreference, n.d.). [3](https://en.cppreference.com/w/cpp/language/rule_of_three.html)
     // ------------------------------------------------------------------------
-    StackListImp(StackListImp&& other) noexcept : top(other.top) {
+    StackListImp(StackListImp&& other) noexcept : top(other.top), count(other.count) {
         other.top = nullptr; // leave moved-from object in safe empty state [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
+        other.count = 0;
     }
 
     // Move assignment: clear current nodes, then steal other's nodes.
@@ -129,7 +173,9 @@ public:
         if (this != &other) {
             clear();             // free current resources first [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
             top = other.top;
+            count = other.count;
             other.top = nullptr; // prevent double delete [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
+            other.count = 0;
         }
         return *this;
     }
@@ -146,10 +192,13 @@ public:
     // - Memory allocated with new persists until delete is called.
     // - Forgetting delete => memory leak. (LearnCpp, 2025). [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
     // ------------------------------------------------------------------------
-    void push(int val) {
-        Node* newNode = new Node(val); // allocate & construct node [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
+    void push(const T& val) {
+        DS_COUNT_OP("StackListImp", "push");
+        Node<T>* newNode = new Node<T>(val); // allocate & construct node [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
+        DS_COUNT_ALLOC("StackListImp");
         newNode->next = top;           // link new node to current top
         top = newNode;                // new node becomes the new top
+        count++;
     }
 
     // ------------------------------------------------------------------------
@@ -164,19 +213,24 @@ public:
     // Underflow check:
     // - If top is nullptr, stack is empty. (cppreference, n.d.). [5](https://en.cppreference.com/w/cpp/language/nullptr.html)
     // ------------------------------------------------------------------------
-    int pop() {
+    typename ErrorPolicy::template result<T> pop() {
+        DS_COUNT_OP("StackListImp", "pop");
         if (top == nullptr) {
-            cout << "Stack is empty." << endl;
-            return -1; // original sentinel error value (see note above)
-            // Alternative (safer API):
-            // throw std::underflow_error("pop on empty stack");
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty." << endl;
+            }
+            // original sentinel error value (see note above);
+            // errpolicy::Throw gives the safer API: throw std::underflow_error
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "StackListImp::pop: stack is empty", errpolicy::sentinel<T>());
         }
 
-        int val = top->data;      // capture data to return
-        Node* temp = top;         // node to remove
+        T val = top->data;      // capture data to return
+        Node<T>* temp = top;      // node to remove
         top = top->next;          // move top down
         delete temp;              // free removed node to avoid leak [2](https://www.learncpp.com/cpp-tutorial/dynamic-memory-allocation-with-new-and-delete/)
-        return val;
+        DS_COUNT_FREE("StackListImp");
+        count--;
+        return ErrorPolicy::value(val);
     }
 
     // ------------------------------------------------------------------------
@@ -185,14 +239,16 @@ public:
     // This method is useful for debugging and typical stack APIs.
     // It is const because it doesn't modify the stack.
     // ------------------------------------------------------------------------
-    int peek() const {
+    typename ErrorPolicy::template result<T> peek() const {
         if (top == nullptr) {
-            // In a real API, prefer exceptions or optional.
-            // We'll print and return sentinel to stay consistent with your pop().
-            cout << "Stack is empty." << endl;
-            return -1;
+            // Same reporting as pop(): the policy picks print / sentinel /
+            // exception / Expected (see ErrorPolicy.h).
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "StackListImp::peek: stack is empty", errpolicy::sentinel<T>());
         }
-        return top->data;
+        return ErrorPolicy::value(top->data);
     }
 
     // ------------------------------------------------------------------------
@@ -203,6 +259,48 @@ public:
         return top == nullptr;
     }
 
+    // ------------------------------------------------------------------------
+    // size(): O(1) thanks to the running count
+    // begin()/end(): top -> bottom traversal (end() is the nullptr past the bottom)
+    // ------------------------------------------------------------------------
+    std::size_t size() const { return count; }
+
+    // ------------------------------------------------------------------------
+    // memoryUsage(): where the bytes go (payload, node links, malloc slack)
+    //
+    // Every push allocates one 16-byte node (int + pointer + padding), and
+    // the allocator rounds each one up to its smallest chunk, so a stack of
+    // ints costs several times its payload. O(n): walks the nodes once.
+    // ------------------------------------------------------------------------
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::nodeChainUsage<Node<T>, T>(top, count, sizeof(*this));
+    }
+
+    iterator begin() { return iterator(top); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(top); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    // ------------------------------------------------------------------------
+    // serialize(path) / deserialize(path): binary save and load (Serialization.h)
+    //
+    // Values are stored top -> bottom, so loading rebuilds the same stack
+    // without reversing anything. deserialize() replaces the contents and
+    // builds every node inside ONE allocation (NodeArena.h buildChain)
+    // instead of one `new` per push.
+    // ------------------------------------------------------------------------
+    void serialize(const string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        serial::save<T>(path, serial::Kind::StackListImp, begin(), end(), count, encoding);
+    }
+
+    void deserialize(const string& path) {
+        serial::Reader<T> in(path);
+        clear();
+        top = nodearena::buildChain<Node<T>>(in.size(), [&in] { return in.next(); });
+        count = in.size();
+        DS_COUNT_ALLOCS("StackListImp", count);
+    }
+
     // ------------------------------------------------------------------------
     // Destructor: frees all nodes
     //
@@ -217,6 +315,11 @@ public:
     }
 };
 
+#if __cplusplus >= 202002L
+static_assert(std::ranges::forward_range<StackListImp<>>);
+static_assert(std::ranges::sized_range<StackListImp<>>);
+#endif
+
 
 // ============================================================================
 // (Optional) Minimal test harness
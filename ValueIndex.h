@@ -0,0 +1,212 @@
+// Value Index Header File
+#ifndef VALUE_INDEX_H
+#define VALUE_INDEX_H
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <functional>   // std::hash
+#include <type_traits>
+#include <utility>      // std::declval, std::swap
+#include <vector>
+
+/*
+A side index for lists keyed by unique values (a "linked hash map").
+
+searchAndInsert(x, y) and deleteNode(x) spend all their time FINDING x: a
+walk from head, one cache miss per node. With an index value -> node the
+list keeps its order (the links do not change) and the walk becomes one
+hash lookup, O(1) on average.
+
+The table: open addressing with Robin Hood hashing.
+  - one flat array, no per-entry allocation (std::unordered_map allocates a
+    node per entry and chases a pointer per lookup)
+  - each entry remembers its distance from its home slot; an insert that
+    meets an entry closer to home than itself swaps with it ("take from the
+    rich"), so all probe sequences stay short, even at 80% full
+  - a lookup stops as soon as it meets an entry closer to home than the
+    key would be: misses are short too
+  - erase shifts the following entries back one step (no tombstones)
+
+An entry is 16 bytes whatever T is: the slot (a node pointer, or for a
+singly linked list the address of the pointer that leads to the node), the
+32-bit hash and the probe distance. The key itself is NOT copied: it is
+read through the slot (KeyOf) when the hashes match. Capacity is a power
+of two kept at most 80% full, so the index costs 20-40 bytes per element.
+
+Values must be unique while a list is indexed; the list switches the index
+off when a duplicate arrives (it keeps working with the linear scan).
+*/
+
+namespace valueindex {
+
+// std::hash<T> exists and is usable
+template <typename T, typename = void>
+struct IsHashable : std::false_type {};
+template <typename T>
+struct IsHashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>> : std::true_type {};
+
+// std::hash<int> is the identity: spread the bits before taking the low ones
+template <typename T>
+inline std::uint32_t hashOf(const T& key) {
+    if constexpr (IsHashable<T>::value) {
+        std::uint64_t x = static_cast<std::uint64_t>(std::hash<T>{}(key));
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::uint32_t>(x);
+    } else {
+        (void)key;
+        return 0;   // never used: lists refuse to index such a T
+    }
+}
+
+// KeyOf for an index of node pointers
+template <typename NodeT>
+struct NodeKey {
+    const auto& operator()(NodeT* node) const { return node->data; }
+};
+
+// KeyOf for an index of links (the `next` field, or `head`, pointing at the node)
+template <typename NodeT>
+struct LinkKey {
+    const auto& operator()(NodeT** link) const { return (*link)->data; }
+};
+
+template <typename T, typename Slot, typename KeyOf>
+class RobinHoodIndex {
+public:
+    // Pointer to the slot stored for key (so it can be changed), or nullptr
+    Slot* find(const T& key) {
+        std::size_t pos = locate(key, hashOf(key));
+        return pos == NOT_FOUND ? nullptr : &entries_[pos].slot;
+    }
+
+    // Add key -> slot. False (and nothing changed) if key is already there.
+    bool insert(const T& key, Slot slot) {
+        std::uint32_t hash = hashOf(key);
+        if (locate(key, hash) != NOT_FOUND) return false;
+        if ((count_ + 1) * 5 > entries_.size() * 4) grow(entries_.empty() ? 16 : entries_.size() * 2);
+        place(Entry{slot, hash, 1});
+        count_++;
+        return true;
+    }
+
+    // The entry for key that holds `from` holds `to` instead (the node was
+    // moved). Matched on the slot, not through KeyOf: `from` may no longer
+    // hold the value. False if no such entry.
+    bool repoint(const T& key, Slot from, Slot to) {
+        if (count_ == 0) return false;
+        std::uint32_t hash = hashOf(key);
+        std::size_t pos = hash & mask_;
+        for (std::uint32_t dist = 1;; dist++) {
+            Entry& e = entries_[pos];
+            if (e.dist < dist) return false;
+            if (e.hash == hash && e.slot == from) {
+                e.slot = to;
+                return true;
+            }
+            pos = (pos + 1) & mask_;
+        }
+    }
+
+    bool erase(const T& key) {
+        std::size_t pos = locate(key, hashOf(key));
+        if (pos == NOT_FOUND) return false;
+        // backward shift: pull the following run one step closer to home
+        std::size_t next = (pos + 1) & mask_;
+        while (entries_[next].dist > 1) {
+            entries_[pos] = entries_[next];
+            entries_[pos].dist--;
+            pos = next;
+            next = (next + 1) & mask_;
+        }
+        entries_[pos].dist = 0;
+        count_--;
+        return true;
+    }
+
+    // Forget every entry, keep the table (the list was cleared)
+    void clear() {
+        for (Entry& e : entries_) e.dist = 0;
+        count_ = 0;
+    }
+
+    // Forget every entry and give the memory back (index switched off)
+    void release() {
+        std::vector<Entry>().swap(entries_);
+        count_ = 0;
+        mask_ = 0;
+    }
+
+    // Room for n entries without growing (used before a bulk rebuild)
+    void reserve(std::size_t n) {
+        std::size_t capacity = 16;
+        while (n * 5 > capacity * 4) capacity *= 2;
+        if (capacity > entries_.size()) grow(capacity);
+    }
+
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return entries_.size(); }
+    std::size_t bytes() const { return entries_.capacity() * sizeof(Entry); }
+
+    // Average number of entries a successful lookup inspects
+    double averageProbeLength() const {
+        std::size_t total = 0;
+        for (const Entry& e : entries_) total += e.dist;
+        return count_ == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(count_);
+    }
+
+private:
+    struct Entry {
+        Slot slot;
+        std::uint32_t hash;
+        std::uint32_t dist;   // 0 = empty, else 1 + distance from the home slot
+    };
+
+    static const std::size_t NOT_FOUND = ~std::size_t(0);
+
+    std::vector<Entry> entries_;
+    std::size_t count_ = 0;
+    std::size_t mask_ = 0;
+
+    std::size_t locate(const T& key, std::uint32_t hash) const {
+        if (count_ == 0) return NOT_FOUND;
+        std::size_t pos = hash & mask_;
+        for (std::uint32_t dist = 1;; dist++) {
+            const Entry& e = entries_[pos];
+            if (e.dist < dist) return NOT_FOUND;   // empty, or the key would have been placed here
+            if (e.hash == hash && KeyOf{}(e.slot) == key) return pos;
+            pos = (pos + 1) & mask_;
+        }
+    }
+
+    void place(Entry entry) {
+        std::size_t pos = entry.hash & mask_;
+        for (;;) {
+            Entry& e = entries_[pos];
+            if (e.dist == 0) {
+                e = entry;
+                return;
+            }
+            if (e.dist < entry.dist) std::swap(e, entry);   // take from the rich
+            pos = (pos + 1) & mask_;
+            entry.dist++;
+        }
+    }
+
+    // Rehash from the stored hashes: no key is read, no node is touched
+    void grow(std::size_t capacity) {
+        std::vector<Entry> old(capacity, Entry{Slot(), 0, 0});
+        old.swap(entries_);
+        mask_ = capacity - 1;
+        for (const Entry& e : old) {
+            if (e.dist != 0) place(Entry{e.slot, e.hash, 1});
+        }
+    }
+};
+
+} // namespace valueindex
+
+#endif // VALUE_INDEX_H
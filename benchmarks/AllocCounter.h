@@ -0,0 +1,78 @@
+// Allocation Counter Header File
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#if defined(__GLIBC__)
+#include <malloc.h> // malloc_usable_size
+#endif
+
+/*
+Counts every heap allocation made through operator new / delete.
+
+This header REPLACES the global operator new and delete, so include it in
+exactly ONE translation unit per program (the benchmark's .cpp file).
+Counters are atomic so multi-threaded benchmarks stay correct.
+
+  bench::allocCount()   number of operator new calls so far
+  bench::freeCount()    number of operator delete calls so far
+  bench::liveHeapBytes() bytes currently held through operator new, as the
+                        allocator sees them (malloc_usable_size, so size-class
+                        rounding is included). glibc only: stays 0 elsewhere.
+*/
+
+namespace bench {
+
+inline std::atomic<std::size_t>& allocCounter() {
+    static std::atomic<std::size_t> counter(0);
+    return counter;
+}
+
+inline std::atomic<std::size_t>& freeCounter() {
+    static std::atomic<std::size_t> counter(0);
+    return counter;
+}
+
+inline std::atomic<std::size_t>& liveBytesCounter() {
+    static std::atomic<std::size_t> counter(0);
+    return counter;
+}
+
+inline std::size_t allocCount() { return allocCounter().load(std::memory_order_relaxed); }
+inline std::size_t freeCount() { return freeCounter().load(std::memory_order_relaxed); }
+inline std::size_t liveHeapBytes() { return liveBytesCounter().load(std::memory_order_relaxed); }
+
+inline void* countedMalloc(std::size_t size) {
+    allocCounter().fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) throw std::bad_alloc();
+#if defined(__GLIBC__)
+    liveBytesCounter().fetch_add(malloc_usable_size(p), std::memory_order_relaxed);
+#endif
+    return p;
+}
+
+inline void countedFree(void* p) {
+    if (p == nullptr) return;
+    freeCounter().fetch_add(1, std::memory_order_relaxed);
+#if defined(__GLIBC__)
+    liveBytesCounter().fetch_sub(malloc_usable_size(p), std::memory_order_relaxed);
+#endif
+    std::free(p);
+}
+
+} // namespace bench
+
+void* operator new(std::size_t size) { return bench::countedMalloc(size); }
+void* operator new[](std::size_t size) { return bench::countedMalloc(size); }
+
+void operator delete(void* p) noexcept { bench::countedFree(p); }
+void operator delete[](void* p) noexcept { bench::countedFree(p); }
+
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { operator delete[](p); }
+
+#endif // ALLOC_COUNTER_H
@@ -0,0 +1,203 @@
+// Benchmark Helpers Header File
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+/*
+Shared helpers for the programs in benchmarks/.
+
+How the benchmarks reach the containers:
+- Every container lives in its own .cpp file together with a demo main().
+- A benchmark defines DS_NO_DEMO_MAIN and #includes those .cpp files, each
+  inside its own namespace, because several files define a `Node` type.
+- Standard headers and the repository's own headers (everything that is
+  not a container .cpp) are included HERE, at global scope, before any
+  container file. Their include guards then turn the containers' own
+  #include lines into no-ops, so no header ends up inside a namespace.
+  => If a container starts using a new header, add it below too; the
+     benchmark files themselves only include BenchCommon.h.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <deque>
+#include <forward_list>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <random>
+#include <stack>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#include <span>
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h> // compressedList.cpp's bit-unpacking kernels
+#endif
+
+#if defined(__linux__)
+#include <sys/resource.h> // getrusage (peak RSS fallback)
+#endif
+
+#include "../ChainPrefetch.h"
+#include "../EpochReclaim.h"
+#include "../ErrorPolicy.h"
+#include "../FastIO.h"
+#include "../Instrumentation.h"
+#include "../ListSetOps.h"
+#include "../ListSnapshot.h"
+#include "../ListSort.h"
+#include "../MemoryUsage.h"
+#include "../NodeArena.h"
+#include "../NodeIterators.h"
+#include "../Serialization.h"
+#include "../StackAlgorithms.h"
+#include "../ValueIndex.h"
+#include "../PalindromeDequeAssignment/RingDeque.h"
+#include "../PalindromeDequeAssignment/SlidingWindow.h"
+#include "../PalindromeDequeAssignment/TemplatedDeque.h"
+
+namespace bench {
+
+// ----------------------------------------------------------------------------
+// Stopwatch: wall-clock timer (steady_clock never jumps backwards)
+// ----------------------------------------------------------------------------
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    void restart() { start_ = std::chrono::steady_clock::now(); }
+
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+// ----------------------------------------------------------------------------
+// doNotOptimize: make the compiler believe `value` is used, so a benchmark
+// loop whose result is otherwise ignored is not deleted by the optimizer.
+// ----------------------------------------------------------------------------
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// Fixed-seed input data, so every run (and every container) sees the same values
+// ----------------------------------------------------------------------------
+const std::uint32_t DEFAULT_SEED = 20240229u;
+
+inline std::vector<int> randomValues(std::size_t n, std::uint32_t seed = DEFAULT_SEED,
+                                     int lo = 0, int hi = 1000000000) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(lo, hi);
+    std::vector<int> values(n);
+    for (int& v : values) v = dist(rng);
+    return values;
+}
+
+// Read argv[index] as a count, or return `fallback` when it is missing.
+inline std::size_t sizeArg(int argc, char** argv, int index, std::size_t fallback) {
+    if (argc > index) return static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10));
+    return fallback;
+}
+
+// One result line: label, element count, total time, time per element.
+inline void report(const std::string& label, std::size_t n, double seconds) {
+    std::printf("%-34s n=%-11zu %10.2f ms %9.2f ns/elem\n",
+                label.c_str(), n, seconds * 1e3, n ? seconds * 1e9 / static_cast<double>(n) : 0.0);
+}
+
+// ----------------------------------------------------------------------------
+// Peak resident set size (RSS)
+//
+// Linux keeps the high-water mark in /proc/self/status (VmHWM) and lets a
+// process reset it by writing "5" to /proc/self/clear_refs, so each
+// benchmark can report ITS OWN peak instead of the peak of the whole run.
+// Elsewhere (or if /proc is unavailable) we fall back to getrusage, which
+// only reports the process-wide peak so far.
+// ----------------------------------------------------------------------------
+inline void resetPeakRss() {
+#if defined(__linux__)
+    if (std::FILE* f = std::fopen("/proc/self/clear_refs", "w")) {
+        std::fputs("5", f);
+        std::fclose(f);
+    }
+#endif
+}
+
+inline long peakRssKb() {
+#if defined(__linux__)
+    if (std::FILE* f = std::fopen("/proc/self/status", "r")) {
+        char line[256];
+        long kb = -1;
+        while (std::fgets(line, sizeof(line), f) != nullptr) {
+            if (std::strncmp(line, "VmHWM:", 6) == 0) {
+                kb = std::strtol(line + 6, nullptr, 10);
+                break;
+            }
+        }
+        std::fclose(f);
+        if (kb >= 0) return kb;
+    }
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) return usage.ru_maxrss;
+#endif
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+// QuietStdout: while alive, std::cout writes into a buffer that discards
+// everything. Formatting still happens (so its cost is still measured), but
+// nothing reaches the terminal. Used for containers that print on every call.
+// ----------------------------------------------------------------------------
+class QuietStdout {
+public:
+    QuietStdout() : previous_(std::cout.rdbuf(&discard_)) {}
+    ~QuietStdout() { std::cout.rdbuf(previous_); }
+
+    QuietStdout(const QuietStdout&) = delete;
+    QuietStdout& operator=(const QuietStdout&) = delete;
+
+private:
+    class DiscardBuffer : public std::streambuf {
+    protected:
+        int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+
+    DiscardBuffer   discard_;
+    std::streambuf* previous_;
+};
+
+} // namespace bench
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,473 @@
+// ============================================================================
+// benchmarkSuite.cpp — every container vs. its standard-library equivalent
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/benchmarkSuite.cpp -o benchmarkSuite
+// Run:
+//   ./benchmarkSuite [scale] > results.json      (scale defaults to 1.0)
+//
+// Output: one JSON document on stdout (progress goes to stderr):
+//   { "seed": ..., "scale": ..., "results": [ {
+//       "container": "LinkedList", "equivalent": "std::forward_list<int>",
+//       "workload": "search", "n": 100000, "ops": 2000,
+//       "ns_per_op": ..., "ops_per_s": ..., "allocs_per_op": ...,
+//       "peak_rss_kb": ... }, ... ] }
+//
+// Workloads (every input comes from bench::randomValues with a fixed seed):
+//   churn            push/pop (or enqueue/dequeue) in short rounds
+//   append-build     build a container of n elements by appending at the end
+//   search           look up `ops` values (half present, half absent)
+//   positional       insert at a random position, then delete at a random position
+//
+// Containers without the needed operation are simply not run for that
+// workload (LinkedList and CircularLinkedList have no removal, so no churn).
+// Containers that print on every call run with std::cout discarded
+// (bench::QuietStdout), so their numbers include formatting but not terminal I/O.
+// Several hand-written lists append in O(n) per call, so append-build uses a
+// smaller n than the O(1) workloads.
+//
+// Built with -DDS_INSTRUMENT, every result also carries an "instrumentation"
+// object (see Instrumentation.h): op counts, node allocations/frees and
+// traversal-length histograms recorded inside the timed window only.
+// Add DS_PERF_REGIONS='*' to the environment for hardware counters as well.
+// ============================================================================
+
+#include "BenchCommon.h"
+#include "AllocCounter.h"
+
+#define DS_NO_DEMO_MAIN
+namespace arraystack {
+#include "../StackArrayImp.cpp"
+}
+namespace liststack {
+#include "../StackListImp.cpp"
+}
+namespace simplequeue {
+#include "../simpleQueueImp.cpp"
+}
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+namespace circular {
+#include "../CircularList.cpp"
+}
+
+namespace {
+
+// ----------------------------------------------------------------------------
+// Measurement plumbing
+// ----------------------------------------------------------------------------
+struct Result {
+    std::string container;
+    std::string equivalent;
+    std::string workload;
+    std::size_t n;
+    std::size_t ops;
+    double      seconds;
+    std::size_t allocs;
+    long        peakRssKb;
+    std::string instrumentation;   // JSON from instr::toJson, empty unless DS_INSTRUMENT
+};
+
+std::vector<Result> results;
+
+// Probe: the workload lambda does its setup, then brackets the timed part
+// with start()/stop(). Allocations are counted only inside that window.
+class Probe {
+public:
+    void start() {
+#if defined(DS_INSTRUMENT)
+        instr::resetAll();
+#endif
+        allocsAtStart_ = bench::allocCount();
+        watch_.restart();
+    }
+    void stop() {
+        seconds_ = watch_.seconds();
+        allocs_ = bench::allocCount() - allocsAtStart_;
+#if defined(DS_INSTRUMENT)
+        instrumentation_ = instr::toJson(instr::takeSnapshot());
+#endif
+    }
+    double seconds() const { return seconds_; }
+    std::size_t allocs() const { return allocs_; }
+    const std::string& instrumentation() const { return instrumentation_; }
+
+private:
+    bench::Stopwatch watch_;
+    std::size_t allocsAtStart_ = 0;
+    std::size_t allocs_ = 0;
+    double seconds_ = 0.0;
+    std::string instrumentation_;
+};
+
+template <typename Fn>
+void measure(const char* container, const char* equivalent, const char* workload,
+             std::size_t n, std::size_t ops, Fn fn) {
+    std::fprintf(stderr, "%-26s %-13s n=%zu\n", container, workload, n);
+    bench::resetPeakRss();
+    Probe probe;
+    fn(probe);
+    results.push_back(Result{container, equivalent, workload, n, ops,
+                             probe.seconds(), probe.allocs(), bench::peakRssKb(),
+                             probe.instrumentation()});
+}
+
+void printJson(double scale) {
+    std::printf("{\n  \"seed\": %u,\n  \"scale\": %g,\n  \"results\": [\n", bench::DEFAULT_SEED, scale);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        double ops = static_cast<double>(r.ops);
+        std::printf("    {\"container\": \"%s\", \"equivalent\": \"%s\", \"workload\": \"%s\", "
+                    "\"n\": %zu, \"ops\": %zu, \"ns_per_op\": %.2f, \"ops_per_s\": %.0f, "
+                    "\"allocs_per_op\": %.3f, \"peak_rss_kb\": %ld%s%s}%s\n",
+                    r.container.c_str(), r.equivalent.c_str(), r.workload.c_str(),
+                    r.n, r.ops, r.seconds * 1e9 / ops, ops / r.seconds,
+                    static_cast<double>(r.allocs) / ops, r.peakRssKb,
+                    r.instrumentation.empty() ? "" : ", \"instrumentation\": ",
+                    r.instrumentation.c_str(),
+                    i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+}
+
+std::size_t scaled(std::size_t base, double scale) {
+    return std::max<std::size_t>(1, static_cast<std::size_t>(std::llround(base * scale)));
+}
+
+// ----------------------------------------------------------------------------
+// Workload: churn (push/pop in rounds of `depth`)
+// ----------------------------------------------------------------------------
+void churn(std::size_t ops) {
+    const std::vector<int> values = bench::randomValues(64);
+    const std::size_t STACK_DEPTH = 20;   // StackArrayImplementation holds MAX = 25
+    const std::size_t QUEUE_DEPTH = 10;   // SimpleQueue holds MAX_SIZE = 10 (linear, not reusable)
+    std::size_t stackRounds = ops / (2 * STACK_DEPTH);
+    std::size_t queueRounds = ops / (2 * QUEUE_DEPTH);
+
+    measure("StackArrayImplementation", "std::stack<int>", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                bench::QuietStdout quiet;
+                arraystack::StackArrayImplementation s;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) s.push(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) sum += s.pop();
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    measure("StackListImp", "std::stack<int>", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                liststack::StackListImp s;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) s.push(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) sum += s.pop();
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    measure("std::stack<int>", "-", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                std::stack<int> s;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) s.push(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) {
+                        sum += s.top();
+                        s.pop();
+                    }
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    // SimpleQueue is a LINEAR queue: once rear reaches the end it stays full,
+    // so every round starts from a fresh queue (construction is just two ints).
+    measure("SimpleQueue", "std::deque<int>", "churn", QUEUE_DEPTH, queueRounds * 2 * QUEUE_DEPTH,
+            [&](Probe& probe) {
+                bench::QuietStdout quiet;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < queueRounds; r++) {
+                    simplequeue::SimpleQueue q;
+                    for (std::size_t i = 0; i < QUEUE_DEPTH; i++) q.enqueue(values[i]);
+                    for (std::size_t i = 0; i < QUEUE_DEPTH; i++) sum += q.dequeue();
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    measure("TemplatedDeque", "std::deque<int>", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                TemplatedDeque<int> d;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) d.insertRear(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) sum += d.deleteFront();
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    measure("std::deque<int>", "-", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                std::deque<int> d;
+                long sum = 0;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) d.push_back(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) {
+                        sum += d.front();
+                        d.pop_front();
+                    }
+                }
+                probe.stop();
+                bench::doNotOptimize(sum);
+            });
+
+    measure("DoublyLinkedList", "std::list<int>", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                doubly::DoublyLinkedList l;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) l.insertAtFront(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) l.deleteFromBeginning();
+                }
+                probe.stop();
+                bench::doNotOptimize(l.size());
+            });
+
+    measure("std::list<int>", "-", "churn", STACK_DEPTH, stackRounds * 2 * STACK_DEPTH,
+            [&](Probe& probe) {
+                std::list<int> l;
+                probe.start();
+                for (std::size_t r = 0; r < stackRounds; r++) {
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) l.push_front(values[i]);
+                    for (std::size_t i = 0; i < STACK_DEPTH; i++) l.pop_front();
+                }
+                probe.stop();
+                bench::doNotOptimize(l.size());
+            });
+}
+
+// ----------------------------------------------------------------------------
+// Workload: append-build (n appends at the end)
+// ----------------------------------------------------------------------------
+void appendBuild(std::size_t n) {
+    const std::vector<int> values = bench::randomValues(n);
+
+    measure("LinkedList", "std::forward_list<int>", "append-build", n, n, [&](Probe& probe) {
+        singly::LinkedList l;
+        probe.start();
+        for (int v : values) l.insertAtEnd(v);
+        probe.stop();
+    });
+
+    measure("std::forward_list<int>", "-", "append-build", n, n, [&](Probe& probe) {
+        std::forward_list<int> l;
+        probe.start();
+        auto tail = l.before_begin();
+        for (int v : values) tail = l.insert_after(tail, v);
+        probe.stop();
+    });
+
+    measure("DoublyLinkedList", "std::list<int>", "append-build", n, n, [&](Probe& probe) {
+        doubly::DoublyLinkedList l;
+        probe.start();
+        for (int v : values) l.insertAtPosition(static_cast<int>(l.size()) + 1, v);
+        probe.stop();
+    });
+
+    measure("CircularLinkedList", "std::list<int>", "append-build", n, n, [&](Probe& probe) {
+        circular::CircularLinkedList l;
+        probe.start();
+        for (int v : values) l.insertNode(v);
+        probe.stop();
+    });
+
+    measure("std::list<int>", "-", "append-build", n, n, [&](Probe& probe) {
+        std::list<int> l;
+        probe.start();
+        for (int v : values) l.push_back(v);
+        probe.stop();
+    });
+
+    measure("StackListImp", "std::stack<int>", "append-build", n, n, [&](Probe& probe) {
+        liststack::StackListImp s;
+        probe.start();
+        for (int v : values) s.push(v);
+        probe.stop();
+    });
+
+    measure("std::stack<int>", "-", "append-build", n, n, [&](Probe& probe) {
+        std::stack<int> s;
+        probe.start();
+        for (int v : values) s.push(v);
+        probe.stop();
+    });
+
+    measure("TemplatedDeque", "std::deque<int>", "append-build", n, n, [&](Probe& probe) {
+        TemplatedDeque<int> d;
+        probe.start();
+        for (int v : values) d.insertRear(v);
+        probe.stop();
+    });
+
+    measure("std::deque<int>", "-", "append-build", n, n, [&](Probe& probe) {
+        std::deque<int> d;
+        probe.start();
+        for (int v : values) d.push_back(v);
+        probe.stop();
+    });
+}
+
+// ----------------------------------------------------------------------------
+// Workload: search (`queries` lookups in a container of n elements)
+// ----------------------------------------------------------------------------
+void search(std::size_t n, std::size_t queries) {
+    const std::vector<int> values = bench::randomValues(n, bench::DEFAULT_SEED, 0, 1 << 30);
+    std::vector<int> keys(queries);
+    std::mt19937 rng(bench::DEFAULT_SEED + 1);
+    for (std::size_t i = 0; i < queries; i++) {
+        // even queries hit an existing value, odd ones miss (values are < 2^30)
+        keys[i] = (i % 2 == 0) ? values[rng() % n] : static_cast<int>((1u << 30) + i);
+    }
+
+    // CircularLinkedList::insertNode is O(n), so the ring is filled from a snapshot
+    const std::string snapPath = "benchmarkSuite.snap";
+    {
+        snapshot::SnapshotWriter<int> writer(snapPath, snapshot::Kind::Unknown);
+        for (int v : values) writer.append(v);
+        writer.finish();
+    }
+    snapshot::SnapshotView<int> view(snapPath);
+
+    measure("LinkedList", "std::forward_list<int>", "search", n, queries, [&](Probe& probe) {
+        singly::LinkedList l;
+        l.loadSnapshot(view);
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += l.searchNode(k) ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("std::forward_list<int>", "-", "search", n, queries, [&](Probe& probe) {
+        std::forward_list<int> l(values.begin(), values.end());
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(l.begin(), l.end(), k) != l.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("DoublyLinkedList", "std::list<int>", "search", n, queries, [&](Probe& probe) {
+        doubly::DoublyLinkedList l;
+        l.loadSnapshot(view);
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(l.begin(), l.end(), k) != l.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("CircularLinkedList", "std::list<int>", "search", n, queries, [&](Probe& probe) {
+        circular::CircularLinkedList l;
+        l.loadSnapshot(view);
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(l.begin(), l.end(), k) != l.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("std::list<int>", "-", "search", n, queries, [&](Probe& probe) {
+        std::list<int> l(values.begin(), values.end());
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(l.begin(), l.end(), k) != l.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("TemplatedDeque", "std::deque<int>", "search", n, queries, [&](Probe& probe) {
+        TemplatedDeque<int> d;
+        d.loadSnapshot(view);
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(d.begin(), d.end(), k) != d.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    measure("std::deque<int>", "-", "search", n, queries, [&](Probe& probe) {
+        std::deque<int> d(values.begin(), values.end());
+        std::size_t hits = 0;
+        probe.start();
+        for (int k : keys) hits += std::find(d.begin(), d.end(), k) != d.end() ? 1 : 0;
+        probe.stop();
+        bench::doNotOptimize(hits);
+    });
+
+    std::remove(snapPath.c_str());
+}
+
+// ----------------------------------------------------------------------------
+// Workload: positional insert/delete (1-based positions, like DoublyLinkedList)
+// ----------------------------------------------------------------------------
+void positional(std::size_t n, std::size_t rounds) {
+    const std::vector<int> values = bench::randomValues(n);
+    std::vector<std::size_t> insertAt(rounds), deleteAt(rounds);
+    std::mt19937 rng(bench::DEFAULT_SEED + 2);
+    for (std::size_t i = 0; i < rounds; i++) {
+        insertAt[i] = 1 + rng() % (n + 1);   // list has n elements before the insert
+        deleteAt[i] = 1 + rng() % (n + 1);   // and n + 1 before the delete
+    }
+
+    measure("DoublyLinkedList", "std::list<int>", "positional", n, 2 * rounds, [&](Probe& probe) {
+        doubly::DoublyLinkedList l;
+        for (std::size_t i = n; i-- > 0;) l.insertAtFront(values[i]);
+        probe.start();
+        for (std::size_t i = 0; i < rounds; i++) {
+            l.insertAtPosition(static_cast<int>(insertAt[i]), values[i % n]);
+            l.deleteAtPosition(static_cast<int>(deleteAt[i]));
+        }
+        probe.stop();
+    });
+
+    measure("std::list<int>", "-", "positional", n, 2 * rounds, [&](Probe& probe) {
+        std::list<int> l(values.begin(), values.end());
+        probe.start();
+        for (std::size_t i = 0; i < rounds; i++) {
+            l.insert(std::next(l.begin(), static_cast<long>(insertAt[i] - 1)), values[i % n]);
+            l.erase(std::next(l.begin(), static_cast<long>(deleteAt[i] - 1)));
+        }
+        probe.stop();
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double scale = (argc > 1) ? std::atof(argv[1]) : 1.0;
+    if (scale <= 0.0) scale = 1.0;
+
+    churn(scaled(2000000, scale));
+    appendBuild(scaled(20000, scale));
+    search(scaled(100000, scale), scaled(2000, scale));
+    positional(scaled(10000, scale), scaled(10000, scale));
+
+    printJson(scale);
+    return 0;
+}
@@ -0,0 +1,141 @@
+// ============================================================================
+// compactBenchmark.cpp — traversal speed of scattered vs compacted lists
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/compactBenchmark.cpp -o compactBenchmark
+// Run:
+//   ./compactBenchmark [elements] [slice]         (defaults: 1000000, 4096)
+//
+// For LinkedList and DoublyLinkedList:
+//   fresh        built front to back: malloc hands out neighbouring blocks,
+//                so the walk runs through memory in order
+//   scattered    the same values in the same order, but the nodes were
+//                linked in random order (random inserts + sort()), as after
+//                a long run of insertAtPosition / deleteByValue churn
+//   compact()    one pass; reports one walk before and after (ns/node)
+//   compactStep  the same pass in slices of `slice` nodes on a fresh
+//                scattered list, with an insert at the front between
+//                slices; reports the slice count and the LONGEST slice,
+//                i.e. the worst pause the list's user sees
+//
+// Walk times are the best of 5 walks summing the values (ns per node), with
+// MemoryUsage::fragmentation (share of links that jump) next to them.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+
+namespace {
+
+using Singly = singly::LinkedList<int>;
+using Doubly = doubly::DoublyLinkedList<int>;
+
+void pushFront(Singly& list, int v) { list.insertAtBeggining(v); }
+void pushFront(Doubly& list, int v) { list.insertAtFront(v); }
+
+template <typename List>
+std::unique_ptr<List> freshList(const std::vector<int>& sorted) {
+    auto list = std::make_unique<List>();
+    for (std::size_t i = sorted.size(); i-- > 0;) pushFront(*list, sorted[i]);
+    return list;
+}
+
+// Same contents as freshList(), but every link jumps
+template <typename List>
+std::unique_ptr<List> scatteredList(const std::vector<int>& values) {
+    auto list = std::make_unique<List>();
+    for (int v : values) pushFront(*list, v);
+    list->sort();
+    return list;
+}
+
+template <typename List>
+double walkNs(const List& list) {
+    double best = 1e300;
+    long long sum = 0;
+    for (int round = 0; round < 5; round++) {
+        bench::Stopwatch watch;
+        for (int v : list) sum += v;
+        best = std::min(best, watch.seconds());
+    }
+    bench::doNotOptimize(sum);
+    return best * 1e9 / static_cast<double>(std::max<std::size_t>(list.size(), 1));
+}
+
+template <typename List>
+void walkLine(const char* label, const List& list) {
+    std::printf("  %-30s %8.2f ns/node   fragmentation %.3f\n", label, walkNs(list),
+                list.memoryUsage().fragmentation);
+}
+
+template <typename List>
+void benchList(const char* name, const std::vector<int>& values, const std::vector<int>& sorted,
+               std::size_t slice) {
+    std::printf("-- %s, %zu nodes\n", name, values.size());
+    {
+        auto list = freshList<List>(sorted);
+        walkLine("fresh", *list);
+    }
+    {
+        auto list = scatteredList<List>(values);
+        walkLine("scattered", *list);
+        bench::Stopwatch watch;
+        nodearena::CompactReport report = list->compact();
+        double seconds = watch.seconds();
+        std::printf("  %-30s %8.1f ms   walk %.2f -> %.2f ns/node (x%.1f), %zu nodes moved\n", "compact()",
+                    seconds * 1e3, report.nsPerNodeBefore, report.nsPerNodeAfter, report.speedup(),
+                    report.movedNodes);
+        walkLine("after compact()", *list);
+        if (!std::is_sorted(list->begin(), list->end())) {
+            std::fprintf(stderr, "%s: order changed by compact()!\n", name);
+            std::exit(1);
+        }
+    }
+    {
+        auto list = scatteredList<List>(values);
+        std::size_t slices = 0;
+        double longest = 0.0;
+        double total = 0.0;
+        bool done = false;
+        while (!done) {
+            bench::Stopwatch watch;
+            done = list->compactStep(slice);
+            double seconds = watch.seconds();
+            longest = std::max(longest, seconds);
+            total += seconds;
+            slices++;
+            pushFront(*list, -1);   // the list stays usable between slices
+        }
+        char label[64];
+        std::snprintf(label, sizeof(label), "compactStep(%zu)", slice);
+        std::printf("  %-30s %8.1f ms   %zu slices, longest %.3f ms\n", label, total * 1e3, slices,
+                    longest * 1e3);
+        walkLine("after compactStep()", *list);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t elements = bench::sizeArg(argc, argv, 1, 1000000);
+    std::size_t slice = bench::sizeArg(argc, argv, 2, 4096);
+    if (elements == 0) elements = 1;
+    if (slice == 0) slice = 1;
+
+    std::vector<int> values = bench::randomValues(elements, bench::DEFAULT_SEED, 0, 1 << 30);
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    benchList<Singly>("LinkedList", values, sorted, slice);
+    benchList<Doubly>("DoublyLinkedList", values, sorted, slice);
+    return 0;
+}
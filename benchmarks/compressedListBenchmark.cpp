@@ -0,0 +1,195 @@
+// ============================================================================
+// compressedListBenchmark.cpp — sorted id lists: LinkedList<int> vs
+// CompressedIntList (delta + bit-packing, compressedList.cpp)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/compressedListBenchmark.cpp -o compressedListBenchmark
+//   (add -DDS_NO_SIMD to run the list on the scalar kernels)
+// Run:
+//   ./compressedListBenchmark [values] [probes]   (defaults: 10000000, 1000)
+//
+// 1. Decode kernels: 1024 blocks of 128 random gaps per width (the working
+//    set stays in L2), unpacked and prefix-summed again and again.
+//      scalar   one value per step
+//      SSE2     four lanes per instruction (the list's default on x86-64)
+//    Column: decoded values per nanosecond.
+//    (The SSE2 column is n/a when built with -DDS_NO_SIMD.)
+//
+// 2. The lists: `values` sorted ids, gaps of 1-8 with a jump of up to 10000
+//    on 1% of them (ids of a sparse table). Three holders:
+//      LinkedList<int>       filled with insertAtEndBulk
+//      std::vector<int>      the contiguous reference
+//      CompressedIntList     filled with append
+//    Columns: build time, bytes per value (memoryUsage(): malloc headers
+//    included), then a full scan (sum of every value) in ns per value:
+//    LinkedList and vector with range-for, the compressed list with its
+//    iterator and with forEach(). Last, `probes` lookups of random values
+//    (half present): LinkedList::searchNode walks from the head (only
+//    probes / 10 of them), std::binary_search on the vector, and
+//    CompressedIntList::searchNode (skip headers + one block decode).
+//
+// Typical (1-core VM, 10^7 values; a slow VM: the vector sums at ~1 ns
+// per value): unpack + prefix sum runs at ~0.25-0.4 values/ns scalar and
+// ~1-1.5 with SSE2 (4-5x; on its own the SSE2 unpack is ~6x the scalar
+// one, the running sum ~2x). The compressed list takes 0.85 bytes per
+// value against 32 for the LinkedList and 4 for the vector, and is built
+// ~5x faster (one allocation per 128 values). Full scan: forEach ~1.4
+// ns/value, close to the vector; the iterator ~4 (a branch and an index
+// per value); LinkedList ~6. Lookups: ~0.4 ms (the block headers are
+// walked one by one, 78125 of them) against ~40 ms for
+// LinkedList::searchNode; the vector's binary search (~1 us) stays far
+// ahead.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace compressed {
+#include "../compressedList.cpp"
+}
+
+namespace {
+
+const std::size_t KERNEL_BLOCKS = 1024;
+const std::size_t KERNEL_VALUES = 1 << 26;   // values decoded per width and kernel
+
+using Unpack = void (*)(const std::uint32_t*, unsigned, std::uint32_t*);
+using PrefixSum = void (*)(std::uint32_t*, std::uint32_t);
+
+double decodeRate(const std::vector<std::uint32_t>& packed, unsigned bits, Unpack unpack, PrefixSum prefixSum) {
+    const std::size_t words = compressed::bitpack::WORDS_PER_BIT * bits;
+    std::uint32_t out[compressed::bitpack::BLOCK];
+    std::uint64_t sum = 0;
+    std::size_t rounds = KERNEL_VALUES / (KERNEL_BLOCKS * compressed::bitpack::BLOCK);
+    bench::Stopwatch watch;
+    for (std::size_t r = 0; r < rounds; r++) {
+        for (std::size_t b = 0; b < KERNEL_BLOCKS; b++) {
+            unpack(packed.data() + b * words, bits, out);
+            prefixSum(out, static_cast<std::uint32_t>(b));
+            sum += out[compressed::bitpack::BLOCK - 1];
+        }
+    }
+    double seconds = watch.seconds();
+    bench::doNotOptimize(sum);
+    return static_cast<double>(KERNEL_VALUES) / (seconds * 1e9);
+}
+
+void runKernels() {
+    std::printf("-- decode kernels (values/ns, unpack + prefix sum)\n");
+    std::printf("  %5s %10s %10s\n", "bits", "scalar", "SSE2");
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    for (unsigned bits : {1u, 2u, 3u, 4u, 6u, 8u, 12u, 16u, 20u, 24u, 32u}) {
+        const std::size_t words = compressed::bitpack::WORDS_PER_BIT * bits;
+        std::vector<std::uint32_t> packed(KERNEL_BLOCKS * words + 1);
+        std::uint32_t gaps[compressed::bitpack::BLOCK];
+        for (std::size_t b = 0; b < KERNEL_BLOCKS; b++) {
+            for (std::uint32_t& g : gaps) g = static_cast<std::uint32_t>(rng()) & compressed::bitpack::lowMask(bits);
+            compressed::bitpack::pack(gaps, bits, packed.data() + b * words);
+        }
+        double scalar = decodeRate(packed, bits, compressed::bitpack::unpackScalar, compressed::bitpack::prefixSumScalar);
+#if defined(__SSE2__) && !defined(DS_NO_SIMD)
+        double simd = decodeRate(packed, bits, compressed::bitpack::unpackSimd, compressed::bitpack::prefixSumSimd);
+        std::printf("  %5u %10.2f %10.2f\n", bits, scalar, simd);
+#else
+        std::printf("  %5u %10.2f %10s\n", bits, scalar, "n/a");
+#endif
+    }
+}
+
+std::vector<int> sortedIds(std::size_t count) {
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<int> ids(count);
+    long long id = 1000;
+    for (std::size_t i = 0; i < count; i++) {
+        ids[i] = static_cast<int>(id);
+        id += 1 + rng() % 8;
+        if (rng() % 100 == 0) id += rng() % 10000;
+    }
+    return ids;
+}
+
+void line(const char* label, double seconds, std::size_t values, long long checksum) {
+    std::printf("  %-34s %9.2f ms %7.2f ns/value   checksum %lld\n", label, seconds * 1e3,
+                seconds * 1e9 / static_cast<double>(values), checksum);
+}
+
+template <typename Container>
+long long sumByIterator(const Container& container) {
+    long long sum = 0;
+    for (int v : container) sum += v;
+    return sum;
+}
+
+template <typename Search>
+void runProbes(const char* label, const std::vector<int>& probes, std::size_t count, Search search) {
+    std::size_t found = 0;
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < count; i++) found += search(probes[i]) ? 1 : 0;
+    double seconds = watch.seconds();
+    std::printf("  %-34s %9.2f us per lookup   found %zu of %zu\n", label,
+                seconds * 1e6 / static_cast<double>(count), found, count);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t count = bench::sizeArg(argc, argv, 1, 10000000);
+    std::size_t probeCount = bench::sizeArg(argc, argv, 2, 1000);
+    if (count == 0) count = 1;
+    if (probeCount < 10) probeCount = 10;
+
+    runKernels();
+
+    std::vector<int> ids = sortedIds(count);
+    std::printf("-- %zu sorted ids (%d .. %d)\n", count, ids.front(), ids.back());
+
+    bench::Stopwatch watch;
+    auto list = std::make_unique<singly::LinkedList<int>>();
+    list->insertAtEndBulk(ids.data(), ids.size());
+    double listBuild = watch.seconds();
+
+    watch.restart();
+    compressed::CompressedIntList<int> packed;
+    for (int id : ids) packed.append(id);
+    double packedBuild = watch.seconds();
+
+    std::printf("  %-34s build %8.2f ms   %6.2f bytes/value\n", "LinkedList<int>", listBuild * 1e3,
+                list->memoryUsage().bytesPerElement());
+    std::printf("  %-34s build %8s      %6.2f bytes/value\n", "std::vector<int>", "-", 4.0);
+    std::printf("  %-34s build %8.2f ms   %6.2f bytes/value   (%zu blocks)\n", "CompressedIntList", packedBuild * 1e3,
+                packed.memoryUsage().bytesPerElement(), packed.blocks());
+
+    std::printf("-- full scan\n");
+    watch.restart();
+    long long sum = sumByIterator(*list);
+    line("LinkedList range-for", watch.seconds(), count, sum);
+    watch.restart();
+    sum = sumByIterator(ids);
+    line("std::vector range-for", watch.seconds(), count, sum);
+    watch.restart();
+    sum = sumByIterator(packed);
+    line("CompressedIntList range-for", watch.seconds(), count, sum);
+    watch.restart();
+    sum = 0;
+    packed.forEach([&sum](int v) { sum += v; });
+    line("CompressedIntList forEach", watch.seconds(), count, sum);
+
+    // Half the probes are ids, half fall in the gaps (or miss altogether)
+    std::mt19937 rng(bench::DEFAULT_SEED + 1);
+    std::vector<int> probes(probeCount);
+    for (std::size_t i = 0; i < probeCount; i++) {
+        int id = ids[rng() % ids.size()];
+        probes[i] = (i % 2 == 0) ? id : id + 1;
+    }
+    std::printf("-- lookups\n");
+    runProbes("LinkedList::searchNode", probes, probeCount / 10, [&](int v) { return list->searchNode(v); });
+    runProbes("std::binary_search (vector)", probes, probeCount,
+              [&](int v) { return std::binary_search(ids.begin(), ids.end(), v); });
+    runProbes("CompressedIntList::searchNode", probes, probeCount, [&](int v) { return packed.searchNode(v); });
+    return 0;
+}
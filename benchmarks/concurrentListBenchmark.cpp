@@ -0,0 +1,183 @@
+// ============================================================================
+// concurrentListBenchmark.cpp — fine-grained vs coarse locking
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/concurrentListBenchmark.cpp -o concurrentListBenchmark
+// Run:
+//   ./concurrentListBenchmark [elements] [ops per thread] [read %]
+//                                              (defaults: 2000, 20000, 90)
+//
+// Every thread runs the same read-mostly mix on ONE shared list of about
+// `elements` values drawn from [0, 2 * elements):
+//   read %                    searchNode(v)
+//   the rest, split evenly    searchAndInsert(v, w) + insertAtPosition(k, w)
+//                             (half of the writes, near the front)
+//                             deleteByValue(v)   (the other half)
+// so the list size stays roughly constant.
+//
+// Lists compared:
+//   coarse mutex       std::mutex + DoublyLinkedList (doublyLinkedList.cpp);
+//                      every operation, reads included, holds the one lock
+//                      for its whole scan; reads use std::find
+//   fine-grained       ConcurrentDoublyLinkedList
+//                      (concurrentDoublyLinkedList.cpp): lock-free reads,
+//                      per-node locks for the writes
+//
+// Columns: total operations per second (millions) for 1, 2, 4 and 8 threads,
+// and the speedup over the coarse list at the same thread count. Each run
+// checks that the final size equals start + successful inserts - deletes.
+//
+// On a machine with ONE hardware thread nothing really runs in parallel, and
+// the fine-grained list is SLOWER (about 0.6-0.8x on a 1-core VM): its nodes
+// are three times larger (a mutex each) and every hop is an atomic load plus
+// a "removed" check. What it buys is parallelism: readers never wait and
+// writers only wait for writers next to them. Run on a multi-core machine to
+// see the scaling.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#define DS_NO_DEMO_MAIN
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+namespace concurrent {
+#include "../concurrentDoublyLinkedList.cpp"
+}
+
+namespace {
+
+// ----------------------------------------------------------------------------
+// The two lists behind one interface
+// ----------------------------------------------------------------------------
+class CoarseList {
+public:
+    bool searchNode(int v) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return std::find(list_.begin(), list_.end(), v) != list_.end();
+    }
+    bool searchAndInsert(int v, int w) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return list_.searchAndInsert(v, w);
+    }
+    bool insertAtPosition(int pos, int w) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return list_.insertAtPosition(pos, w);
+    }
+    bool deleteByValue(int v) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return list_.deleteByValue(v);
+    }
+    std::size_t size() {
+        std::lock_guard<std::mutex> guard(lock_);
+        return list_.size();
+    }
+
+private:
+    std::mutex lock_;
+    doubly::DoublyLinkedList<int> list_;
+};
+
+class FineList {
+public:
+    bool searchNode(int v) { return list_.searchNode(v); }
+    bool searchAndInsert(int v, int w) { return list_.searchAndInsert(v, w); }
+    bool insertAtPosition(int pos, int w) { return list_.insertAtPosition(pos, w); }
+    bool deleteByValue(int v) { return list_.deleteByValue(v); }
+    std::size_t size() { return list_.size(); }
+
+private:
+    concurrent::ConcurrentDoublyLinkedList<int> list_;
+};
+
+struct Config {
+    std::size_t elements;
+    std::size_t opsPerThread;
+    unsigned readPercent;
+};
+
+struct Counts {
+    long long inserted = 0;
+    long long deleted = 0;
+    long long found = 0;
+};
+
+// One thread's share of the mix
+template <typename List>
+Counts runThread(List& list, const Config& config, unsigned thread) {
+    std::mt19937 rng(bench::DEFAULT_SEED + thread * 7919u);
+    int range = static_cast<int>(2 * config.elements);
+    std::uniform_int_distribution<int> value(0, range - 1);
+    std::uniform_int_distribution<unsigned> percent(0, 99);
+    std::uniform_int_distribution<int> nearFront(1, 16);
+    unsigned writeShare = 100 - config.readPercent;
+
+    Counts counts;
+    for (std::size_t i = 0; i < config.opsPerThread; i++) {
+        unsigned p = percent(rng);
+        int v = value(rng);
+        if (p < config.readPercent) {
+            counts.found += list.searchNode(v);
+        } else if (p < config.readPercent + writeShare / 4) {
+            counts.inserted += list.searchAndInsert(v, value(rng));
+        } else if (p < config.readPercent + writeShare / 2) {
+            counts.inserted += list.insertAtPosition(nearFront(rng), v);
+        } else {
+            counts.deleted += list.deleteByValue(v);
+        }
+    }
+    return counts;
+}
+
+// Millions of operations per second, or -1 if the final size is wrong
+template <typename List>
+double measure(const Config& config, unsigned threads, const std::vector<int>& initial) {
+    List list;
+    for (std::size_t i = 0; i < initial.size(); i++) list.insertAtPosition(1, initial[i]);
+
+    std::vector<Counts> counts(threads);
+    std::vector<std::thread> workers;
+    bench::Stopwatch watch;
+    for (unsigned t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] { counts[t] = runThread(list, config, t); });
+    }
+    for (std::thread& w : workers) w.join();
+    double seconds = watch.seconds();
+
+    long long expected = static_cast<long long>(initial.size());
+    long long found = 0;
+    for (const Counts& c : counts) {
+        expected += c.inserted - c.deleted;
+        found += c.found;
+    }
+    bench::doNotOptimize(found);
+    if (static_cast<long long>(list.size()) != expected) {
+        std::fprintf(stderr, "size %zu, expected %lld\n", list.size(), expected);
+        return -1.0;
+    }
+    return static_cast<double>(config.opsPerThread * threads) / seconds / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Config config;
+    config.elements = bench::sizeArg(argc, argv, 1, 2000);
+    config.opsPerThread = bench::sizeArg(argc, argv, 2, 20000);
+    config.readPercent = static_cast<unsigned>(std::min<std::size_t>(bench::sizeArg(argc, argv, 3, 90), 100));
+    if (config.elements == 0) config.elements = 1;
+
+    std::vector<int> initial =
+        bench::randomValues(config.elements, bench::DEFAULT_SEED, 0, static_cast<int>(2 * config.elements) - 1);
+
+    std::printf("%zu elements, %zu ops per thread, %u%% reads, %u hardware threads\n", config.elements,
+                config.opsPerThread, config.readPercent, std::thread::hardware_concurrency());
+    std::printf("%-8s %16s %16s %9s\n", "threads", "coarse Mops/s", "fine Mops/s", "speedup");
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        double coarse = measure<CoarseList>(config, threads, initial);
+        double fine = measure<FineList>(config, threads, initial);
+        if (coarse < 0 || fine < 0) return 1;
+        std::printf("%-8u %16.3f %16.3f %8.2fx\n", threads, coarse, fine, fine / coarse);
+    }
+    return 0;
+}
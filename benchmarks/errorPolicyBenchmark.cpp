@@ -0,0 +1,209 @@
+// ============================================================================
+// errorPolicyBenchmark.cpp — cost per operation of each error policy
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/errorPolicyBenchmark.cpp -o errorPolicyBenchmark
+//   (-std=c++23 makes ReturnExpected use std::expected instead of the stand-in)
+// Run:
+//   ./errorPolicyBenchmark [operations]      (default: 2000000)
+//
+// "before" = errpolicy::Print, the original behaviour. It is measured twice:
+//   print -> /dev/null   stdout really goes to /dev/null, so every endl
+//                        still flushes with a write() system call
+//   print -> discarded   std::cout swallowed in memory (bench::QuietStdout):
+//                        formatting only, no system call
+// "after"  = Silent / Throw / ReturnExpected / Callback, which compile the
+// messages out entirely.
+//
+// Workloads:
+//   StackArrayImplementation  push x20, pop x20 (capacity 25)
+//   SimpleQueue               enqueue x10, dequeue x10 (linear queue, rebuilt
+//                             each round)
+//   StackListImp              pop/peek on an EMPTY stack (error path; the
+//                             success path never printed)
+//   LinkedListImplementation  deleteNode of a missing value (error path)
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#define DS_NO_DEMO_MAIN
+namespace arraystack {
+#include "../StackArrayImp.cpp"
+}
+namespace liststack {
+#include "../StackListImp.cpp"
+}
+namespace simplequeue {
+#include "../simpleQueueImp.cpp"
+}
+namespace listimp {
+#include "../linkListFullImp.cpp"
+}
+
+namespace {
+
+std::size_t callbackErrors = 0;
+void countError(errpolicy::Error, const char*) { callbackErrors++; }
+using CountingCallback = errpolicy::Callback<&countError>;
+
+// Point file descriptor 1 at /dev/null while alive (restored afterwards)
+class StdoutToDevNull {
+public:
+    StdoutToDevNull() {
+        std::cout.flush();
+        std::fflush(stdout);
+        saved_ = dup(1);
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, 1);
+        close(devNull);
+    }
+    ~StdoutToDevNull() {
+        std::cout.flush();
+        std::fflush(stdout);
+        dup2(saved_, 1);
+        close(saved_);
+    }
+
+    StdoutToDevNull(const StdoutToDevNull&) = delete;
+    StdoutToDevNull& operator=(const StdoutToDevNull&) = delete;
+
+private:
+    int saved_;
+};
+
+// Output mode for the Print policy
+enum class Sink { DevNull, Discard, Terminal };
+
+template <typename Fn>
+double timed(Sink sink, Fn fn) {
+    bench::Stopwatch watch;
+    if (sink == Sink::DevNull) {
+        StdoutToDevNull redirect;
+        watch.restart();
+        fn();
+        return watch.seconds();
+    }
+    if (sink == Sink::Discard) {
+        bench::QuietStdout quiet;
+        watch.restart();
+        fn();
+        return watch.seconds();
+    }
+    watch.restart();
+    fn();
+    return watch.seconds();
+}
+
+// Consume whatever a policy returns (value, Expected, bool, void)
+template <typename R>
+void consume(const R& r) { bench::doNotOptimize(r); }
+
+template <typename Policy>
+double stackArrayChurn(std::size_t ops, Sink sink) {
+    const int DEPTH = 20;
+    std::size_t rounds = ops / (2 * DEPTH);
+    arraystack::StackArrayImplementation<int, MAX, Policy> stack;
+    return timed(sink, [&] {
+        for (std::size_t r = 0; r < rounds; r++) {
+            for (int i = 0; i < DEPTH; i++) stack.push(i);
+            for (int i = 0; i < DEPTH; i++) consume(stack.pop());
+        }
+    });
+}
+
+template <typename Policy>
+double simpleQueueChurn(std::size_t ops, Sink sink) {
+    const int DEPTH = 10;
+    std::size_t rounds = ops / (2 * DEPTH);
+    return timed(sink, [&] {
+        for (std::size_t r = 0; r < rounds; r++) {
+            simplequeue::SimpleQueue<int, 10, Policy> queue;
+            for (int i = 0; i < DEPTH; i++) queue.enqueue(i);
+            for (int i = 0; i < DEPTH; i++) consume(queue.dequeue());
+        }
+    });
+}
+
+// Error path: runs `fn` on an empty container `ops` times, catching if needed
+template <typename Policy, typename Fn>
+double errorLoop(std::size_t ops, Sink sink, Fn fn) {
+    return timed(sink, [&] {
+        for (std::size_t i = 0; i < ops; i++) {
+            if constexpr (std::is_same<Policy, errpolicy::Throw>::value) {
+                try {
+                    fn();
+                } catch (const std::exception&) {
+                }
+            } else {
+                fn();
+            }
+        }
+    });
+}
+
+template <typename Policy>
+double stackListUnderflow(std::size_t ops, Sink sink) {
+    liststack::StackListImp<int, Policy> stack;
+    return errorLoop<Policy>(ops, sink, [&] {
+        consume(stack.pop());
+        consume(stack.peek());
+    });
+}
+
+template <typename Policy>
+double listDeleteMissing(std::size_t ops, Sink sink) {
+    listimp::LinkedListImplementation<int, Policy> list;
+    for (int v = 0; v < 8; v++) list.insertAtEnd(v);
+    return errorLoop<Policy>(ops, sink, [&] {
+        if constexpr (std::is_void<typename Policy::status_type>::value) {
+            list.deleteNode(-1);
+        } else {
+            consume(list.deleteNode(-1));
+        }
+    });
+}
+
+// Run one workload for every policy and print ns/op
+template <template <typename> class Workload>
+void runAll(const char* name, std::size_t ops, std::size_t opsPerCall) {
+    std::printf("-- %s\n", name);
+    std::size_t effective = ops * opsPerCall;
+    bench::report("Print    -> /dev/null  (before)", effective, Workload<errpolicy::Print>::run(ops, Sink::DevNull));
+    bench::report("Print    -> discarded  (before)", effective, Workload<errpolicy::Print>::run(ops, Sink::Discard));
+    bench::report("Silent                 (after)", effective, Workload<errpolicy::Silent>::run(ops, Sink::Terminal));
+    bench::report("Throw                  (after)", effective, Workload<errpolicy::Throw>::run(ops, Sink::Terminal));
+    bench::report("ReturnExpected         (after)", effective, Workload<errpolicy::ReturnExpected>::run(ops, Sink::Terminal));
+    bench::report("Callback<countError>   (after)", effective, Workload<CountingCallback>::run(ops, Sink::Terminal));
+}
+
+template <typename P> struct StackArrayChurn {
+    static double run(std::size_t ops, Sink sink) { return stackArrayChurn<P>(ops, sink); }
+};
+template <typename P> struct SimpleQueueChurn {
+    static double run(std::size_t ops, Sink sink) { return simpleQueueChurn<P>(ops, sink); }
+};
+template <typename P> struct StackListUnderflow {
+    static double run(std::size_t ops, Sink sink) { return stackListUnderflow<P>(ops, sink); }
+};
+template <typename P> struct ListDeleteMissing {
+    static double run(std::size_t ops, Sink sink) { return listDeleteMissing<P>(ops, sink); }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t ops = bench::sizeArg(argc, argv, 1, 2000000);
+
+    runAll<StackArrayChurn>("StackArrayImplementation push/pop churn", ops, 1);
+    runAll<SimpleQueueChurn>("SimpleQueue enqueue/dequeue churn", ops, 1);
+    // error paths are slower with Throw; fewer iterations keep the run short
+    runAll<StackListUnderflow>("StackListImp pop+peek on empty (error path)", ops / 10, 2);
+    runAll<ListDeleteMissing>("LinkedListImplementation deleteNode(missing) (error path)", ops / 10, 1);
+
+    std::printf("(Throw is timed on the success path for the churn workloads;\n"
+                " callback handler ran %zu times in total)\n", callbackErrors);
+    return 0;
+}
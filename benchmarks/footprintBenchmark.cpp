@@ -0,0 +1,343 @@
+// ============================================================================
+// footprintBenchmark.cpp — bytes per element for every container layout
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/footprintBenchmark.cpp -o footprintBenchmark
+// Run:
+//   ./footprintBenchmark [elements]      (default: 1000000)
+//
+// Every container is filled with the same n ints (fixed seed) and reports
+// memoryUsage() (see MemoryUsage.h), split per element into
+//   payload    the int itself (4 bytes)
+//   overhead   links, padding, unused capacity, the container object
+//   slack      malloc chunk header + size-class rounding
+//   total      sum of the three
+//   frag       share of links that jump to a non-neighbouring heap block
+// The last column is an independent check: the heap growth seen by the
+// counting operator new (AllocCounter.h) while the container was built,
+// converted to malloc chunks (usable size + 8-byte header, glibc).
+//
+// Layouts compared:
+//   node-based    one heap node per element (the repo lists, std::list, ...)
+//   unrolled      blocks of several elements per node (std::deque and a
+//                 minimal unrolled list defined below)
+//   index-linked  nodes in one std::vector, 32-bit indices instead of pointers
+//   array         contiguous values (std::vector, the fixed-size array stack
+//                 and queue at their full capacity)
+// ============================================================================
+
+#include "BenchCommon.h"
+#include "AllocCounter.h"
+
+#define DS_NO_DEMO_MAIN
+namespace arraystack {
+#include "../StackArrayImp.cpp"
+}
+namespace liststack {
+#include "../StackListImp.cpp"
+}
+namespace simplequeue {
+#include "../simpleQueueImp.cpp"
+}
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace listimp {
+#include "../linkListFullImp.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+namespace circular {
+#include "../CircularList.cpp"
+}
+
+using memusage::AllocationStats;
+using memusage::CountingAllocator;
+using memusage::MemoryUsage;
+
+namespace {
+
+// ----------------------------------------------------------------------------
+// Unrolled linked list: each heap block holds up to K values.
+// Minimal (append + memoryUsage only); here to measure the layout.
+// ----------------------------------------------------------------------------
+template <std::size_t K>
+class UnrolledList {
+    struct Block {
+        Block*        next;
+        std::uint32_t count;
+        int           values[K];
+    };
+
+public:
+    UnrolledList() : head_(nullptr), tail_(nullptr), size_(0), blocks_(0) {}
+    ~UnrolledList() {
+        while (head_ != nullptr) {
+            Block* next = head_->next;
+            delete head_;
+            head_ = next;
+        }
+    }
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+
+    void append(int value) {
+        if (tail_ == nullptr || tail_->count == K) {
+            Block* block = new Block();
+            if (tail_ == nullptr) head_ = block;
+            else tail_->next = block;
+            tail_ = block;
+            blocks_++;
+        }
+        tail_->values[tail_->count++] = value;
+        size_++;
+    }
+
+    MemoryUsage memoryUsage() const {
+        MemoryUsage usage;
+        usage.elements = size_;
+        usage.payloadBytes = size_ * sizeof(int);
+        usage.overheadBytes = blocks_ * sizeof(Block) + sizeof(*this) - usage.payloadBytes;
+        usage.allocatorSlackBytes = blocks_ * (memusage::mallocBlockSize(sizeof(Block)) - sizeof(Block));
+        usage.heapBlocks = blocks_;
+        if (blocks_ > 1) {
+            std::size_t jumps = 0;
+            const std::uintptr_t neighbour = memusage::mallocBlockSize(sizeof(Block));
+            for (const Block* b = head_; b->next != nullptr; b = b->next) {
+                std::uintptr_t from = reinterpret_cast<std::uintptr_t>(b);
+                std::uintptr_t to = reinterpret_cast<std::uintptr_t>(b->next);
+                if ((to > from ? to - from : from - to) != neighbour) jumps++;
+            }
+            usage.fragmentation = static_cast<double>(jumps) / static_cast<double>(blocks_ - 1);
+        }
+        return usage;
+    }
+
+private:
+    Block*      head_;
+    Block*      tail_;
+    std::size_t size_;
+    std::size_t blocks_;
+};
+
+// ----------------------------------------------------------------------------
+// Index-linked list: nodes live in one vector, `next` is a 32-bit slot index
+// ----------------------------------------------------------------------------
+class IndexLinkedList {
+    struct Slot {
+        int           value;
+        std::uint32_t next;
+    };
+    static const std::uint32_t NIL = 0xffffffffu;
+
+public:
+    explicit IndexLinkedList(AllocationStats& stats)
+        : slots_(CountingAllocator<Slot>(stats)), stats_(stats), head_(NIL) {}
+
+    void reserve(std::size_t n) { slots_.reserve(n); }
+
+    void pushFront(int value) {
+        slots_.push_back(Slot{value, head_});
+        head_ = static_cast<std::uint32_t>(slots_.size() - 1);
+    }
+
+    MemoryUsage memoryUsage() const {
+        return memusage::usageFromStats(stats_, slots_.size(), sizeof(int), sizeof(*this));
+    }
+
+private:
+    std::vector<Slot, CountingAllocator<Slot>> slots_;
+    const AllocationStats& stats_;
+    std::uint32_t head_;
+};
+
+// ----------------------------------------------------------------------------
+// Reporting
+// ----------------------------------------------------------------------------
+struct Row {
+    std::string layout;
+    std::string container;
+    MemoryUsage usage;
+    double      measuredPerElement;   // < 0: nothing was allocated on the heap
+};
+
+std::vector<Row> rows;
+
+// Heap growth (in malloc chunks) while `build` runs; then usage is recorded.
+template <typename Build, typename Usage>
+void record(const std::string& layout, const std::string& container, Build build, Usage usage) {
+    std::size_t bytesBefore = bench::liveHeapBytes();
+    std::size_t blocksBefore = bench::allocCount() - bench::freeCount();
+    build();
+    std::size_t bytes = bench::liveHeapBytes() - bytesBefore;
+    std::size_t blocks = bench::allocCount() - bench::freeCount() - blocksBefore;
+    MemoryUsage u = usage();
+    double measured = -1.0;
+    if (blocks > 0 && u.elements > 0) {
+        measured = static_cast<double>(bytes + blocks * sizeof(std::size_t)) / static_cast<double>(u.elements);
+    }
+    rows.push_back(Row{layout, container, u, measured});
+}
+
+void printRows() {
+    std::printf("%-13s %-34s %9s %8s %9s %7s %8s %6s %10s\n", "layout", "container", "elements",
+                "payload", "overhead", "slack", "total", "frag", "measured");
+    for (const Row& r : rows) {
+        double n = static_cast<double>(r.usage.elements ? r.usage.elements : 1);
+        std::printf("%-13s %-34s %9zu %8.2f %9.2f %7.2f %8.2f %6.2f ", r.layout.c_str(), r.container.c_str(),
+                    r.usage.elements, r.usage.payloadBytes / n, r.usage.overheadBytes / n,
+                    r.usage.allocatorSlackBytes / n, r.usage.bytesPerElement(), r.usage.fragmentation);
+        if (r.measuredPerElement < 0) std::printf("%10s\n", "-");
+        else std::printf("%10.2f\n", r.measuredPerElement);
+    }
+    std::printf("(bytes per element; frag is 0 for containers without links)\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::sizeArg(argc, argv, 1, 1000000);
+    const std::vector<int> values = bench::randomValues(n);
+
+    // lists with O(n) append are filled from a snapshot (loadSnapshot is O(n))
+    const std::string snapPath = "footprintBenchmark.snap";
+    {
+        snapshot::SnapshotWriter<int> writer(snapPath, snapshot::Kind::Unknown);
+        for (int v : values) writer.append(v);
+        writer.finish();
+    }
+    snapshot::SnapshotView<int> view(snapPath);
+
+    // ---- node-based --------------------------------------------------------
+    {
+        singly::LinkedList list;
+        record("node-based", "LinkedList", [&] { for (int v : values) list.insertAtBeggining(v); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        listimp::LinkedListImplementation list;
+        record("node-based", "LinkedListImplementation", [&] { list.loadSnapshot(view); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        doubly::DoublyLinkedList list;
+        record("node-based", "DoublyLinkedList", [&] { for (int v : values) list.insertAtFront(v); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        circular::CircularLinkedList list;
+        record("node-based", "CircularLinkedList", [&] { list.loadSnapshot(view); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        liststack::StackListImp stack;
+        record("node-based", "StackListImp", [&] { for (int v : values) stack.push(v); },
+               [&] { return stack.memoryUsage(); });
+    }
+    {
+        TemplatedDeque<int> deque;
+        record("node-based", "TemplatedDeque<int>", [&] { for (int v : values) deque.insertRear(v); },
+               [&] { return deque.memoryUsage(); });
+    }
+    {
+        AllocationStats stats;
+        std::forward_list<int, CountingAllocator<int>> list{CountingAllocator<int>(stats)};
+        record("node-based", "std::forward_list<int>", [&] { for (int v : values) list.push_front(v); },
+               [&] { return memusage::usageFromStats(stats, n, sizeof(int), sizeof(list)); });
+    }
+    {
+        AllocationStats stats;
+        std::list<int, CountingAllocator<int>> list{CountingAllocator<int>(stats)};
+        record("node-based", "std::list<int>", [&] { for (int v : values) list.push_back(v); },
+               [&] { return memusage::usageFromStats(stats, n, sizeof(int), sizeof(list)); });
+    }
+
+    {
+        // Same nodes, only re-linked: the footprint is unchanged, the order in
+        // memory is not. Kept last because freeing these nodes in sorted order
+        // scatters malloc's free lists for every list built afterwards.
+        singly::LinkedList list;
+        record("node-based", "LinkedList after sort()",
+               [&] {
+                   for (int v : values) list.insertAtBeggining(v);
+                   list.sort();
+               },
+               [&] { return list.memoryUsage(); });
+    }
+
+    // ---- unrolled ----------------------------------------------------------
+    {
+        AllocationStats stats;
+        std::deque<int, CountingAllocator<int>> deque{CountingAllocator<int>(stats)};
+        record("unrolled", "std::deque<int>", [&] { for (int v : values) deque.push_back(v); },
+               [&] { return memusage::usageFromStats(stats, n, sizeof(int), sizeof(deque)); });
+    }
+    {
+        UnrolledList<12> list;    // 64-byte blocks
+        record("unrolled", "UnrolledList (12 per block)", [&] { for (int v : values) list.append(v); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        UnrolledList<60> list;    // 256-byte blocks
+        record("unrolled", "UnrolledList (60 per block)", [&] { for (int v : values) list.append(v); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        UnrolledList<252> list;   // 1 KiB blocks
+        record("unrolled", "UnrolledList (252 per block)", [&] { for (int v : values) list.append(v); },
+               [&] { return list.memoryUsage(); });
+    }
+
+    // ---- index-linked ------------------------------------------------------
+    {
+        AllocationStats stats;
+        IndexLinkedList list(stats);
+        record("index-linked", "IndexLinkedList (grown)", [&] { for (int v : values) list.pushFront(v); },
+               [&] { return list.memoryUsage(); });
+    }
+    {
+        AllocationStats stats;
+        IndexLinkedList list(stats);
+        record("index-linked", "IndexLinkedList (reserved)",
+               [&] {
+                   list.reserve(n);
+                   for (int v : values) list.pushFront(v);
+               },
+               [&] { return list.memoryUsage(); });
+    }
+
+    // ---- array -------------------------------------------------------------
+    {
+        AllocationStats stats;
+        std::vector<int, CountingAllocator<int>> vec{CountingAllocator<int>(stats)};
+        record("array", "std::vector<int> (grown)", [&] { for (int v : values) vec.push_back(v); },
+               [&] { return memusage::usageFromStats(stats, n, sizeof(int), sizeof(vec)); });
+    }
+    {
+        AllocationStats stats;
+        std::vector<int, CountingAllocator<int>> vec{CountingAllocator<int>(stats)};
+        record("array", "std::vector<int> (reserved)",
+               [&] {
+                   vec.reserve(n);
+                   for (int v : values) vec.push_back(v);
+               },
+               [&] { return memusage::usageFromStats(stats, n, sizeof(int), sizeof(vec)); });
+    }
+    {
+        bench::QuietStdout quiet;   // push/enqueue print on every call
+        arraystack::StackArrayImplementation stack;
+        record("array", "StackArrayImplementation (full)", [&] { for (int i = 0; i < MAX; i++) stack.push(values[i]); },
+               [&] { return stack.memoryUsage(); });
+        arraystack::StackArrayImplementation empty;
+        record("array", "StackArrayImplementation (1 elem)", [&] { empty.push(values[0]); },
+               [&] { return empty.memoryUsage(); });
+        simplequeue::SimpleQueue queue;
+        record("array", "SimpleQueue (full)", [&] { for (int i = 0; i < 10; i++) queue.enqueue(values[i]); },
+               [&] { return queue.memoryUsage(); });
+    }
+
+    std::remove(snapPath.c_str());
+    printRows();
+    return 0;
+}
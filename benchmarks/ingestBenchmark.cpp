@@ -0,0 +1,238 @@
+// ============================================================================
+// ingestBenchmark.cpp — loading and dumping text files of ints (FastIO.h)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/ingestBenchmark.cpp -o ingestBenchmark
+// Run:
+//   ./ingestBenchmark [values]                    (default: 10000000)
+//
+// Writes `values` random ints (one per line, ~10 bytes each) to
+// ingestBenchmark.txt in the current directory, reads them back in several
+// ways and removes the file at the end.
+//
+// 1. Write the file
+//      ofstream << v << endl   what display() does: a flush per value (run
+//                              on the first 10^6 values only)
+//      ofstream << v << '\n'   buffered iostream
+//      fastio::Writer          std::to_chars into a 1 MiB buffer
+// 2. Parse into a std::vector<int>
+//      ifstream >> v           iostream extraction
+//      fastio::NumberReader    mmap + std::from_chars
+// 3. Fill the containers (parsing included)
+//      LinkedList              ifstream >> + insertAtBeggining (insertAtEnd
+//                              walks the list: O(n^2)) vs appendAll, which
+//                              uses insertAtEndBulk (keeps file order)
+//      SimpleQueue             ifstream >> + enqueue vs appendAll (enqueueBulk)
+//      StackArrayImplementation ifstream >> + push vs appendAll (pushBulk)
+//    The array containers have a fixed capacity of 2^24 values (they are
+//    allocated on the heap), so at most that many are loaded.
+// 4. Dump a loaded StackArrayImplementation: ofstream << per value vs
+//    writeTo(fastio::Writer)
+//
+// Columns: milliseconds, ns per value, MB/s of text, and a checksum that
+// must match across each group.
+//
+// Typical (1-core VM, 10^7 values): iostream parsing ~100 ns/value,
+// NumberReader ~35 ns (page faults on the mapping included); the array
+// containers fill 3.5-4x faster, the linked list 2x (its node allocations
+// stay); writing ~100 ns/value with ofstream and '\n', ~30 ns with Writer,
+// and ~0.8 us with endl.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <cstdio>   // std::remove
+#include <fstream>
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace queueimp {
+#include "../simpleQueueImp.cpp"
+}
+namespace stackimp {
+#include "../StackArrayImp.cpp"
+}
+
+namespace {
+
+const std::size_t ARRAY_CAPACITY = std::size_t(1) << 24;
+const std::size_t ENDL_VALUES = 1000000;
+
+using Queue = queueimp::SimpleQueue<int, ARRAY_CAPACITY, errpolicy::Silent>;
+using Stack = stackimp::StackArrayImplementation<int, ARRAY_CAPACITY, errpolicy::Silent>;
+
+std::size_t fileBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(in.tellg());
+}
+
+void line(const char* label, std::size_t values, std::size_t bytes, double seconds, long long checksum) {
+    std::printf("  %-40s %9.1f ms %8.1f ns/value %8.1f MB/s   checksum %lld\n", label, seconds * 1e3,
+                seconds * 1e9 / static_cast<double>(values), static_cast<double>(bytes) / seconds / 1e6, checksum);
+}
+
+long long sumOf(const std::vector<int>& values) {
+    long long sum = 0;
+    for (int v : values) sum += v;
+    return sum;
+}
+
+// Sum of a container's values, read back through writeTo() into a vector
+struct Collect {
+    std::vector<int> values;
+    void write(int v) { values.push_back(v); }
+    void writeValues(const int* v, std::size_t n) { values.insert(values.end(), v, v + n); }
+};
+
+template <typename Container>
+long long sumOf(const Container& container) {
+    Collect collect;
+    container.writeTo(collect);
+    return sumOf(collect.values);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t count = bench::sizeArg(argc, argv, 1, 10000000);
+    if (count == 0) count = 1;
+    const std::string path = "ingestBenchmark.txt";
+    std::vector<int> values = bench::randomValues(count, bench::DEFAULT_SEED, -1000000000, 1000000000);
+    long long expected = sumOf(values);
+    std::size_t arrayCount = std::min(count, ARRAY_CAPACITY);
+    long long arrayExpected = sumOf(std::vector<int>(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(arrayCount)));
+
+    std::printf("%zu values\n-- write\n", count);
+    bench::Stopwatch watch;
+    {
+        std::size_t n = std::min(count, ENDL_VALUES);
+        std::ofstream out(path);
+        watch.restart();
+        for (std::size_t i = 0; i < n; i++) out << values[i] << std::endl;
+        out.close();
+        line("ofstream << v << endl (10^6 at most)", n, fileBytes(path), watch.seconds(), 0);
+    }
+    {
+        watch.restart();
+        std::ofstream out(path);
+        for (int v : values) out << v << '\n';
+        out.close();
+        line("ofstream << v << '\\n'", count, fileBytes(path), watch.seconds(), 0);
+    }
+    {
+        watch.restart();
+        {
+            fastio::Writer out(path);
+            out.writeValues(values.data(), values.size());
+            out.flush();
+        }
+        line("fastio::Writer", count, fileBytes(path), watch.seconds(), 0);
+    }
+    std::size_t bytes = fileBytes(path);
+
+    std::printf("-- parse into std::vector<int>\n");
+    {
+        watch.restart();
+        std::ifstream in(path);
+        std::vector<int> got;
+        int v;
+        while (in >> v) got.push_back(v);
+        line("ifstream >> v", count, bytes, watch.seconds(), sumOf(got));
+    }
+    {
+        watch.restart();
+        fastio::NumberReader<int> in(path);
+        std::vector<int> got;
+        in.readAll(got);
+        line(in.isMapped() ? "NumberReader (mmap)" : "NumberReader (read)", count, bytes, watch.seconds(),
+             sumOf(got));
+    }
+
+    std::printf("-- fill containers\n");
+    {
+        watch.restart();
+        auto list = std::make_unique<singly::LinkedList<int>>();
+        std::ifstream in(path);
+        int v;
+        while (in >> v) list->insertAtBeggining(v);
+        double seconds = watch.seconds();
+        line("LinkedList: >> + insertAtBeggining", count, bytes, seconds, sumOf(*list));
+    }
+    {
+        watch.restart();
+        auto list = std::make_unique<singly::LinkedList<int>>();
+        fastio::NumberReader<int> in(path);
+        fastio::appendAll(in, *list);
+        double seconds = watch.seconds();
+        line("LinkedList: appendAll", count, bytes, seconds, sumOf(*list));
+    }
+    {
+        auto queue = std::make_unique<Queue>();
+        watch.restart();
+        std::ifstream in(path);
+        int v;
+        for (std::size_t i = 0; i < arrayCount && in >> v; i++) queue->enqueue(v);
+        line("SimpleQueue: >> + enqueue", arrayCount, bytes, watch.seconds(), sumOf(*queue));
+    }
+    {
+        auto queue = std::make_unique<Queue>();
+        watch.restart();
+        fastio::NumberReader<int> in(path);
+        fastio::appendAll(in, *queue);
+        line("SimpleQueue: appendAll", arrayCount, bytes, watch.seconds(), sumOf(*queue));
+    }
+    {
+        auto stack = std::make_unique<Stack>();
+        watch.restart();
+        std::ifstream in(path);
+        int v;
+        for (std::size_t i = 0; i < arrayCount && in >> v; i++) stack->push(v);
+        line("StackArrayImplementation: >> + push", arrayCount, bytes, watch.seconds(), sumOf(*stack));
+    }
+    auto stack = std::make_unique<Stack>();
+    {
+        watch.restart();
+        fastio::NumberReader<int> in(path);
+        fastio::appendAll(in, *stack);
+        line("StackArrayImplementation: appendAll", arrayCount, bytes, watch.seconds(), sumOf(*stack));
+    }
+    if (sumOf(*stack) != arrayExpected) {
+        std::fprintf(stderr, "loaded values differ from the ones written!\n");
+        return 1;
+    }
+
+    std::printf("-- dump StackArrayImplementation (bottom to top)\n");
+    {
+        watch.restart();
+        std::ofstream out(path);
+        Collect collect;
+        stack->writeTo(collect);   // the array in order, as display() would walk it
+        for (int v : collect.values) out << v << '\n';
+        out.close();
+        line("ofstream << v << '\\n'", arrayCount, fileBytes(path), watch.seconds(), 0);
+    }
+    {
+        watch.restart();
+        {
+            fastio::Writer out(path);
+            stack->writeTo(out);
+            out.flush();
+        }
+        line("writeTo(fastio::Writer)", arrayCount, fileBytes(path), watch.seconds(), 0);
+    }
+    {
+        fastio::NumberReader<int> in(path);
+        std::vector<int> got;
+        in.readAll(got);
+        if (sumOf(got) != arrayExpected) {
+            std::fprintf(stderr, "dumped values differ!\n");
+            return 1;
+        }
+    }
+    std::printf("expected checksum %lld (arrays: %lld)\n", expected, arrayExpected);
+    std::remove(path.c_str());
+    return 0;
+}
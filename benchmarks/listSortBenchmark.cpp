@@ -0,0 +1,106 @@
+// ============================================================================
+// listSortBenchmark.cpp — in-place list sorts vs. copy-sort-rebuild
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/listSortBenchmark.cpp -o listSortBenchmark
+// Run:
+//   ./listSortBenchmark [elements] [threads]      (defaults: 1000000, all cores)
+//
+// For each list type we time:
+//   copy-sort-rebuild   copy values into a std::vector, std::stable_sort,
+//                       build a NEW list from the vector (old list still alive,
+//                       so peak memory is list + vector + list)
+//   sort()              in-place top-down merge sort
+//   sortBottomUp()      in-place bottom-up merge sort
+//   sortParallel()      in-place task-parallel merge sort
+//   radixSort()         in-place LSD radix sort (256 buckets, 4 passes)
+// Every run starts from the same fixed-seed input and is checked with
+// std::is_sorted afterwards.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+
+namespace {
+
+// Build a list holding `values` in order (insert at the front, back to front: O(n)).
+void fill(singly::LinkedList<>& list, const std::vector<int>& values) {
+    for (std::size_t i = values.size(); i-- > 0;) list.insertAtBeggining(values[i]);
+}
+
+void fill(doubly::DoublyLinkedList<>& list, const std::vector<int>& values) {
+    for (std::size_t i = values.size(); i-- > 0;) list.insertAtFront(values[i]);
+}
+
+template <typename List>
+void checkSorted(const List& list, const char* label) {
+    if (!std::is_sorted(list.begin(), list.end())) {
+        std::fprintf(stderr, "%s: result is not sorted!\n", label);
+        std::exit(1);
+    }
+}
+
+// Time one in-place sort variant on a fresh copy of the input.
+template <typename List, typename SortFn>
+void timeInPlace(const std::string& label, const std::vector<int>& input, SortFn sortFn) {
+    List list;
+    fill(list, input);
+
+    bench::Stopwatch watch;
+    sortFn(list);
+    double seconds = watch.seconds();
+
+    checkSorted(list, label.c_str());
+    bench::report(label, input.size(), seconds);
+}
+
+// Baseline: the copy -> std::stable_sort -> rebuild approach used today.
+template <typename List>
+void timeCopySortRebuild(const std::string& label, const std::vector<int>& input) {
+    List list;
+    fill(list, input);
+
+    bench::Stopwatch watch;
+    std::vector<int> copy(list.begin(), list.end());
+    std::stable_sort(copy.begin(), copy.end());
+    List rebuilt;
+    fill(rebuilt, copy);
+    double seconds = watch.seconds();
+
+    checkSorted(rebuilt, label.c_str());
+    bench::report(label, input.size(), seconds);
+}
+
+template <typename List>
+void runAll(const std::string& name, const std::vector<int>& input, unsigned threads) {
+    timeCopySortRebuild<List>(name + " copy-sort-rebuild", input);
+    timeInPlace<List>(name + " sort()", input, [](List& l) { l.sort(); });
+    timeInPlace<List>(name + " sortBottomUp()", input, [](List& l) { l.sortBottomUp(); });
+    timeInPlace<List>(name + " sortParallel(" + std::to_string(threads) + ")", input,
+                      [threads](List& l) { l.sortParallel(threads); });
+    timeInPlace<List>(name + " radixSort()", input, [](List& l) { l.radixSort(); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::sizeArg(argc, argv, 1, 1000000);
+    unsigned threads = static_cast<unsigned>(
+        bench::sizeArg(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+
+    // full int range, including negatives
+    std::vector<int> input = bench::randomValues(n, bench::DEFAULT_SEED,
+                                                 std::numeric_limits<int>::min(),
+                                                 std::numeric_limits<int>::max());
+
+    runAll<singly::LinkedList<>>("LinkedList", input, threads);
+    runAll<doubly::DoublyLinkedList<>>("DoublyLinkedList", input, threads);
+    return 0;
+}
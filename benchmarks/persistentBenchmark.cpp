@@ -0,0 +1,233 @@
+// ============================================================================
+// persistentBenchmark.cpp — O(1) persistent snapshots vs deep copies
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/persistentBenchmark.cpp -o persistentBenchmark
+// Run:
+//   ./persistentBenchmark [elements] [versions]   (defaults: 10000, 1000)
+//
+// An undo history: start from `elements` ints, then `versions` times make one
+// edit and keep a snapshot of the result. EVERY snapshot stays alive until
+// the end (that is the point of a history), so the live heap at the end is
+// the memory cost of the whole history.
+//
+//   deep copy    StackListImp / LinkedList: copy deleted, so a snapshot
+//                rebuilds a new container from the old one's elements
+//   persistent   PersistentStack / PersistentList (persistentList.cpp):
+//                a snapshot is a handle copy, versions share unchanged nodes
+//
+// Workloads:
+//   push           one push / insertAtBeggining per version: persistent
+//                  versions share everything but the new node
+//   random insert  LinkedList vs PersistentList, insertAtPosition at a random
+//                  position: the persistent version must copy the nodes in
+//                  front of it (n/2 on average), so it saves only half
+//
+// Columns: time per version (edit + snapshot), live heap bytes per version
+// (counting operator new, AllocCounter.h), and a checksum of the newest
+// and oldest snapshots so all variants can be compared.
+// ============================================================================
+
+#include "BenchCommon.h"
+#include "AllocCounter.h"
+
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace liststack {
+#include "../StackListImp.cpp"
+}
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace persistent {
+#include "../persistentList.cpp"
+}
+
+namespace {
+
+using DeepStack = liststack::StackListImp<int, errpolicy::Silent>;
+using DeepList = singly::LinkedList<int>;
+using PStack = persistent::PersistentStack<int, errpolicy::Silent>;
+using PList = persistent::PersistentList<int>;
+
+template <typename Range>
+long long checksum(const Range& range) {
+    long long sum = 0;
+    long long position = 1;
+    for (int v : range) sum += v * position++;
+    return sum;
+}
+
+void line(const char* label, std::size_t versions, double seconds, std::size_t heapBytes, long long newest,
+          long long oldest) {
+    std::printf("%-30s %11.0f ns/version %11.0f B/version   checksums %lld / %lld\n", label,
+                seconds * 1e9 / static_cast<double>(versions),
+                static_cast<double>(heapBytes) / static_cast<double>(versions), newest, oldest);
+}
+
+// ----------------------------------------------------------------------------
+// Deep copies: what a snapshot costs without persistence
+// ----------------------------------------------------------------------------
+std::unique_ptr<DeepStack> copyStack(const DeepStack& from, std::vector<int>& scratch) {
+    scratch.assign(from.begin(), from.end());       // top -> bottom
+    auto copy = std::make_unique<DeepStack>();
+    for (auto it = scratch.rbegin(); it != scratch.rend(); ++it) copy->push(*it);
+    return copy;
+}
+
+std::unique_ptr<DeepList> copyList(const DeepList& from, std::vector<int>& scratch) {
+    scratch.assign(from.begin(), from.end());
+    auto copy = std::make_unique<DeepList>();
+    for (auto it = scratch.rbegin(); it != scratch.rend(); ++it) copy->insertAtBeggining(*it);
+    return copy;
+}
+
+// LinkedList has no insertAtPosition, so the copy is built with the new
+// value already in place
+std::unique_ptr<DeepList> copyListInserting(const DeepList& from, std::size_t position, int value,
+                                            std::vector<int>& scratch) {
+    scratch.assign(from.begin(), from.end());
+    scratch.insert(scratch.begin() + static_cast<std::ptrdiff_t>(position), value);
+    auto copy = std::make_unique<DeepList>();
+    for (auto it = scratch.rbegin(); it != scratch.rend(); ++it) copy->insertAtBeggining(*it);
+    return copy;
+}
+
+// ----------------------------------------------------------------------------
+// Workload 1: push + snapshot
+// ----------------------------------------------------------------------------
+void pushDeepStack(const std::vector<int>& base, std::size_t versions) {
+    std::vector<int> scratch;
+    std::vector<std::unique_ptr<DeepStack>> history;
+    history.reserve(versions + 1);
+    history.push_back(std::make_unique<DeepStack>());
+    for (int v : base) history.back()->push(v);
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < versions; i++) {
+        history.push_back(copyStack(*history.back(), scratch));
+        history.back()->push(static_cast<int>(i));
+    }
+    double seconds = watch.seconds();
+    line("StackListImp deep copy", versions, seconds, bench::liveHeapBytes() - heapBefore,
+         checksum(*history.back()), checksum(*history.front()));
+}
+
+void pushPersistentStack(const std::vector<int>& base, std::size_t versions) {
+    std::vector<PStack> history;
+    history.reserve(versions + 1);
+    PStack first;
+    for (int v : base) first = first.push(v);
+    history.push_back(first);
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < versions; i++) {
+        history.push_back(history.back().push(static_cast<int>(i)));
+    }
+    double seconds = watch.seconds();
+    line("PersistentStack", versions, seconds, bench::liveHeapBytes() - heapBefore, checksum(history.back()),
+         checksum(history.front()));
+}
+
+void pushDeepList(const std::vector<int>& base, std::size_t versions) {
+    std::vector<int> scratch;
+    std::vector<std::unique_ptr<DeepList>> history;
+    history.reserve(versions + 1);
+    history.push_back(std::make_unique<DeepList>());
+    for (int v : base) history.back()->insertAtBeggining(v);
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < versions; i++) {
+        history.push_back(copyList(*history.back(), scratch));
+        history.back()->insertAtBeggining(static_cast<int>(i));
+    }
+    double seconds = watch.seconds();
+    line("LinkedList deep copy", versions, seconds, bench::liveHeapBytes() - heapBefore,
+         checksum(*history.back()), checksum(*history.front()));
+}
+
+void pushPersistentList(const std::vector<int>& base, std::size_t versions) {
+    std::vector<PList> history;
+    history.reserve(versions + 1);
+    PList first;
+    for (int v : base) first = first.insertAtBeggining(v);
+    history.push_back(first);
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < versions; i++) {
+        history.push_back(history.back().insertAtBeggining(static_cast<int>(i)));
+    }
+    double seconds = watch.seconds();
+    line("PersistentList", versions, seconds, bench::liveHeapBytes() - heapBefore, checksum(history.back()),
+         checksum(history.front()));
+}
+
+// ----------------------------------------------------------------------------
+// Workload 2: insert at a random position + snapshot
+// ----------------------------------------------------------------------------
+std::vector<std::size_t> randomPositions(std::size_t elements, std::size_t versions) {
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<std::size_t> positions(versions);
+    for (std::size_t i = 0; i < versions; i++) positions[i] = rng() % (elements + i + 1);
+    return positions;
+}
+
+void insertDeepList(const std::vector<int>& base, const std::vector<std::size_t>& positions) {
+    std::vector<int> scratch;
+    std::vector<std::unique_ptr<DeepList>> history;
+    history.reserve(positions.size() + 1);
+    history.push_back(std::make_unique<DeepList>());
+    for (auto it = base.rbegin(); it != base.rend(); ++it) history.back()->insertAtBeggining(*it);
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < positions.size(); i++) {
+        history.push_back(copyListInserting(*history.back(), positions[i], static_cast<int>(i), scratch));
+    }
+    double seconds = watch.seconds();
+    line("LinkedList deep copy", positions.size(), seconds, bench::liveHeapBytes() - heapBefore,
+         checksum(*history.back()), checksum(*history.front()));
+}
+
+void insertPersistentList(const std::vector<int>& base, const std::vector<std::size_t>& positions) {
+    std::vector<PList> history;
+    history.reserve(positions.size() + 1);
+    history.push_back(PList(base.begin(), base.end()));
+
+    std::size_t heapBefore = bench::liveHeapBytes();
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < positions.size(); i++) {
+        history.push_back(history.back().insertAtPosition(positions[i] + 1, static_cast<int>(i)));   // 1-based
+    }
+    double seconds = watch.seconds();
+    line("PersistentList path copy", positions.size(), seconds, bench::liveHeapBytes() - heapBefore,
+         checksum(history.back()), checksum(history.front()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t elements = bench::sizeArg(argc, argv, 1, 10000);
+    std::size_t versions = bench::sizeArg(argc, argv, 2, 1000);
+    if (versions == 0) versions = 1;
+    std::vector<int> base = bench::randomValues(elements, bench::DEFAULT_SEED, 0, 1000000);
+
+    std::printf("%zu elements, %zu versions kept alive (heap counts include malloc rounding)\n", elements,
+                versions);
+    std::printf("-- push + snapshot\n");
+    pushDeepStack(base, versions);
+    pushPersistentStack(base, versions);
+    pushDeepList(base, versions);
+    pushPersistentList(base, versions);
+
+    std::printf("-- insert at a random position + snapshot\n");
+    std::vector<std::size_t> positions = randomPositions(elements, versions);
+    insertDeepList(base, positions);
+    insertPersistentList(base, positions);
+    return 0;
+}
@@ -0,0 +1,275 @@
+// ============================================================================
+// pipelineBenchmark.cpp — multi-stage pipeline over bounded queues
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/pipelineBenchmark.cpp -o pipelineBenchmark
+// Run:
+//   ./pipelineBenchmark [items] [work rounds per stage]   (defaults: 500000, 64)
+//
+// Pipeline (4 threads, 3 queues):
+//   source --q1--> stage A --q2--> stage B --q3--> sink
+// The source stamps every item with its creation time; the sink records
+// (now - creation) as the item's end-to-end latency. Stages A and B do a
+// small fixed amount of hashing per item so they are not free.
+//
+// Queues compared:
+//   spin on isEmpty()  std::mutex + CircularQueue (simpleQueueImp.cpp);
+//                      consumers poll isEmpty()/isFull() and yield
+//                      (what chaining SimpleQueues looked like before)
+//   park only          BlockingQueue with spinning disabled: every wait is a
+//                      condition-variable (futex) sleep
+//   spin-then-park     BlockingQueue with the adaptive spin forced on
+//                      (it is off by default on a single-core machine)
+//   batched            BlockingQueue, default spin; stages move up to 64
+//                      items per lock round trip (pushBatch / drainTo)
+//
+// Columns: throughput, latency percentiles, CPU time per wall second
+// ("cpu/wall": 1.0 = one core fully busy) and how often threads parked.
+// With the queue full most of the time (the source never pauses), latency is
+// mostly time spent waiting in the queues, so capacity bounds it: that is
+// the backpressure effect. Both capacities are run to show it.
+//
+// On a machine with ONE hardware thread the picture changes: yield() in the
+// polling queue hands the core straight to the next stage (a cheap context
+// switch), spinning can never see progress, and cpu/wall is always ~1.0.
+// Compare cpu/wall on a multi-core machine, where polling keeps every stage
+// thread busy even when the pipeline is idle.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#define DS_NO_DEMO_MAIN
+namespace simplequeue {
+#include "../simpleQueueImp.cpp"
+}
+namespace blocking {
+#include "../blockingQueueImp.cpp"
+}
+
+namespace {
+
+struct Item {
+    std::uint64_t seq;
+    std::int64_t  bornNs;    // steady_clock time the source created it
+    std::uint64_t payload;
+};
+
+std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// A few rounds of a 64-bit mixer: stand-in for real per-item work
+std::uint64_t work(std::uint64_t x, unsigned rounds) {
+    for (unsigned i = 0; i < rounds; i++) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 29;
+    }
+    return x;
+}
+
+double cpuSeconds() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+
+// ----------------------------------------------------------------------------
+// The "before" queue: a mutex around CircularQueue and busy polling
+// ----------------------------------------------------------------------------
+template <std::size_t Capacity>
+class SpinPollQueue {
+public:
+    bool push(const Item& item) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> guard(lock_);
+                if (!queue_.isFull()) {
+                    queue_.enqueue(item);
+                    return true;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    bool pop(Item& out) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> guard(lock_);
+                if (!queue_.isEmpty()) {
+                    out = queue_.dequeue();
+                    return true;
+                }
+                if (closed_) return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> guard(lock_);
+        closed_ = true;
+    }
+
+    std::size_t parkCount() const { return 0; }
+
+private:
+    std::mutex lock_;
+    simplequeue::CircularQueue<Item, Capacity, errpolicy::Silent> queue_;
+    bool closed_ = false;
+};
+
+// ----------------------------------------------------------------------------
+// BlockingQueue one item at a time (pushWait / popWait)
+// ----------------------------------------------------------------------------
+template <std::size_t Capacity>
+class BlockingSingle {
+public:
+    explicit BlockingSingle(unsigned maxSpin) { queue_.setMaxSpin(maxSpin); }
+
+    bool push(const Item& item) { return queue_.pushWait(item); }
+    bool pop(Item& out) { return queue_.popWait(out); }
+    void close() { queue_.close(); }
+    std::size_t parkCount() const { return queue_.parkCount(); }
+
+private:
+    blocking::BlockingQueue<Item, Capacity> queue_;
+};
+
+// ----------------------------------------------------------------------------
+// Pipeline driver, one item per queue operation
+// ----------------------------------------------------------------------------
+struct Result {
+    double seconds;
+    double cpu;
+    std::size_t parks;
+    std::vector<std::int64_t> latencies;
+};
+
+template <typename Queue, typename Make>
+Result runSingle(std::size_t items, unsigned rounds, Make make) {
+    Queue q1 = make(), q2 = make(), q3 = make();
+    Result result;
+    result.latencies.reserve(items);
+
+    auto stage = [rounds](Queue& in, Queue& out) {
+        Item item;
+        while (in.pop(item)) {
+            item.payload = work(item.payload, rounds);
+            out.push(item);
+        }
+        out.close();
+    };
+
+    double cpuStart = cpuSeconds();
+    bench::Stopwatch watch;
+    std::thread source([&q1, items] {
+        for (std::size_t i = 0; i < items; i++) q1.push(Item{i, nowNs(), i});
+        q1.close();
+    });
+    std::thread stageA(stage, std::ref(q1), std::ref(q2));
+    std::thread stageB(stage, std::ref(q2), std::ref(q3));
+    Item item;
+    while (q3.pop(item)) result.latencies.push_back(nowNs() - item.bornNs);
+    source.join();
+    stageA.join();
+    stageB.join();
+    result.seconds = watch.seconds();
+    result.cpu = cpuSeconds() - cpuStart;
+    result.parks = q1.parkCount() + q2.parkCount() + q3.parkCount();
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Pipeline driver, batches of up to BATCH items (pushBatch / drainTo)
+// ----------------------------------------------------------------------------
+const std::size_t BATCH = 64;
+
+template <std::size_t Capacity>
+Result runBatched(std::size_t items, unsigned rounds) {
+    using Queue = blocking::BlockingQueue<Item, Capacity>;
+    Queue q1, q2, q3;
+    Result result;
+    result.latencies.reserve(items);
+
+    auto stage = [rounds](Queue& in, Queue& out) {
+        Item batch[BATCH];
+        while (std::size_t n = in.drainTo(batch, BATCH)) {
+            for (std::size_t i = 0; i < n; i++) batch[i].payload = work(batch[i].payload, rounds);
+            out.pushBatch(batch, n);
+        }
+        out.close();
+    };
+
+    double cpuStart = cpuSeconds();
+    bench::Stopwatch watch;
+    std::thread source([&q1, items] {
+        Item batch[BATCH];
+        for (std::size_t i = 0; i < items; i += BATCH) {
+            std::size_t n = std::min(BATCH, items - i);
+            for (std::size_t k = 0; k < n; k++) batch[k] = Item{i + k, nowNs(), i + k};
+            q1.pushBatch(batch, n);
+        }
+        q1.close();
+    });
+    std::thread stageA(stage, std::ref(q1), std::ref(q2));
+    std::thread stageB(stage, std::ref(q2), std::ref(q3));
+    Item batch[BATCH];
+    while (std::size_t n = q3.drainTo(batch, BATCH)) {
+        std::int64_t now = nowNs();
+        for (std::size_t i = 0; i < n; i++) result.latencies.push_back(now - batch[i].bornNs);
+    }
+    source.join();
+    stageA.join();
+    stageB.join();
+    result.seconds = watch.seconds();
+    result.cpu = cpuSeconds() - cpuStart;
+    result.parks = q1.parkCount() + q2.parkCount() + q3.parkCount();
+    return result;
+}
+
+// Latency at quantile q (0..1) in microseconds; sorts in place
+double percentileUs(std::vector<std::int64_t>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    std::size_t index = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1));
+    return static_cast<double>(sorted[index]) / 1e3;
+}
+
+void print(const char* label, std::size_t items, Result r) {
+    if (r.latencies.size() != items) {
+        std::fprintf(stderr, "%s: sink saw %zu of %zu items\n", label, r.latencies.size(), items);
+        std::exit(1);
+    }
+    std::sort(r.latencies.begin(), r.latencies.end());
+    std::printf("%-18s %10.0f items/s  p50 %9.1f us  p99 %9.1f us  p99.9 %9.1f us  cpu/wall %4.2f  parks %zu\n",
+                label, static_cast<double>(items) / r.seconds,
+                percentileUs(r.latencies, 0.50), percentileUs(r.latencies, 0.99),
+                percentileUs(r.latencies, 0.999), r.cpu / r.seconds, r.parks);
+}
+
+template <std::size_t Capacity>
+void runAll(std::size_t items, unsigned rounds) {
+    std::printf("-- queue capacity %zu, %zu items, %u work rounds per stage\n", Capacity, items, rounds);
+    print("spin on isEmpty()", items,
+          runSingle<SpinPollQueue<Capacity>>(items, rounds, [] { return SpinPollQueue<Capacity>(); }));
+    print("park only", items,
+          runSingle<BlockingSingle<Capacity>>(items, rounds, [] { return BlockingSingle<Capacity>(0); }));
+    print("spin-then-park", items,
+          runSingle<BlockingSingle<Capacity>>(items, rounds, [] { return BlockingSingle<Capacity>(4096); }));
+    print("batched (64)", items, runBatched<Capacity>(items, rounds));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t items = bench::sizeArg(argc, argv, 1, 500000);
+    unsigned rounds = static_cast<unsigned>(bench::sizeArg(argc, argv, 2, 64));
+
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+    runAll<64>(items, rounds);
+    runAll<1024>(items, rounds);
+    return 0;
+}
@@ -0,0 +1,209 @@
+// ============================================================================
+// prefetchBenchmark.cpp — batched and interleaved pointer-chasing lookups
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/prefetchBenchmark.cpp -o prefetchBenchmark
+// Run:
+//   ./prefetchBenchmark [nodes] [queries] [listLength]
+//   (defaults: 2000000, 16, 32)
+//
+// All lists hold `nodes` ints in total, built so that consecutive nodes are
+// scattered over the heap (see each section); at the default size the
+// nodes take ~64 MB, far more than the last-level cache, so every step of a
+// walk is a cache miss. ChainPrefetch.h explains the two techniques.
+//
+// 1) One big list, `queries` lookups
+//      searchNode x queries        one walk per lookup (LinkedList)
+//      searchMany                  all lookups in one prefetched walk
+//      std::next x queries         DoublyLinkedList, one walk per position
+//      getAtPositions              all positions in one prefetched walk
+//
+// 2) Many short lists (nodes / listLength lists), one lookup in EACH list,
+//    like probing the buckets of a chained hash table
+//      searchNode per list         the plain loop: one miss in flight
+//      findMany, group G           G walks interleaved (G = 1 is the plain
+//                                  loop through the same scheduler)
+//      advanceMany, group G        walk a random number of steps per list
+//
+// Each row prints ns per lookup and a checksum (identical within a section).
+// The speedup from interleaving depends on how many misses the CPU and the
+// memory system can keep in flight; on a VM or a single shared core it is
+// usually smaller than on bare metal.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <iterator>
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+
+namespace {
+
+using List = singly::LinkedList<int>;
+using ListNode = singly::Node<int>;
+
+void line(const char* label, std::size_t lookups, double seconds, long long checksum) {
+    std::printf("%-28s %10.1f ns/lookup   checksum %lld\n", label,
+                seconds * 1e9 / static_cast<double>(lookups), checksum);
+}
+
+// Half the keys are present (copied from the list), half are not
+std::vector<int> mixedKeys(const std::vector<int>& values, std::size_t count, std::mt19937& rng) {
+    std::vector<int> keys(count);
+    for (std::size_t i = 0; i < count; i++) {
+        keys[i] = (i % 2 == 0) ? values[rng() % values.size()] : -1 - static_cast<int>(rng() % 1000);
+    }
+    return keys;
+}
+
+// ----------------------------------------------------------------------------
+// 1) One big list
+// ----------------------------------------------------------------------------
+void benchOneList(std::size_t nodes, std::size_t queries) {
+    std::printf("-- one list of %zu nodes, %zu lookups\n", nodes, queries);
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<int> values = bench::randomValues(nodes, bench::DEFAULT_SEED, 0, 1 << 30);
+
+    // Random values, then sort(): merge sort relinks the nodes, so list
+    // order no longer follows allocation order
+    std::vector<int> keys = mixedKeys(values, queries, rng);
+    {
+        List list;
+        for (int v : values) list.insertAtBeggining(v);
+        list.sort();
+        {
+            long long found = 0;
+            bench::Stopwatch watch;
+            for (int key : keys) found += list.searchNode(key) ? 1 : 0;
+            line("searchNode x queries", queries, watch.seconds(), found);
+        }
+        {
+            std::unique_ptr<bool[]> present(new bool[queries]);
+            bench::Stopwatch watch;
+            list.searchMany(keys.data(), queries, present.get());
+            double seconds = watch.seconds();
+            long long found = 0;
+            for (std::size_t i = 0; i < queries; i++) found += present[i] ? 1 : 0;
+            line("searchMany", queries, seconds, found);
+        }
+    }
+
+    // DoublyLinkedList: insertAtFront at random positions would be O(n^2),
+    // so scatter the same way (random values, then sort)
+    doubly::DoublyLinkedList<int> dll;
+    for (int v : values) dll.insertAtFront(v);
+    dll.sort();
+    std::vector<int> positions(queries);
+    for (int& p : positions) p = 1 + static_cast<int>(rng() % nodes);
+
+    {
+        long long sum = 0;
+        bench::Stopwatch watch;
+        for (int p : positions) sum += *std::next(dll.begin(), p - 1);
+        line("std::next x queries", queries, watch.seconds(), sum);
+    }
+    {
+        std::vector<int> out(queries);
+        std::unique_ptr<bool[]> inRange(new bool[queries]);
+        bench::Stopwatch watch;
+        dll.getAtPositions(positions.data(), queries, out.data(), inRange.get());
+        double seconds = watch.seconds();
+        long long sum = 0;
+        for (int v : out) sum += v;
+        line("getAtPositions", queries, seconds, sum);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// 2) Many short lists
+// ----------------------------------------------------------------------------
+void benchManyLists(std::size_t nodes, std::size_t listLength) {
+    std::size_t listCount = std::max<std::size_t>(nodes / listLength, 1);
+    std::printf("-- %zu lists of %zu nodes, one lookup per list\n", listCount, listLength);
+    std::mt19937 rng(bench::DEFAULT_SEED + 1);
+
+    // Append to a random list each time: neighbours in a list end up far
+    // apart on the heap, as in a long-lived hash table
+    std::vector<List> lists(listCount);
+    std::vector<int> values;
+    values.reserve(listCount * listLength);
+    std::vector<std::size_t> order;
+    order.reserve(listCount * listLength);
+    for (std::size_t l = 0; l < listCount; l++) order.insert(order.end(), listLength, l);
+    std::shuffle(order.begin(), order.end(), rng);
+    for (std::size_t l : order) {
+        int v = static_cast<int>(rng() % (1u << 30));
+        lists[l].insertAtBeggining(v);
+        values.push_back(v);
+    }
+
+    // Lookup j goes to list j; half hit (a value of that list), half miss
+    std::vector<int> keys(listCount);
+    std::vector<const ListNode*> starts(listCount);
+    for (std::size_t l = 0; l < listCount; l++) {
+        starts[l] = lists[l].begin().node();
+        keys[l] = (l % 2 == 0) ? *std::next(lists[l].begin(), static_cast<long>(rng() % listLength))
+                               : -1 - static_cast<int>(l);
+    }
+    std::vector<const ListNode*> found(listCount);
+
+    {
+        long long hits = 0;
+        bench::Stopwatch watch;
+        for (std::size_t l = 0; l < listCount; l++) hits += lists[l].searchNode(keys[l]) ? 1 : 0;
+        line("searchNode per list", listCount, watch.seconds(), hits);
+    }
+    for (std::size_t group : {1, 4, 8, 16, 32}) {
+        bench::Stopwatch watch;
+        chainwalk::findMany(starts.data(), keys.data(), listCount, found.data(), group);
+        double seconds = watch.seconds();
+        long long hits = 0;
+        for (const ListNode* node : found) hits += node != nullptr ? 1 : 0;
+        char label[64];
+        std::snprintf(label, sizeof(label), "findMany, group %zu", group);
+        line(label, listCount, seconds, hits);
+    }
+
+    std::vector<std::size_t> steps(listCount);
+    for (std::size_t& s : steps) s = rng() % listLength;
+    {
+        long long sum = 0;
+        bench::Stopwatch watch;
+        for (std::size_t l = 0; l < listCount; l++) {
+            sum += *std::next(lists[l].begin(), static_cast<long>(steps[l]));
+        }
+        line("std::next per list", listCount, watch.seconds(), sum);
+    }
+    for (std::size_t group : {1, 8, 16}) {
+        bench::Stopwatch watch;
+        chainwalk::advanceMany(starts.data(), steps.data(), listCount, found.data(), group);
+        double seconds = watch.seconds();
+        long long sum = 0;
+        for (const ListNode* node : found) sum += node->data;
+        char label[64];
+        std::snprintf(label, sizeof(label), "advanceMany, group %zu", group);
+        line(label, listCount, seconds, sum);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t nodes = bench::sizeArg(argc, argv, 1, 2000000);
+    std::size_t queries = bench::sizeArg(argc, argv, 2, 16);
+    std::size_t listLength = bench::sizeArg(argc, argv, 3, 32);
+    if (nodes == 0) nodes = 1;
+    if (queries == 0) queries = 1;
+    if (listLength == 0) listLength = 1;
+
+    benchOneList(nodes, queries);
+    benchManyLists(nodes, listLength);
+    return 0;
+}
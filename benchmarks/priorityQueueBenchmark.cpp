@@ -0,0 +1,242 @@
+// ============================================================================
+// priorityQueueBenchmark.cpp — DaryHeap / PairingHeap vs std::priority_queue
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/priorityQueueBenchmark.cpp -o priorityQueueBenchmark
+// Run:
+//   ./priorityQueueBenchmark [elements]      (default: 1000000)
+//
+// Every queue pops the SMALLEST key first (std::priority_queue gets
+// std::greater so its order matches). All runs use errpolicy::Silent.
+//
+// Sections:
+//   1) push n random keys, then pop them all
+//   2) build from a range: std::priority_queue's container constructor
+//      (std::make_heap), DaryHeap::heapify (Floyd, O(n)), n x enqueue.
+//      DaryHeap's times include filling its id/slot tables for handles,
+//      which std::priority_queue does not have.
+//   3) decrease-key heavy ("Dijkstra-like"): every pop is followed by 4
+//      decreaseKey calls on random elements still in the queue.
+//      std::priority_queue has no decrease-key, so it uses the usual
+//      workaround: push a duplicate with the new key and skip stale entries
+//      when they surface (lazy deletion); its size grows accordingly.
+// Each section prints a checksum of the popped sequence; equal checksums
+// mean every implementation produced the same order.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <queue>
+
+#define DS_NO_DEMO_MAIN
+namespace pq {
+#include "../priorityQueueImp.cpp"
+}
+
+namespace {
+
+using Key = std::uint64_t;
+using StdMinQueue = std::priority_queue<Key, std::vector<Key>, std::greater<Key>>;
+template <std::size_t Arity>
+using Dary = pq::DaryHeap<Key, Arity, std::less<Key>, errpolicy::Silent>;
+using Pairing = pq::PairingHeap<Key, std::less<Key>, errpolicy::Silent>;
+
+std::vector<Key> randomKeys(std::size_t n) {
+    std::vector<int> values = bench::randomValues(n);
+    return std::vector<Key>(values.begin(), values.end());
+}
+
+// Order-sensitive checksum of a pop sequence
+struct Checksum {
+    Key value = 0;
+    void add(Key k) { value = value * 1000003u + k; }
+};
+
+void line(const char* label, std::size_t n, double seconds, const Checksum& sum) {
+    std::printf("%-34s n=%-9zu %9.2f ms %8.2f ns/op   checksum %016llx\n", label, n, seconds * 1e3,
+                seconds * 1e9 / static_cast<double>(n), static_cast<unsigned long long>(sum.value));
+}
+
+// ----------------------------------------------------------------------------
+// 1) push all, pop all
+// ----------------------------------------------------------------------------
+template <typename Queue>
+void pushPopOurs(const char* label, const std::vector<Key>& keys) {
+    Queue q;
+    Checksum sum;
+    bench::Stopwatch watch;
+    for (Key k : keys) q.enqueue(k);
+    while (!q.isEmpty()) sum.add(q.dequeue());
+    line(label, keys.size(), watch.seconds(), sum);
+}
+
+void pushPopStd(const std::vector<Key>& keys) {
+    StdMinQueue q;
+    Checksum sum;
+    bench::Stopwatch watch;
+    for (Key k : keys) q.push(k);
+    while (!q.empty()) {
+        sum.add(q.top());
+        q.pop();
+    }
+    line("std::priority_queue", keys.size(), watch.seconds(), sum);
+}
+
+// ----------------------------------------------------------------------------
+// 2) build from a range (the pops are not timed, only checked)
+// ----------------------------------------------------------------------------
+template <typename Queue, typename Build>
+void buildCase(const char* label, const std::vector<Key>& keys, Build build) {
+    Queue q;
+    bench::Stopwatch watch;
+    build(q);
+    double seconds = watch.seconds();
+    Checksum sum;
+    while (!q.isEmpty()) sum.add(q.dequeue());
+    line(label, keys.size(), seconds, sum);
+}
+
+void buildStd(const std::vector<Key>& keys) {
+    // Copy first (untimed) and move it in, so only std::make_heap is timed:
+    // first-touch page faults on a fresh copy can cost more than the heapify
+    std::vector<Key> copy(keys);
+    bench::Stopwatch watch;
+    StdMinQueue q(std::greater<Key>(), std::move(copy));
+    double seconds = watch.seconds();
+    Checksum sum;
+    while (!q.empty()) {
+        sum.add(q.top());
+        q.pop();
+    }
+    line("std::priority_queue(range)", keys.size(), seconds, sum);
+}
+
+// ----------------------------------------------------------------------------
+// 3) decrease-key heavy
+//
+// Key layout: (priority << 32) | element id, so every key is unique and the
+// id of a popped key is its low 32 bits. A decrease lowers the priority.
+// The random choices depend only on the sequence of live elements, which is
+// identical for every implementation, so the checksums must match.
+// ----------------------------------------------------------------------------
+const int DECREASES_PER_POP = 4;
+
+struct DecreasePlan {
+    std::vector<Key> current;        // current key of every element
+    std::vector<std::uint32_t> live; // ids still queued (swap-remove)
+    std::vector<std::size_t> where;  // position of each id inside `live`
+    std::mt19937 rng{bench::DEFAULT_SEED};
+
+    explicit DecreasePlan(const std::vector<Key>& keys) : where(keys.size()) {
+        for (std::size_t id = 0; id < keys.size(); id++) {
+            current.push_back((keys[id] << 32) | id);
+            live.push_back(static_cast<std::uint32_t>(id));
+            where[id] = id;
+        }
+    }
+
+    void popped(Key key) {
+        std::uint32_t id = static_cast<std::uint32_t>(key & 0xffffffffu);
+        std::uint32_t last = live.back();
+        live[where[id]] = last;
+        where[last] = where[id];
+        live.pop_back();
+    }
+
+    // Pick a live element and compute its lowered key
+    std::uint32_t pick(Key& newKey) {
+        std::uint32_t id = live[rng() % live.size()];
+        Key priority = current[id] >> 32;
+        priority -= std::min<Key>(priority, rng() % 1000);
+        newKey = (priority << 32) | id;
+        current[id] = newKey;
+        return id;
+    }
+};
+
+template <typename Queue>
+void decreaseOurs(const char* label, const std::vector<Key>& keys) {
+    DecreasePlan plan(keys);
+    Queue q;
+    std::vector<typename Queue::Handle> handles;
+    handles.reserve(keys.size());
+    Checksum sum;
+    std::size_t ops = 0;
+    bench::Stopwatch watch;
+    for (Key k : plan.current) handles.push_back(q.enqueue(k));
+    while (!q.isEmpty()) {
+        Key best = q.dequeue();
+        sum.add(best);
+        plan.popped(best);
+        ops++;
+        for (int d = 0; d < DECREASES_PER_POP && !plan.live.empty(); d++) {
+            Key newKey;
+            std::uint32_t id = plan.pick(newKey);
+            q.decreaseKey(handles[id], newKey);
+            ops++;
+        }
+    }
+    line(label, ops, watch.seconds(), sum);
+}
+
+void decreaseStd(const std::vector<Key>& keys) {
+    DecreasePlan plan(keys);
+    StdMinQueue q;
+    Checksum sum;
+    std::size_t ops = 0;
+    std::size_t peak = 0;
+    bench::Stopwatch watch;
+    for (Key k : plan.current) q.push(k);
+    while (!q.empty()) {
+        Key best = q.top();
+        q.pop();
+        std::uint32_t id = static_cast<std::uint32_t>(best & 0xffffffffu);
+        if (plan.current[id] != best || plan.where[id] >= plan.live.size() || plan.live[plan.where[id]] != id) {
+            continue;   // stale duplicate (key was lowered, or already popped)
+        }
+        sum.add(best);
+        plan.popped(best);
+        ops++;
+        for (int d = 0; d < DECREASES_PER_POP && !plan.live.empty(); d++) {
+            Key newKey;
+            plan.pick(newKey);
+            q.push(newKey);
+            ops++;
+        }
+        peak = std::max(peak, q.size());
+    }
+    double seconds = watch.seconds();
+    line("std::priority_queue (lazy)", ops, seconds, sum);
+    std::printf("%-34s peak size %zu for %zu live elements\n", "", peak, keys.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::sizeArg(argc, argv, 1, 1000000);
+    std::vector<Key> keys = randomKeys(n);
+
+    std::printf("-- 1) push n, pop n\n");
+    pushPopStd(keys);
+    pushPopOurs<Dary<2>>("DaryHeap<2> (binary)", keys);
+    pushPopOurs<Dary<4>>("DaryHeap<4>", keys);
+    pushPopOurs<Dary<8>>("DaryHeap<8>", keys);
+    pushPopOurs<Pairing>("PairingHeap", keys);
+
+    std::printf("-- 2) build from range\n");
+    buildStd(keys);
+    buildCase<Dary<4>>("DaryHeap<4>::heapify", keys, [&](Dary<4>& q) { q.heapify(keys.begin(), keys.end()); });
+    buildCase<Dary<4>>("DaryHeap<4> n x enqueue", keys, [&](Dary<4>& q) {
+        for (Key k : keys) q.enqueue(k);
+    });
+    buildCase<Pairing>("PairingHeap n x enqueue", keys, [&](Pairing& q) {
+        for (Key k : keys) q.enqueue(k);
+    });
+
+    std::printf("-- 3) pop + %d decreaseKey per pop (ns/op counts pops and decreases)\n", DECREASES_PER_POP);
+    decreaseStd(keys);
+    decreaseOurs<Dary<2>>("DaryHeap<2> (binary)", keys);
+    decreaseOurs<Dary<4>>("DaryHeap<4>", keys);
+    decreaseOurs<Pairing>("PairingHeap", keys);
+    return 0;
+}
@@ -0,0 +1,221 @@
+// ============================================================================
+// rcuBenchmark.cpp — reader throughput with and without a concurrent writer
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/rcuBenchmark.cpp -o rcuBenchmark
+// Run:
+//   ./rcuBenchmark [elements] [readers] [milliseconds per run]
+//                                              (defaults: 100, 4, 500)
+//
+// `readers` threads look up random keys of a table of `elements` ints for a
+// fixed time while one writer keeps changing it:
+//   no writer      readers only
+//   10 writes/s    the writer sleeps 100 ms between updates (config reload)
+//   busy writer    the writer updates in a loop, yielding after each update
+// An update replaces one entry (RcuList::updateValue; deleteByValue +
+// insertAtFront for the locked list), so the size never changes.
+//
+// Tables compared:
+//   rwlock     std::shared_mutex + DoublyLinkedList (doublyLinkedList.cpp):
+//              each lookup takes the lock shared (an atomic read-modify-
+//              write on one shared counter), each update takes it exclusive
+//   RCU        RcuList (rcuList.cpp): lookups take nothing; readers call
+//              quiescent() every 64 lookups
+//   RCU unreg  the same list read by threads that never create a Reader:
+//              each lookup goes online/offline around itself (one fence;
+//              the thread's slot number is taken once and kept)
+//
+// Columns:
+//   lookups/s        all readers together (wall clock, millions)
+//   per reader-CPU-s lookups per second of CPU time the readers actually
+//                    got (millions). On a machine with fewer cores than
+//                    threads the writer takes CPU time away from the
+//                    readers; this column removes that effect and shows the
+//                    cost of the read path itself
+//   updates          updates the writer completed
+//   retired          RCU only: nodes still waiting for a grace period
+//
+// What to look for: the RCU rows stay flat whatever the writer does, and the
+// writer gets its updates through. With the rwlock the writer STARVES: a
+// reader-preferring std::shared_mutex (glibc) lets a steady stream of readers
+// hold it off, so "10 writes/s" typically completes 1 update per run
+// instead of 5, and readers still stall while it waits.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <shared_mutex>
+#include <time.h>   // clock_gettime(CLOCK_THREAD_CPUTIME_ID)
+
+#define DS_NO_DEMO_MAIN
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+namespace rcu {
+#include "../rcuList.cpp"
+}
+
+namespace {
+
+double threadCpuSeconds() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) * 1e-9;
+}
+
+// ----------------------------------------------------------------------------
+// The two tables behind one interface
+// ----------------------------------------------------------------------------
+class LockedTable {
+public:
+    struct Reader {
+        explicit Reader(const LockedTable&) {}
+        void quiescent() {}
+    };
+
+    void add(int v) { list_.insertAtFront(v); }
+    bool contains(int v) const {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        return std::find(list_.begin(), list_.end(), v) != list_.end();
+    }
+    void update(int oldVal, int newVal) {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        list_.deleteByValue(oldVal);
+        list_.insertAtFront(newVal);
+    }
+    std::size_t pending() const { return 0; }
+
+private:
+    mutable std::shared_mutex lock_;
+    doubly::DoublyLinkedList<int> list_;
+};
+
+class RcuTable {
+public:
+    using Reader = rcu::RcuList<int>::Reader;
+
+    void add(int v) { list_.insertAtEnd(v); }
+    bool contains(int v) const { return list_.searchNode(v); }
+    void update(int oldVal, int newVal) { list_.updateValue(oldVal, newVal); }
+    std::size_t pending() const { return list_.pendingReclaim(); }
+    // so `Reader reader(table)` registers with the list
+    operator const rcu::RcuList<int>&() const { return list_; }
+
+private:
+    rcu::RcuList<int> list_;
+};
+
+// Readers that never register: searchNode() makes its own read section
+class UnregisteredRcuTable : public RcuTable {
+public:
+    struct Reader {
+        explicit Reader(const UnregisteredRcuTable&) {}
+        void quiescent() {}
+    };
+};
+
+enum class Writer { None, Slow, Busy };
+
+struct Result {
+    double lookupsPerSecond;
+    double lookupsPerCpuSecond;
+    long long updates;
+    std::size_t pending;
+};
+
+template <typename Table>
+Result run(std::size_t elements, unsigned readers, double seconds, Writer mode) {
+    Table table;
+    for (std::size_t i = 0; i < elements; i++) table.add(static_cast<int>(i));
+
+    std::atomic<bool> stop{false};
+    std::vector<long long> lookups(readers, 0);
+    std::vector<double> cpu(readers, 0.0);
+    std::vector<std::thread> threads;
+    for (unsigned r = 0; r < readers; r++) {
+        threads.emplace_back([&, r] {
+            typename Table::Reader reader(table);
+            std::mt19937 rng(bench::DEFAULT_SEED + r);
+            std::uniform_int_distribution<int> key(0, static_cast<int>(elements) - 1);
+            double cpuStart = threadCpuSeconds();
+            long long done = 0, hits = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 64; i++) hits += table.contains(key(rng));
+                reader.quiescent();
+                done += 64;
+            }
+            bench::doNotOptimize(hits);
+            lookups[r] = done;
+            cpu[r] = threadCpuSeconds() - cpuStart;
+        });
+    }
+
+    // The writer swaps the last key with a key outside the lookup range and back
+    long long updates = 0;
+    std::thread writer;
+    if (mode != Writer::None) {
+        writer = std::thread([&] {
+            int a = static_cast<int>(elements) - 1;
+            int b = static_cast<int>(elements) + 1;
+            while (!stop.load(std::memory_order_relaxed)) {
+                table.update(a, b);
+                std::swap(a, b);
+                updates++;
+                if (mode == Writer::Slow) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                else std::this_thread::yield();
+            }
+        });
+    }
+
+    bench::Stopwatch watch;
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stop = true;
+    for (std::thread& t : threads) t.join();
+    if (writer.joinable()) writer.join();
+    double wall = watch.seconds();
+
+    long long total = 0;
+    double cpuTotal = 0.0;
+    for (unsigned r = 0; r < readers; r++) {
+        total += lookups[r];
+        cpuTotal += cpu[r];
+    }
+    Result result;
+    result.lookupsPerSecond = static_cast<double>(total) / wall;
+    result.lookupsPerCpuSecond = cpuTotal > 0 ? static_cast<double>(total) / cpuTotal : 0.0;
+    result.updates = updates;
+    result.pending = table.pending();
+    return result;
+}
+
+template <typename Table>
+void runAll(const char* name, std::size_t elements, unsigned readers, double seconds) {
+    const struct {
+        const char* label;
+        Writer mode;
+    } modes[] = {{"no writer", Writer::None}, {"10 writes/s", Writer::Slow}, {"busy writer", Writer::Busy}};
+    for (const auto& m : modes) {
+        Result r = run<Table>(elements, readers, seconds, m.mode);
+        std::printf("%-10s %-13s %12.3f %18.3f %10lld %9zu\n", name, m.label, r.lookupsPerSecond / 1e6,
+                    r.lookupsPerCpuSecond / 1e6, r.updates, r.pending);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t elements = bench::sizeArg(argc, argv, 1, 100);
+    unsigned readers = static_cast<unsigned>(bench::sizeArg(argc, argv, 2, 4));
+    double seconds = static_cast<double>(bench::sizeArg(argc, argv, 3, 500)) / 1000.0;
+    if (elements < 2) elements = 2;
+    if (readers == 0) readers = 1;
+
+    std::printf("%zu elements, %u readers, %.0f ms per run, %u hardware threads\n", elements, readers,
+                seconds * 1e3, std::thread::hardware_concurrency());
+    std::printf("%-10s %-13s %12s %18s %10s %9s\n", "table", "writer", "lookups/s M", "per reader-CPU-s M",
+                "updates", "retired");
+    runAll<LockedTable>("rwlock", elements, readers, seconds);
+    runAll<RcuTable>("RCU", elements, readers, seconds);
+    runAll<UnregisteredRcuTable>("RCU unreg", elements, readers, seconds);
+    return 0;
+}
@@ -0,0 +1,256 @@
+// ============================================================================
+// ringDequeBenchmark.cpp — byte streams through a deque (RingDeque.h)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/ringDequeBenchmark.cpp -o ringDequeBenchmark
+// Run:
+//   ./ringDequeBenchmark [MiB streamed] [palindrome length]  (defaults: 64, 1000000)
+//
+// 1. Pipe: `MiB streamed` of random bytes go through a deque used as a pipe
+//    buffer that holds about 1 MiB: chunks of 4000 bytes are pushed at the
+//    rear and, once the buffer is full, a chunk is popped from the front to
+//    an output buffer. 4000 does not divide the ring's capacity, so the
+//    window drifts round the ring and every ~260th chunk straddles the wrap.
+//      TemplatedDeque<char>   insertRear / deleteFront per byte (a node each)
+//      std::deque<char>       push_back / pop_front per byte
+//      std::deque<char> bulk  insert(end, range) / copy + erase(range)
+//      RingDeque per byte     insertRear / deleteFront per byte
+//      RingDeque bulk, heap   pushBackBulk / popFrontBulk, split at the wrap
+//      RingDeque bulk, mirror the same on a double-mapped buffer: one memcpy
+//    Columns: MB/s through the pipe, and the output's checksum (every row
+//    must agree).
+//
+// 2. Palindrome: a `palindrome length` character palindrome is checked by
+//    popping from both ends (TemplatedDeque, std::deque, RingDeque), and by
+//    comparing RingDeque's contiguous() view from both ends.
+//
+// 3. contiguous(): the cost of getting a wrapped 1 MiB ring as one array,
+//    mirrored (free) vs heap (rotated in place).
+//
+// Typical (1-core VM): the node deque manages ~30 MB/s, per-byte std::deque
+// and RingDeque 200-300 MB/s, and the bulk paths run at memcpy speed: ~5 GB/s
+// for std::deque, 7-13 GB/s for RingDeque. The mirrored copy is NOT faster
+// than the split one (one extra memcpy call per wrap costs nothing next to
+// 4000 bytes of copying, and shared-memory pages fault in a little slower);
+// what the mirror buys is contiguous() for free (0.1 us vs ~0.7 ms). The
+// palindrome check runs ~25-40x faster than on TemplatedDeque.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <deque>
+
+namespace {
+
+const std::size_t CHUNK = 4000;
+const std::size_t WINDOW = std::size_t(1) << 20;
+const std::size_t CHUNKS_IN_INPUT = 256;
+
+std::uint64_t checksum(const char* data, std::size_t n, std::uint64_t sum) {
+    for (std::size_t i = 0; i < n; i++) sum = sum * 31 + static_cast<unsigned char>(data[i]);
+    return sum;
+}
+
+// Per-byte and bulk pipes behind one interface
+struct NodePipe {
+    TemplatedDeque<char> deque;
+    void push(const char* data, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) deque.insertRear(data[i]);
+    }
+    void pop(std::size_t n, char* out) {
+        for (std::size_t i = 0; i < n; i++) out[i] = deque.deleteFront();
+    }
+    std::size_t size() const { return deque.size(); }
+};
+
+struct StdPipe {
+    std::deque<char> deque;
+    void push(const char* data, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) deque.push_back(data[i]);
+    }
+    void pop(std::size_t n, char* out) {
+        for (std::size_t i = 0; i < n; i++) {
+            out[i] = deque.front();
+            deque.pop_front();
+        }
+    }
+    std::size_t size() const { return deque.size(); }
+};
+
+struct StdBulkPipe {
+    std::deque<char> deque;
+    void push(const char* data, std::size_t n) { deque.insert(deque.end(), data, data + n); }
+    void pop(std::size_t n, char* out) {
+        std::copy(deque.begin(), deque.begin() + static_cast<std::ptrdiff_t>(n), out);
+        deque.erase(deque.begin(), deque.begin() + static_cast<std::ptrdiff_t>(n));
+    }
+    std::size_t size() const { return deque.size(); }
+};
+
+struct RingPipe {
+    RingDeque<char> deque;
+    explicit RingPipe(bool mirror) : deque(WINDOW + CHUNK, mirror) {}
+    void push(const char* data, std::size_t n) {
+        for (std::size_t i = 0; i < n; i++) deque.insertRear(data[i]);
+    }
+    void pop(std::size_t n, char* out) {
+        for (std::size_t i = 0; i < n; i++) out[i] = deque.deleteFront();
+    }
+    std::size_t size() const { return deque.size(); }
+};
+
+struct RingBulkPipe {
+    RingDeque<char> deque;
+    explicit RingBulkPipe(bool mirror) : deque(WINDOW + CHUNK, mirror) {}
+    void push(const char* data, std::size_t n) { deque.pushBackBulk(data, n); }
+    void pop(std::size_t n, char* out) { deque.popFrontBulk(n, out); }
+    std::size_t size() const { return deque.size(); }
+};
+
+template <typename Pipe>
+void runPipe(const char* label, Pipe& pipe, const std::vector<char>& input, std::size_t total) {
+    std::vector<char> out(CHUNK);
+    std::uint64_t sum = 0;
+    std::size_t fed = 0;
+    bench::Stopwatch watch;
+    while (fed < total) {
+        pipe.push(input.data() + (fed / CHUNK % CHUNKS_IN_INPUT) * CHUNK, CHUNK);
+        fed += CHUNK;
+        if (pipe.size() > WINDOW) {
+            pipe.pop(CHUNK, out.data());
+            sum = checksum(out.data(), 64, sum);   // sample the output, keep it live
+        }
+    }
+    double seconds = watch.seconds();
+    std::printf("  %-26s %10.1f MB/s   checksum %016llx\n", label, static_cast<double>(total) / seconds / 1e6,
+                static_cast<unsigned long long>(sum));
+}
+
+// ----------------------------------------------------------------------------
+// Palindrome checks
+// ----------------------------------------------------------------------------
+template <typename Deque>
+bool popBothEnds(Deque& deque) {
+    while (deque.size() > 1) {
+        if (deque.deleteFront() != deque.deleteRear()) return false;
+    }
+    return true;
+}
+
+bool popBothEnds(std::deque<char>& deque) {
+    while (deque.size() > 1) {
+        if (deque.front() != deque.back()) return false;
+        deque.pop_front();
+        deque.pop_back();
+    }
+    return true;
+}
+
+bool compareView(RingDeque<char>& deque) {
+    const char* text = deque.contiguous();
+    std::size_t n = deque.size();
+    for (std::size_t i = 0; i < n / 2; i++) {
+        if (text[i] != text[n - 1 - i]) return false;
+    }
+    return true;
+}
+
+template <typename Fill, typename Check>
+void runPalindrome(const char* label, Fill fill, Check check) {
+    bench::Stopwatch watch;
+    bool result = check(fill());
+    std::printf("  %-26s %10.2f ms   %s\n", label, watch.seconds() * 1e3, result ? "palindrome" : "not palindrome");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t total = bench::sizeArg(argc, argv, 1, 64) << 20;
+    std::size_t length = bench::sizeArg(argc, argv, 2, 1000000);
+    if (total < 2 * WINDOW) total = 2 * WINDOW;
+
+    // Input: 256 chunks of random bytes, replayed chunk by chunk
+    std::vector<char> input(CHUNKS_IN_INPUT * CHUNK);
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    for (char& c : input) c = static_cast<char>(rng());
+
+    std::printf("-- pipe: %zu MiB in chunks of %zu bytes, ~%zu KiB buffered\n", total >> 20, CHUNK, WINDOW >> 10);
+    {
+        NodePipe pipe;
+        runPipe("TemplatedDeque<char>", pipe, input, total);
+    }
+    {
+        StdPipe pipe;
+        runPipe("std::deque<char>", pipe, input, total);
+    }
+    {
+        StdBulkPipe pipe;
+        runPipe("std::deque<char> bulk", pipe, input, total);
+    }
+    {
+        RingPipe pipe(false);
+        runPipe("RingDeque per byte", pipe, input, total);
+    }
+    {
+        RingBulkPipe pipe(false);
+        runPipe("RingDeque bulk, heap", pipe, input, total);
+    }
+    {
+        RingBulkPipe pipe(true);
+        runPipe(pipe.deque.isMirrored() ? "RingDeque bulk, mirror" : "RingDeque bulk (no mirror)", pipe, input,
+                total);
+    }
+
+    // A palindrome of `length` lowercase letters
+    std::string word(length, 'a');
+    for (std::size_t i = 0; i < length / 2; i++) word[i] = word[length - 1 - i] = static_cast<char>('a' + rng() % 26);
+
+    std::printf("-- palindrome check, %zu characters (filling included)\n", length);
+    runPalindrome(
+        "TemplatedDeque<char>",
+        [&] {
+            auto deque = std::make_unique<TemplatedDeque<char>>();
+            for (char c : word) deque->insertRear(c);
+            return deque;
+        },
+        [](std::unique_ptr<TemplatedDeque<char>> deque) { return popBothEnds(*deque); });
+    runPalindrome(
+        "std::deque<char>", [&] { return std::deque<char>(word.begin(), word.end()); },
+        [](std::deque<char> deque) { return popBothEnds(deque); });
+    runPalindrome(
+        "RingDeque, pop both ends",
+        [&] {
+            RingDeque<char> deque;
+            deque.pushBackBulk(word.data(), word.size());
+            return deque;
+        },
+        [](RingDeque<char> deque) { return popBothEnds(deque); });
+    runPalindrome(
+        "RingDeque, contiguous()",
+        [&] {
+            RingDeque<char> deque;
+            deque.pushBackBulk(word.data(), word.size());
+            return deque;
+        },
+        [](RingDeque<char> deque) { return compareView(deque); });
+
+    // contiguous() on a ring whose contents straddle the wrap point
+    std::printf("-- contiguous() of a wrapped %zu KiB ring\n", WINDOW >> 10);
+    for (bool mirror : {true, false}) {
+        RingDeque<char> deque(WINDOW, mirror);
+        std::size_t half = deque.capacity() / 2;
+        deque.pushBackBulk(input.data(), half);
+        deque.pushBackBulk(input.data(), half);
+        deque.popFrontBulk(half, nullptr);
+        deque.pushBackBulk(input.data() + 1, half);   // now wrapped in the middle
+        bench::Stopwatch watch;
+        const char* text = deque.contiguous();
+        double seconds = watch.seconds();
+        bench::doNotOptimize(text);
+        bool same = std::memcmp(text, input.data(), half) == 0 && std::memcmp(text + half, input.data() + 1, half) == 0;
+        std::printf("  %-26s %10.1f us   %s\n", deque.isMirrored() ? "mirrored" : "heap (rotate)", seconds * 1e6,
+                    same ? "contents ok" : "CONTENTS DIFFER");
+        if (!same) return 1;
+    }
+    return 0;
+}
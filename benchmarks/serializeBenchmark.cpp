@@ -0,0 +1,187 @@
+// ============================================================================
+// serializeBenchmark.cpp — saving and loading containers: text vs binary
+// (Serialization.h)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/serializeBenchmark.cpp -o serializeBenchmark
+// Run:
+//   ./serializeBenchmark [values]                 (default: 5000000)
+//
+// Each container is filled with `values` ints, twice: random ints, then the
+// same count sorted (ids 0, 3, 6, ...: close together, as in an index). Each
+// is saved to serializeBenchmark.bin in the current directory and loaded into
+// a fresh container of the same kind, in four formats (text last):
+//      text          ofstream << v << '\n' / ifstream >> v + insert
+//                    (a list loads with insertAtBeggining: insertAtEnd would
+//                    walk the list, O(n^2); the order comes out reversed)
+//      Raw           serialize(): the values through a 64 KiB buffer
+//                    (an array is written in place); deserialize(): one
+//                    allocation for every node
+//      Varint        LEB128, zigzag for the sign (random ints stay ~5 bytes)
+//      DeltaVarint   differences from the previous value (what Auto picks
+//                    for a sorted list)
+// Containers: LinkedList, DoublyLinkedList (node lists), SimpleQueue (one
+// array: Raw is a single write and a single memcpy; capacity 2^24 values).
+//
+// Columns: save and load milliseconds, ns per value for each, bytes per
+// value in the file, and a checksum of the loaded container (every row of a
+// group must match).
+//
+// Typical (1-core VM, 5*10^6 values): text costs 50-80 ns/value to save and
+// 80-140 to load; binary saves a list at 6-13 ns/value and loads it at 9-15
+// (the nodes come from one allocation, not 5*10^6 `new`s): about 10x
+// faster overall. Raw and the varints cost about the same on a list (the
+// pointer chase dominates); random ints stay ~4.9 bytes as varints, so Raw
+// wins there, while sorted ids shrink to 1 byte per value with DeltaVarint.
+// SimpleQueue Raw is one write and one memcpy: 1-3 ns/value. The first
+// binary row of a group is sometimes 2-3x slower, still paying for the big
+// text file of the group before it.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <cstdio>   // std::remove
+#include <fstream>
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+namespace simplequeue {
+#include "../simpleQueueImp.cpp"
+}
+
+namespace {
+
+const std::size_t ARRAY_CAPACITY = std::size_t(1) << 24;
+const char* PATH = "serializeBenchmark.bin";
+
+using Queue = simplequeue::SimpleQueue<int, ARRAY_CAPACITY, errpolicy::Silent>;
+
+std::size_t fileBytes() {
+    std::ifstream in(PATH, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(in.tellg());
+}
+
+template <typename Container>
+long long sumOf(const Container& container) {
+    long long sum = 0;
+    for (int v : container) sum += v;
+    return sum;
+}
+
+long long sumOf(const Queue& queue) {
+    struct Sum {
+        long long total = 0;
+        void writeValues(const int* v, std::size_t n) {
+            for (std::size_t i = 0; i < n; i++) total += v[i];
+        }
+    } sum;
+    queue.writeTo(sum);
+    return sum.total;
+}
+
+void line(const char* label, std::size_t values, double saveSeconds, double loadSeconds, long long checksum) {
+    double n = static_cast<double>(values);
+    std::printf("  %-14s save %8.1f ms %6.1f ns/value   load %8.1f ms %6.1f ns/value   %5.2f B/value   checksum %lld\n",
+                label, saveSeconds * 1e3, saveSeconds * 1e9 / n, loadSeconds * 1e3, loadSeconds * 1e9 / n,
+                static_cast<double>(fileBytes()) / n, checksum);
+}
+
+// Text: the same loop a student would write around display()
+template <typename Container>
+void saveText(const Container& container) {
+    std::ofstream out(PATH);
+    for (int v : container) out << v << '\n';
+}
+
+void saveText(const Queue& queue) {
+    struct Text {
+        std::ofstream out{PATH};
+        void writeValues(const int* v, std::size_t n) {
+            for (std::size_t i = 0; i < n; i++) out << v[i] << '\n';
+        }
+    } text;
+    queue.writeTo(text);
+}
+
+template <typename Container, typename Insert>
+void loadText(Container& container, Insert insert) {
+    std::ifstream in(PATH);
+    int v;
+    while (in >> v) insert(container, v);
+}
+
+// One container kind through every format
+template <typename Container, typename Insert>
+void runFormats(const char* name, const Container& source, std::size_t values, Insert insert) {
+    std::printf("-- %s\n", name);
+    bench::Stopwatch watch;
+    const std::pair<const char*, serial::Encoding> formats[] = {{"Raw", serial::Encoding::Raw},
+                                                                {"Varint", serial::Encoding::Varint},
+                                                                {"DeltaVarint", serial::Encoding::DeltaVarint}};
+    for (const auto& format : formats) {
+        std::remove(PATH);   // truncating the last file would be billed to the save
+        watch.restart();
+        source.serialize(PATH, format.second);
+        double saved = watch.seconds();
+        auto loaded = std::make_unique<Container>();
+        watch.restart();
+        loaded->deserialize(PATH);
+        line(format.first, values, saved, watch.seconds(), sumOf(*loaded));
+    }
+    // text last: the binary saves would pay for writing its page cache back
+    {
+        std::remove(PATH);
+        watch.restart();
+        saveText(source);
+        double saved = watch.seconds();
+        auto loaded = std::make_unique<Container>();
+        watch.restart();
+        loadText(*loaded, insert);
+        line("text", values, saved, watch.seconds(), sumOf(*loaded));
+    }
+}
+
+void runAll(const std::vector<int>& values) {
+    {
+        auto list = std::make_unique<singly::LinkedList<int>>();
+        for (std::size_t i = values.size(); i-- > 0;) list->insertAtBeggining(values[i]);
+        runFormats("LinkedList", *list, values.size(),
+                   [](singly::LinkedList<int>& l, int v) { l.insertAtBeggining(v); });
+    }
+    {
+        auto list = std::make_unique<doubly::DoublyLinkedList<int>>();
+        for (std::size_t i = values.size(); i-- > 0;) list->insertAtFront(values[i]);
+        runFormats("DoublyLinkedList", *list, values.size(),
+                   [](doubly::DoublyLinkedList<int>& l, int v) { l.insertAtFront(v); });
+    }
+    {
+        std::size_t n = std::min(values.size(), ARRAY_CAPACITY);
+        auto queue = std::make_unique<Queue>();
+        queue->enqueueBulk(values.data(), n);
+        runFormats("SimpleQueue", *queue, n, [](Queue& q, int v) { q.enqueue(v); });
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t count = bench::sizeArg(argc, argv, 1, 5000000);
+    if (count == 0) count = 1;
+
+    std::printf("%zu random ints\n", count);
+    runAll(bench::randomValues(count, bench::DEFAULT_SEED, -1000000000, 1000000000));
+
+    std::vector<int> sorted(count);
+    for (std::size_t i = 0; i < count; i++) sorted[i] = static_cast<int>(i * 3);
+    std::printf("%zu sorted ids (0, 3, 6, ...)\n", count);
+    runAll(sorted);
+
+    std::remove(PATH);
+    return 0;
+}
@@ -0,0 +1,129 @@
+// ============================================================================
+// setOpsBenchmark.cpp — merge-based set operations and k-way merge on LinkedList
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/setOpsBenchmark.cpp -o setOpsBenchmark
+// Run:
+//   ./setOpsBenchmark [total elements for k-way merge]     (default: 2000000)
+//
+// Sections:
+//   1) k-way merge throughput (mergeFrom) for k = 2 .. 1024 sorted lists
+//   2) intersection: searchNode() per element (O(n*m)) vs intersectWith (O(n+m))
+//   3) skewed sizes: small list vs. large sorted data, walking a LinkedList
+//      vs. galloping through a sorted array
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+
+using LinkedList = singly::LinkedList<>;
+
+namespace {
+
+std::vector<int> sortedValues(std::size_t n, std::uint32_t seed, int hi = 1000000000) {
+    std::vector<int> values = bench::randomValues(n, seed, 0, hi);
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+void fill(LinkedList& list, const std::vector<int>& values) {
+    for (std::size_t i = values.size(); i-- > 0;) list.insertAtBeggining(values[i]);
+}
+
+void kWayMerge(std::size_t total) {
+    std::printf("-- k-way merge (mergeFrom), %zu elements total\n", total);
+    for (std::size_t k : {2u, 8u, 64u, 1024u}) {
+        std::vector<LinkedList> lists(k);
+        std::vector<LinkedList*> sources;
+        for (std::size_t i = 0; i < k; i++) {
+            fill(lists[i], sortedValues(total / k, bench::DEFAULT_SEED + static_cast<std::uint32_t>(i)));
+            if (i > 0) sources.push_back(&lists[i]);
+        }
+
+        bench::Stopwatch watch;
+        lists[0].mergeFrom(sources);
+        double seconds = watch.seconds();
+
+        if (!std::is_sorted(lists[0].begin(), lists[0].end())) {
+            std::fprintf(stderr, "k-way merge produced unsorted output\n");
+            std::exit(1);
+        }
+        std::size_t merged = lists[0].size();
+        bench::report("mergeFrom k=" + std::to_string(k), merged, seconds);
+        std::printf("%34s %.1f M elements/s\n", "", merged / seconds / 1e6);
+    }
+}
+
+void intersectionVsSearch() {
+    const std::size_t n = 20000;
+    std::vector<int> a = sortedValues(n, 1, 100000);
+    std::vector<int> b = sortedValues(n, 2, 100000);
+    std::printf("-- intersection of two sorted lists, n = m = %zu\n", n);
+
+    // Baseline: keep a's values found by searchNode() in b
+    {
+        LinkedList la, lb;
+        fill(la, a);
+        fill(lb, b);
+        bench::Stopwatch watch;
+        std::size_t found = 0;
+        for (int value : la) found += lb.searchNode(value) ? 1 : 0;
+        double seconds = watch.seconds();
+        bench::doNotOptimize(found);
+        bench::report("searchNode loop (O(n*m))", n, seconds);
+    }
+    {
+        LinkedList la, lb;
+        fill(la, a);
+        fill(lb, b);
+        bench::Stopwatch watch;
+        la.intersectWith(lb);
+        double seconds = watch.seconds();
+        bench::doNotOptimize(la.size());
+        bench::report("intersectWith (O(n+m))", n, seconds);
+    }
+}
+
+void skewedIntersection() {
+    const std::size_t small = 1000, large = 4000000;
+    std::vector<int> smallValues = sortedValues(small, 3);
+    std::vector<int> largeValues = sortedValues(large, 4);
+    // make sure some values actually match
+    for (std::size_t i = 0; i < small; i += 2) smallValues[i] = largeValues[i * (large / small)];
+    std::sort(smallValues.begin(), smallValues.end());
+
+    std::printf("-- skewed intersection, %zu vs %zu elements\n", small, large);
+    {
+        LinkedList la, lb;
+        fill(la, smallValues);
+        fill(lb, largeValues);
+        bench::Stopwatch watch;
+        la.intersectWith(lb);
+        double seconds = watch.seconds();
+        bench::report("intersectWith(list) linear walk", small, seconds);
+        std::printf("%34s kept %zu\n", "", la.size());
+    }
+    {
+        LinkedList la;
+        fill(la, smallValues);
+        bench::Stopwatch watch;
+        la.intersectWith(largeValues.cbegin(), largeValues.cend());
+        double seconds = watch.seconds();
+        bench::report("intersectWith(range) galloping", small, seconds);
+        std::printf("%34s kept %zu\n", "", la.size());
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t total = bench::sizeArg(argc, argv, 1, 2000000);
+    kWayMerge(total);
+    intersectionVsSearch();
+    skewedIntersection();
+    return 0;
+}
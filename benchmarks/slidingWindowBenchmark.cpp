@@ -0,0 +1,181 @@
+// ============================================================================
+// slidingWindowBenchmark.cpp — streaming window min/max throughput
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/slidingWindowBenchmark.cpp -o slidingWindowBenchmark
+// Run:
+//   ./slidingWindowBenchmark [samples] [window]   (defaults: 100000000, 1024)
+//
+// Input: a bounded random walk of 2^20 ints (fixed seed), replayed until
+// `samples` have been streamed, like a sensor feed. After every sample each
+// variant computes the minimum of the last `window` samples:
+//   naive scan            TemplatedDeque holds the window, every sample scans
+//                         it: O(window) per sample. Run on a short prefix only.
+//   mono / TemplatedDeque MonotonicDeque on the node-based deque (one heap
+//                         node per kept entry)
+//   mono / ring           MonotonicDeque on RingWindowDeque (contiguous, no
+//                         allocation after warm-up), one push() per sample
+//   mono / ring update()  the same, fed in batches of 4096 through update()
+//   min+max / ring        SlidingWindowMinMax::update(), both extremes
+//
+// Before timing, the naive scan and the monotonic deque are compared sample
+// by sample (min, max, argmin, argmax) on the prefix.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+namespace {
+
+const std::size_t INPUT_SIZE = std::size_t(1) << 20;
+const std::size_t BATCH = 4096;
+
+std::vector<int> randomWalk() {
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<int> walk(INPUT_SIZE);
+    int x = 0;
+    for (int& v : walk) {
+        x += static_cast<int>(rng() % 201) - 100;
+        if (x > 1000000) x = 1000000;
+        if (x < -1000000) x = -1000000;
+        v = x;
+    }
+    return walk;
+}
+
+void line(const char* label, std::size_t samples, double seconds, long long checksum) {
+    std::printf("%-24s %12zu samples %9.1f ms %7.2f ns/sample %8.1f M samples/s   checksum %lld\n", label,
+                samples, seconds * 1e3, seconds * 1e9 / static_cast<double>(samples),
+                static_cast<double>(samples) / seconds / 1e6, checksum);
+}
+
+// ----------------------------------------------------------------------------
+// Naive O(window) scan over TemplatedDeque; reports min/max and their newest
+// positions so it can double as the reference for the correctness check
+// ----------------------------------------------------------------------------
+struct NaiveWindow {
+    TemplatedDeque<int> values;
+    std::size_t window;
+    std::uint64_t seen = 0;
+    int min = 0, max = 0;
+    std::uint64_t argmin = 0, argmax = 0;
+
+    explicit NaiveWindow(std::size_t w) : window(w) {}
+
+    void push(int value) {
+        values.insertRear(value);
+        seen++;
+        if (values.size() > window) values.deleteFront();
+        std::uint64_t index = seen - values.size();
+        min = max = values.peekFront();
+        argmin = argmax = index;
+        for (int v : values) {
+            if (v <= min) { min = v; argmin = index; }
+            if (v >= max) { max = v; argmax = index; }
+            index++;
+        }
+    }
+};
+
+bool verify(const std::vector<int>& input, std::size_t samples, std::size_t window) {
+    NaiveWindow naive(window);
+    window::SlidingWindowMinMax<int, window::RingWindowDeque> fast(window);
+    for (std::size_t i = 0; i < samples; i++) {
+        int v = input[i % INPUT_SIZE];
+        naive.push(v);
+        fast.push(v);
+        if (naive.min != fast.min() || naive.max != fast.max() || naive.argmin != fast.argmin() ||
+            naive.argmax != fast.argmax()) {
+            std::fprintf(stderr, "mismatch at sample %zu\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Timed variants. Each returns the sum of the window minimum after every
+// sample (the minimum of a min+max run, plus its maximum for min+max)
+// ----------------------------------------------------------------------------
+long long runNaive(const std::vector<int>& input, std::size_t samples, std::size_t window) {
+    NaiveWindow naive(window);
+    long long sum = 0;
+    for (std::size_t i = 0; i < samples; i++) {
+        naive.push(input[i % INPUT_SIZE]);
+        sum += naive.min;
+    }
+    return sum;
+}
+
+template <template <typename> class Backend>
+long long runPush(const std::vector<int>& input, std::size_t samples, std::size_t window) {
+    window::SlidingWindowMin<int, Backend> mono(window);
+    long long sum = 0;
+    for (std::size_t i = 0; i < samples; i++) {
+        mono.push(input[i % INPUT_SIZE]);
+        sum += mono.best();
+    }
+    return sum;
+}
+
+long long runUpdate(const std::vector<int>& input, std::size_t samples, std::size_t window) {
+    window::SlidingWindowMin<int, window::RingWindowDeque> mono(window);
+    std::vector<int> out(BATCH);
+    long long sum = 0;
+    for (std::size_t done = 0; done < samples;) {
+        std::size_t offset = done % INPUT_SIZE;   // INPUT_SIZE is a multiple of BATCH
+        std::size_t n = std::min(BATCH, samples - done);
+        mono.update(input.data() + offset, n, out.data());
+        for (std::size_t i = 0; i < n; i++) sum += out[i];
+        done += n;
+    }
+    return sum;
+}
+
+long long runMinMax(const std::vector<int>& input, std::size_t samples, std::size_t window) {
+    window::SlidingWindowMinMax<int, window::RingWindowDeque> both(window);
+    std::vector<int> outMin(BATCH), outMax(BATCH);
+    long long sum = 0;
+    for (std::size_t done = 0; done < samples;) {
+        std::size_t offset = done % INPUT_SIZE;
+        std::size_t n = std::min(BATCH, samples - done);
+        both.update(input.data() + offset, n, outMin.data(), outMax.data());
+        for (std::size_t i = 0; i < n; i++) sum += outMin[i] + outMax[i];
+        done += n;
+    }
+    return sum;
+}
+
+template <typename Run>
+void timed(const char* label, std::size_t samples, Run run) {
+    bench::Stopwatch watch;
+    long long checksum = run();
+    line(label, samples, watch.seconds(), checksum);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t samples = bench::sizeArg(argc, argv, 1, 100000000);
+    std::size_t window = bench::sizeArg(argc, argv, 2, 1024);
+    if (window == 0) {
+        std::fprintf(stderr, "window must be at least 1\n");
+        return 1;
+    }
+    std::vector<int> input = randomWalk();
+
+    // Keep the naive run to roughly 2 * 10^8 element visits
+    std::size_t naiveSamples = std::min<std::size_t>(samples, std::max<std::size_t>(200000000 / window, 1000));
+
+    std::printf("window %zu, %zu samples (naive scan: first %zu)\n", window, samples, naiveSamples);
+    std::printf("check vs naive scan: %s\n", verify(input, std::min<std::size_t>(naiveSamples, 100000), window)
+                                                 ? "ok" : "MISMATCH");
+
+    timed("naive scan", naiveSamples, [&] { return runNaive(input, naiveSamples, window); });
+    timed("mono / ring (prefix)", naiveSamples,
+          [&] { return runPush<window::RingWindowDeque>(input, naiveSamples, window); });
+    timed("mono / TemplatedDeque", samples, [&] { return runPush<TemplatedDeque>(input, samples, window); });
+    timed("mono / ring", samples, [&] { return runPush<window::RingWindowDeque>(input, samples, window); });
+    timed("mono / ring update()", samples, [&] { return runUpdate(input, samples, window); });
+    timed("min+max / ring", samples, [&] { return runMinMax(input, samples, window); });
+    return 0;
+}
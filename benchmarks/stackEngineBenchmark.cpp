@@ -0,0 +1,212 @@
+// ============================================================================
+// stackEngineBenchmark.cpp — compiled expressions and CSR DFS on the stacks
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/stackEngineBenchmark.cpp -o stackEngineBenchmark
+// Run:
+//   ./stackEngineBenchmark [rows] [vertices]      (defaults: 1000000, 1000000)
+//
+// 1) Expressions (StackAlgorithms.h, namespace expr). Four small arithmetic /
+//    filter expressions over four double columns; throughput is
+//    expressions evaluated per second (one expression x one row = one).
+//      compile                 shunting-yard parse to RPN, per second
+//      array stack, Print      per row, the default Print policy: a cout
+//                              line per push and pop (discarded in memory,
+//                              run on 1% of the rows)
+//      StackListImp            per row, a heap node per push
+//      array stack             per row, StackArrayImplementation<double, 32>
+//      columns (block 256)     evaluateColumns(): each instruction runs over
+//                              256 rows, the array stack holds block pointers
+//    All variants must print the same checksum of their results.
+//
+// 2) Graph (namespace graph): random DAG in CSR form, 4 edges per vertex.
+//    DFS preorder over every vertex and a topological sort, with the frame
+//    stack as StackArrayImplementation (fixed 2^20 frames, so vertices are
+//    capped at 2^20) or StackListImp. Throughput is (V + E) per second.
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <memory>
+
+#define DS_NO_DEMO_MAIN
+namespace arraystack {
+#include "../StackArrayImp.cpp"
+}
+namespace liststack {
+#include "../StackListImp.cpp"
+}
+
+namespace {
+
+const std::size_t MAX_VERTICES = std::size_t(1) << 20;
+
+const char* const EXPRESSIONS[] = {
+    "(a + b) * c - d / 2",
+    "a > 0.5 && b < 0.25 || !(c >= d)",
+    "-(a * a + b * b) + c * d * 3.5",
+    "(a - b) / (c + 1) > 0.1 && d != 0",
+};
+const std::size_t EXPRESSION_COUNT = sizeof(EXPRESSIONS) / sizeof(EXPRESSIONS[0]);
+
+void line(const char* label, std::size_t count, double seconds, const char* unit, double checksum) {
+    std::printf("%-26s %12zu %-5s %9.1f ms %9.1f M %s/s   checksum %.6g\n", label, count, unit, seconds * 1e3,
+                static_cast<double>(count) / seconds / 1e6, unit, checksum);
+}
+
+// ----------------------------------------------------------------------------
+// 1) Expressions
+// ----------------------------------------------------------------------------
+struct Columns {
+    std::vector<double> a, b, c, d;
+    const double* pointers[4];
+
+    explicit Columns(std::size_t rows) {
+        std::mt19937 rng(bench::DEFAULT_SEED);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (std::vector<double>* column : {&a, &b, &c, &d}) {
+            column->resize(rows);
+            for (double& v : *column) v = dist(rng);
+        }
+        pointers[0] = a.data();
+        pointers[1] = b.data();
+        pointers[2] = c.data();
+        pointers[3] = d.data();
+    }
+};
+
+template <typename Stack>
+double perRow(const std::vector<expr::Program>& programs, const Columns& columns, std::size_t rows, Stack& stack) {
+    double sum = 0.0;
+    for (const expr::Program& program : programs) {
+        for (std::size_t r = 0; r < rows; r++) {
+            double vars[4] = {columns.a[r], columns.b[r], columns.c[r], columns.d[r]};
+            sum += expr::evaluate(program, vars, stack);
+        }
+    }
+    return sum;
+}
+
+void benchExpressions(std::size_t rows) {
+    const std::vector<std::string> names = {"a", "b", "c", "d"};
+    std::vector<expr::Program> programs;
+    for (const char* text : EXPRESSIONS) programs.push_back(expr::compile(text, names));
+    Columns columns(rows);
+    std::size_t evaluations = rows * EXPRESSION_COUNT;
+
+    std::printf("-- expressions: %zu rows x %zu expressions\n", rows, EXPRESSION_COUNT);
+    {
+        std::size_t compiles = 200000;
+        std::size_t instructions = 0;
+        bench::Stopwatch watch;
+        for (std::size_t i = 0; i < compiles; i++) {
+            instructions += expr::compile(EXPRESSIONS[i % EXPRESSION_COUNT], names).code.size();
+        }
+        line("compile", compiles, watch.seconds(), "expr", static_cast<double>(instructions));
+    }
+    {
+        std::size_t printRows = std::max<std::size_t>(rows / 100, 1);
+        arraystack::StackArrayImplementation<double, 32, errpolicy::Print> stack;
+        double sum = 0.0;
+        double seconds = 0.0;
+        {
+            bench::QuietStdout quiet;
+            bench::Stopwatch watch;
+            sum = perRow(programs, columns, printRows, stack);
+            seconds = watch.seconds();
+        }
+        line("array stack, Print", printRows * EXPRESSION_COUNT, seconds, "expr", sum);
+    }
+    {
+        liststack::StackListImp<double, errpolicy::Silent> stack;
+        bench::Stopwatch watch;
+        double sum = perRow(programs, columns, rows, stack);
+        line("StackListImp", evaluations, watch.seconds(), "expr", sum);
+    }
+    {
+        using ArrayStack = arraystack::StackArrayImplementation<double, 32, errpolicy::Silent>;
+        for (const expr::Program& program : programs) expr::checkCapacity<ArrayStack>(program);
+        ArrayStack stack;
+        bench::Stopwatch watch;
+        double sum = perRow(programs, columns, rows, stack);
+        line("array stack", evaluations, watch.seconds(), "expr", sum);
+    }
+    {
+        arraystack::StackArrayImplementation<const double*, 32, errpolicy::Silent> stack;
+        std::vector<double> out(rows);
+        double sum = 0.0;
+        bench::Stopwatch watch;
+        for (const expr::Program& program : programs) {
+            expr::evaluateColumns(program, columns.pointers, rows, out.data(), stack);
+            for (double v : out) sum += v;
+        }
+        line("columns (block 256)", evaluations, watch.seconds(), "expr", sum);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// 2) Graph
+// ----------------------------------------------------------------------------
+graph::CsrGraph randomDag(std::size_t vertices) {
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+    edges.reserve(vertices * 4);
+    for (std::size_t i = 0; i < vertices * 4; i++) {
+        std::uint32_t u = static_cast<std::uint32_t>(rng() % vertices);
+        std::uint32_t v = static_cast<std::uint32_t>(rng() % vertices);
+        if (u == v) continue;
+        if (u > v) std::swap(u, v);   // edges only go "up": no cycles
+        edges.emplace_back(u, v);
+    }
+    return graph::CsrGraph::fromEdges(vertices, edges);
+}
+
+template <typename Stack>
+void benchGraph(const char* label, const graph::CsrGraph& g, Stack& stack) {
+    std::size_t work = g.vertexCount() + g.edgeCount();
+    {
+        std::vector<bool> visited(g.vertexCount(), false);
+        std::vector<std::uint32_t> order;
+        order.reserve(g.vertexCount());
+        bench::Stopwatch watch;
+        for (std::uint32_t v = 0; v < g.vertexCount(); v++) graph::depthFirstOrder(g, v, stack, visited, order);
+        double seconds = watch.seconds();
+        double checksum = 0.0;
+        for (std::size_t i = 0; i < order.size(); i += 997) checksum += static_cast<double>(order[i]) * static_cast<double>(i);
+        line((std::string("DFS, ") + label).c_str(), work, seconds, "V+E", checksum);
+    }
+    {
+        std::vector<std::uint32_t> order;
+        bench::Stopwatch watch;
+        bool ok = graph::topologicalSort(g, stack, order);
+        double seconds = watch.seconds();
+        double checksum = ok ? 0.0 : -1.0;
+        for (std::size_t i = 0; i < order.size(); i += 997) checksum += static_cast<double>(order[i]) * static_cast<double>(i);
+        line((std::string("topo sort, ") + label).c_str(), work, seconds, "V+E", checksum);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t rows = bench::sizeArg(argc, argv, 1, 1000000);
+    std::size_t vertices = std::min(bench::sizeArg(argc, argv, 2, 1000000), MAX_VERTICES);
+    if (rows == 0) rows = 1;
+    if (vertices == 0) vertices = 1;
+
+    benchExpressions(rows);
+
+    std::printf("-- graph: random DAG, %zu vertices\n", vertices);
+    graph::CsrGraph g = randomDag(vertices);
+    std::printf("%zu edges\n", g.edgeCount());
+    {
+        // 8 MB of frames: too big for the call stack, so allocate the stack object
+        auto stack = std::make_unique<arraystack::StackArrayImplementation<graph::DfsFrame, MAX_VERTICES, errpolicy::Silent>>();
+        benchGraph("array stack", g, *stack);
+    }
+    {
+        liststack::StackListImp<graph::DfsFrame, errpolicy::Silent> stack;
+        benchGraph("StackListImp", g, stack);
+    }
+    return 0;
+}
@@ -0,0 +1,250 @@
+// ============================================================================
+// tlbBenchmark.cpp — huge-page and NUMA backed arenas (NodeArena.h)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/tlbBenchmark.cpp -o tlbBenchmark
+// Run:
+//   ./tlbBenchmark [elements]                     (default: 4000000)
+//
+// Each row builds a container of `elements` random ints, picks an arena
+// backing with setArenaBacking(), calls compact(), and then walks it:
+//   LinkedList / DoublyLinkedList  sort() after compact(): the links now jump
+//                 randomly INSIDE the arena, so nearly every hop lands on a
+//                 different 4 KB page (the TLB-bound case)
+//   TemplatedDeque  walked front to rear in arena order (sequential: one TLB
+//                 miss per page at most, so expect a much smaller gain)
+//
+// Backings (setArenaBacking): heap (malloc, 4 KB pages), THP (2 MB aligned +
+// madvise), hugetlb (MAP_HUGETLB; needs /proc/sys/vm/nr_hugepages > 0, else
+// it falls back to THP), and THP with a NUMA policy: local (MPOL_LOCAL),
+// interleave over all nodes, and a per-thread list built and walked on its
+// own thread with the local policy.
+//
+// Columns:
+//   got         pages the arena actually got, "+numa" when mbind() succeeded
+//   huge MB     AnonHugePages growth during compact() (/proc/self/smaps_rollup)
+//   faults      page faults during compact() (4 KB pages: one per 4 KB touched)
+//   walk        best of 3 walks, ns per node
+//   dTLB miss   dTLB load misses per node during the walk (perf_event_open;
+//               "n/a" where hardware counters are not available, e.g. VMs)
+// ============================================================================
+
+#include "BenchCommon.h"
+
+#include <fstream>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define DS_NO_DEMO_MAIN
+namespace singly {
+#include "../linkedListFull.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+
+namespace {
+
+using nodearena::Backing;
+
+// ----------------------------------------------------------------------------
+// One perf counter (hardware dTLB load misses or software page faults)
+// ----------------------------------------------------------------------------
+class Counter {
+public:
+    Counter(std::uint32_t type, std::uint64_t config) {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+        (void)type;
+        (void)config;
+#endif
+    }
+    ~Counter() {
+#if defined(__linux__)
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+    Counter(const Counter&) = delete;
+    Counter& operator=(const Counter&) = delete;
+
+    bool ok() const { return fd_ >= 0; }
+
+    void start() {
+#if defined(__linux__)
+        if (!ok()) return;
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    std::uint64_t stop() {
+        std::uint64_t value = 0;
+#if defined(__linux__)
+        if (!ok()) return 0;
+        ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        if (::read(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) value = 0;
+#endif
+        return value;
+    }
+
+    static Counter dtlbMisses() {
+#if defined(__linux__)
+        return Counter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+#else
+        return Counter(0, 0);
+#endif
+    }
+
+    static Counter pageFaults() {
+#if defined(__linux__)
+        return Counter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS);
+#else
+        return Counter(0, 0);
+#endif
+    }
+
+private:
+    int fd_ = -1;
+};
+
+// AnonHugePages of the whole process, in kB (0 if unknown)
+std::size_t anonHugeKb() {
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string key;
+    std::size_t kb = 0;
+    while (in >> key) {
+        if (key == "AnonHugePages:") {
+            in >> kb;
+            return kb;
+        }
+        in.ignore(1 << 10, '\n');
+    }
+    return 0;
+}
+
+// Every online NUMA node as a bit mask (node0 -> bit 0 ...)
+unsigned long onlineNodeMask() {
+    unsigned long mask = 0;
+    for (unsigned node = 0; node < sizeof(mask) * 8; node++) {
+        std::ifstream probe("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (probe) mask |= 1ul << node;
+    }
+    return mask != 0 ? mask : 1ul;
+}
+
+struct Variant {
+    const char* label;
+    Backing backing;
+};
+
+std::vector<Variant> variants() {
+    unsigned long all = onlineNodeMask();
+    Backing heap;
+    Backing thp{Backing::Pages::TransparentHuge, Backing::Numa::Default, 0};
+    Backing hugetlb{Backing::Pages::ExplicitHuge, Backing::Numa::Default, 0};
+    Backing local{Backing::Pages::TransparentHuge, Backing::Numa::Local, 0};
+    Backing interleave{Backing::Pages::TransparentHuge, Backing::Numa::Interleave, all};
+    return {{"heap", heap}, {"THP", thp}, {"hugetlb", hugetlb}, {"THP + local", local},
+            {"THP + interleave", interleave}};
+}
+
+// ----------------------------------------------------------------------------
+// One measurement
+// ----------------------------------------------------------------------------
+void fill(singly::LinkedList<int>& c, const std::vector<int>& values) {
+    for (int v : values) c.insertAtBeggining(v);
+}
+void fill(doubly::DoublyLinkedList<int>& c, const std::vector<int>& values) {
+    for (int v : values) c.insertAtFront(v);
+}
+void fill(TemplatedDeque<int>& c, const std::vector<int>& values) {
+    for (int v : values) c.insertRear(v);
+}
+
+// Lists: randomise the order inside the arena. The deque stays sequential.
+void scramble(singly::LinkedList<int>& c) { c.sort(); }
+void scramble(doubly::DoublyLinkedList<int>& c) { c.sort(); }
+void scramble(TemplatedDeque<int>&) {}
+
+template <typename Container>
+void measure(const char* container, const Variant& variant, const std::vector<int>& values) {
+    auto c = std::make_unique<Container>();
+    fill(*c, values);
+    c->setArenaBacking(variant.backing);
+
+    Counter faults = Counter::pageFaults();
+    std::size_t hugeBefore = anonHugeKb();
+    faults.start();
+    nodearena::CompactReport report = c->compact();
+    std::uint64_t faultCount = faults.stop();
+    std::size_t hugeAfter = anonHugeKb();
+    std::size_t hugeKb = hugeAfter > hugeBefore ? hugeAfter - hugeBefore : 0;
+    scramble(*c);
+
+    Counter tlb = Counter::dtlbMisses();
+    double best = 1e300;
+    std::uint64_t misses = 0;
+    long long sum = 0;
+    for (int round = 0; round < 3; round++) {
+        tlb.start();
+        bench::Stopwatch watch;
+        for (int v : *c) sum += v;
+        double seconds = watch.seconds();
+        std::uint64_t m = tlb.stop();
+        if (seconds < best) {
+            best = seconds;
+            misses = m;
+        }
+    }
+    bench::doNotOptimize(sum);
+
+    double n = static_cast<double>(values.size());
+    char got[32];
+    std::snprintf(got, sizeof(got), "%s%s", nodearena::pagesName(report.pages), report.numaApplied ? "+numa" : "");
+    char missText[32];
+    if (tlb.ok()) std::snprintf(missText, sizeof(missText), "%.3f", static_cast<double>(misses) / n);
+    else std::snprintf(missText, sizeof(missText), "n/a");
+    std::printf("%-17s %-19s %-12s %8.1f %10llu %8.2f ns %9s\n", container, variant.label, got,
+                static_cast<double>(hugeKb) / 1024.0, static_cast<unsigned long long>(faultCount), best * 1e9 / n,
+                missText);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t elements = bench::sizeArg(argc, argv, 1, 4000000);
+    if (elements == 0) elements = 1;
+    std::vector<int> values = bench::randomValues(elements, bench::DEFAULT_SEED, 0, 1 << 30);
+
+    std::printf("%zu elements, NUMA node mask 0x%lx, this thread on node %u\n", elements, onlineNodeMask(),
+                nodearena::currentNumaNode());
+    std::printf("%-17s %-19s %-12s %8s %10s %11s %9s\n", "container", "backing", "got", "huge MB", "faults", "walk",
+                "dTLB miss");
+    for (const Variant& v : variants()) measure<singly::LinkedList<int>>("LinkedList", v, values);
+    for (const Variant& v : variants()) measure<doubly::DoublyLinkedList<int>>("DoublyLinkedList", v, values);
+    for (const Variant& v : variants()) measure<TemplatedDeque<int>>("TemplatedDeque", v, values);
+
+    // Per-thread container: built, compacted and walked on its own thread,
+    // so MPOL_LOCAL places it on that thread's node
+    Variant perThread{"per-thread local", variants()[3].backing};
+    std::thread worker([&] { measure<singly::LinkedList<int>>("LinkedList", perThread, values); });
+    worker.join();
+    return 0;
+}
@@ -0,0 +1,197 @@
+// ============================================================================
+// valueIndexBenchmark.cpp — hash-indexed lookups in LinkedListImplementation
+//                           and DoublyLinkedList (ValueIndex.h)
+// ----------------------------------------------------------------------------
+// Build (from the repository root):
+//   g++ -std=c++17 -O2 -pthread benchmarks/valueIndexBenchmark.cpp -o valueIndexBenchmark
+// Run:
+//   ./valueIndexBenchmark [elements] [unindexed ops]   (defaults: 1000000, 200)
+//
+// Each list holds `elements` unique ids in random order. Per list:
+//   build              appending every id, index off / on (ns per element)
+//   enableValueIndex   building the index over the finished list
+//   searchAndInsert    insert a fresh id after a random existing one
+//   delete             deleteNode / deleteByValue of a random existing id
+// The operations run `unindexed ops` times with the index off (each one
+// walks half the list on average, so keep it small) and `elements` times with
+// it on; both are reported per operation. Both lists are compared with a
+// std::list holding the same operations at the end.
+//
+// Memory (right after enableValueIndex): bytes per element from memoryUsage()
+// with and without the index, the index table alone, its average probe
+// length, and, for reference, what a std::unordered_map<int, node*> of the
+// same size holds on the heap (measured with AllocCounter.h).
+//
+// Typical (1-core VM, 10^6 ids): 4000-10000x faster operations (about 4 ms
+// -> 0.4-0.9 us; what is left is cache misses on the table and the nodes),
+// an index of ~34 B/element at probe length ~1.5 (about what unordered_map
+// holds, but in ONE block instead of 10^6), and appends ~10x slower while
+// the table grows (enableValueIndex() after a bulk load is cheaper).
+// ============================================================================
+
+#include "BenchCommon.h"
+#include "AllocCounter.h"
+
+#include <memory>
+#include <unordered_map>
+
+#define DS_NO_DEMO_MAIN
+namespace listimp {
+#include "../linkListFullImp.cpp"
+}
+namespace doubly {
+#include "../doublyLinkedList.cpp"
+}
+
+namespace {
+
+using Singly = listimp::LinkedListImplementation<int, errpolicy::Silent>;
+using Doubly = doubly::DoublyLinkedList<int>;
+
+void append(Singly& list, int v) { list.insertAtEnd(v); }
+void append(Doubly& list, int v) { list.insertAtFront(v); }
+bool remove(Singly& list, int v) { return list.deleteNode(v); }
+bool remove(Doubly& list, int v) { return list.deleteByValue(v); }
+
+// The same operations on a std::list, to check the result
+void append(std::list<int>& ref, int v, const Singly*) { ref.push_back(v); }
+void append(std::list<int>& ref, int v, const Doubly*) { ref.push_front(v); }
+
+struct OpTimes {
+    double insertNs = 0.0;
+    double deleteNs = 0.0;
+};
+
+// `ops` rounds of searchAndInsert + delete on random live ids. `live` holds
+// the ids in the list; `nextId` hands out fresh ones.
+template <typename List>
+OpTimes runOps(List& list, std::vector<int>& live, int& nextId, std::size_t ops,
+               std::mt19937& rng, std::vector<std::pair<int, int>>& inserted, std::vector<int>& deleted) {
+    OpTimes times;
+    std::vector<std::size_t> picks(ops);
+    for (std::size_t& p : picks) p = rng() % live.size();
+
+    bench::Stopwatch watch;
+    for (std::size_t i = 0; i < ops; i++) {
+        int id = nextId++;
+        list.searchAndInsert(live[picks[i]], id);
+        inserted.push_back({live[picks[i]], id});
+        live.push_back(id);
+    }
+    times.insertNs = watch.seconds() * 1e9 / static_cast<double>(ops);
+
+    std::vector<int> victims(ops);
+    for (int& v : victims) {
+        std::size_t p = rng() % live.size();
+        v = live[p];
+        live[p] = live.back();   // each victim once
+        live.pop_back();
+    }
+    watch.restart();
+    std::size_t removed = 0;
+    for (int v : victims) removed += remove(list, v);
+    times.deleteNs = watch.seconds() * 1e9 / static_cast<double>(ops);
+    if (removed != ops) {
+        std::fprintf(stderr, "delete failed: %zu of %zu\n", removed, ops);
+        std::exit(1);
+    }
+    deleted.insert(deleted.end(), victims.begin(), victims.end());
+    return times;
+}
+
+template <typename List>
+void benchList(const char* name, const std::vector<int>& ids, std::size_t unindexedOps) {
+    std::printf("-- %s, %zu elements\n", name, ids.size());
+    double n = static_cast<double>(ids.size());
+
+    // Build cost with the index off and on
+    {
+        auto list = std::make_unique<List>();
+        list->enableValueIndex();
+        bench::Stopwatch watch;
+        for (int id : ids) append(*list, id);
+        std::printf("  %-34s %9.1f ns/element\n", "build, index on", watch.seconds() * 1e9 / n);
+    }
+    auto list = std::make_unique<List>();
+    std::list<int> ref;
+    bench::Stopwatch watch;
+    for (int id : ids) append(*list, id);
+    std::printf("  %-34s %9.1f ns/element\n", "build, index off", watch.seconds() * 1e9 / n);
+    for (int id : ids) append(ref, id, static_cast<const List*>(nullptr));
+
+    memusage::MemoryUsage plain = list->memoryUsage();
+
+    std::mt19937 rng(bench::DEFAULT_SEED);
+    std::vector<int> live = ids;
+    int nextId = static_cast<int>(ids.size());
+    std::vector<std::pair<int, int>> inserted;
+    std::vector<int> deleted;
+
+    OpTimes slow = runOps(*list, live, nextId, unindexedOps, rng, inserted, deleted);
+
+    watch.restart();
+    if (!list->enableValueIndex()) {
+        std::fprintf(stderr, "%s: enableValueIndex failed\n", name);
+        std::exit(1);
+    }
+    std::printf("  %-34s %9.1f ms\n", "enableValueIndex()", watch.seconds() * 1e3);
+    memusage::MemoryUsage withIndex = list->memoryUsage();
+    std::printf("  %-34s %9.1f B/element without index, %.1f with (index %.1f B/element, probe length %.2f)\n",
+                "memory", plain.bytesPerElement(), withIndex.bytesPerElement(),
+                static_cast<double>(list->valueIndexBytes()) / static_cast<double>(list->size()),
+                list->valueIndexProbeLength());
+
+    OpTimes fast = runOps(*list, live, nextId, ids.size(), rng, inserted, deleted);
+    std::printf("  %-34s %9.1f ns/op (index off) %9.1f ns/op (index on)  x%.0f\n", "searchAndInsert", slow.insertNs,
+                fast.insertNs, slow.insertNs / fast.insertNs);
+    std::printf("  %-34s %9.1f ns/op (index off) %9.1f ns/op (index on)  x%.0f\n", "delete", slow.deleteNs,
+                fast.deleteNs, slow.deleteNs / fast.deleteNs);
+
+    // Same contents as a std::list given the same operations?
+    std::unordered_map<int, std::list<int>::iterator> where;
+    where.reserve(ref.size() + inserted.size());
+    for (auto it = ref.begin(); it != ref.end(); ++it) where[*it] = it;
+    std::size_t insertPos = 0, deletePos = 0;
+    for (std::size_t batch : {unindexedOps, ids.size()}) {
+        for (std::size_t i = 0; i < batch; i++, insertPos++) {
+            auto after = where[inserted[insertPos].first];
+            where[inserted[insertPos].second] = ref.insert(std::next(after), inserted[insertPos].second);
+        }
+        for (std::size_t i = 0; i < batch; i++, deletePos++) {
+            ref.erase(where[deleted[deletePos]]);
+            where.erase(deleted[deletePos]);
+        }
+    }
+    if (!list->hasValueIndex() || !std::equal(list->begin(), list->end(), ref.begin(), ref.end())) {
+        std::fprintf(stderr, "%s: contents differ from std::list!\n", name);
+        std::exit(1);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t elements = bench::sizeArg(argc, argv, 1, 1000000);
+    std::size_t unindexedOps = bench::sizeArg(argc, argv, 2, 200);
+    if (elements == 0) elements = 1;
+    if (unindexedOps == 0) unindexedOps = 1;
+
+    std::vector<int> ids(elements);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(bench::DEFAULT_SEED));
+
+    benchList<Singly>("LinkedListImplementation", ids, unindexedOps);
+    benchList<Doubly>("DoublyLinkedList", ids, unindexedOps);
+
+    // Reference: the node-based standard hash map for the same job
+    std::size_t before = bench::liveHeapBytes();
+    {
+        std::unordered_map<int, void*> map;
+        map.reserve(elements);
+        for (int id : ids) map.emplace(id, nullptr);
+        std::size_t bytes = bench::liveHeapBytes() - before;
+        std::printf("-- std::unordered_map<int, node*> of %zu entries: %.1f B/element (one heap block per entry)\n",
+                    elements, static_cast<double>(bytes) / static_cast<double>(elements));
+    }
+    return 0;
+}
@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "MemoryUsage.h"
+using namespace std;
+
+// ============================================================================
+// BlockingQueue (Bounded, Thread-Safe FIFO) — STUDY GUIDE VERSION
+// ----------------------------------------------------------------------------
+// BIG IDEA: a queue that connects THREADS (pipeline stages)
+// - A producer stage pushes work items, a consumer stage pops them.
+// - SimpleQueue / CircularQueue have no way to WAIT, so a consumer has to
+//   spin on isEmpty() (burning a whole core), and nothing stops a fast
+//   producer from running far ahead of a slow consumer.
+//
+// WHAT THIS VERSION ADDS:
+// - popWait():   sleeps while the queue is empty
+// - pushWait():  sleeps while the queue is FULL  -> BACKPRESSURE
+//                (a slow stage automatically slows down the stages before it,
+//                and memory use stays bounded by Capacity)
+// - drainTo(buffer, max): takes up to `max` items under ONE lock acquisition
+// - pushBatch(values, n): the producer-side batch (blocks until all n are in)
+// - close():     "no more items"; waiting threads wake up, consumers still
+//                drain what is left, then popWait() returns false
+//
+// HOW WAITING WORKS (spin, then park):
+// 1) Spin: for a short while, re-check an atomic copy of the element count
+//    without taking the lock. If the other stage runs on another core, the
+//    item often arrives within a few hundred nanoseconds and we never sleep.
+// 2) Park: otherwise wait on a std::condition_variable. On Linux this is a
+//    futex: the thread sleeps in the kernel and costs no CPU until notified.
+// The spin length ADAPTS: it doubles after a spin that succeeded and halves
+// after one that had to park anyway. On a single-core machine spinning can
+// never help (the other thread cannot run while we spin), so it is off.
+//
+// Notifications are only sent when someone is actually parked
+// (sleepingConsumers / sleepingProducers), so an uncontended push/pop never
+// makes a system call.
+//
+// STORAGE: the same ring buffer as CircularQueue (head + count, bitmask wrap
+// for power-of-two capacities, memcpy batches for trivially copyable T).
+//
+// TIME COMPLEXITY:
+// - pushWait / popWait / tryPush / tryPop: O(1) (plus waiting)
+// - drainTo / pushBatch: O(k) for k items, one lock round trip
+// ============================================================================
+
+template <typename T = int, std::size_t Capacity = 1024>
+class BlockingQueue {
+    static_assert(Capacity > 0, "a queue needs at least one slot");
+
+    static constexpr bool POWER_OF_TWO = (Capacity & (Capacity - 1)) == 0;
+    static constexpr unsigned MAX_SPIN = 4096;   // upper bound for the adaptive spin
+
+    mutable std::mutex lock;                 // protects everything below up to `closed`
+    std::condition_variable notEmpty;        // consumers park here
+    std::condition_variable notFull;         // producers park here (backpressure)
+    T buffer[Capacity];                      // ring storage
+    std::size_t head;                        // index of the front element
+    std::size_t count;                       // number of stored elements
+    std::size_t sleepingConsumers;           // threads parked in notEmpty
+    std::size_t sleepingProducers;           // threads parked in notFull
+    bool closed;                             // set once by close()
+
+    // Lock-free copies for the spin phase (written under the lock)
+    std::atomic<std::size_t> visibleCount;
+    std::atomic<bool> visibleClosed;
+    std::atomic<unsigned> spinBudget;        // current spin length (adaptive)
+    unsigned spinCeiling;                    // 0 disables spinning
+    std::atomic<std::size_t> parks;          // how many times a thread slept
+
+    static std::size_t wrap(std::size_t i) {
+        if constexpr (POWER_OF_TWO) {
+            return i & (Capacity - 1);
+        } else {
+            return i % Capacity;
+        }
+    }
+
+    // One pause instruction: tells the CPU we are busy-waiting
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    // Spin phase: poll `ready` for up to spinBudget rounds, then adapt the budget
+    template <typename Ready>
+    void spinFor(Ready ready) {
+        unsigned budget = spinBudget.load(std::memory_order_relaxed);
+        if (budget == 0) return;
+        for (unsigned i = 0; i < budget; i++) {
+            if (ready()) {
+                spinBudget.store(std::min(spinCeiling, budget * 2), std::memory_order_relaxed);
+                return;
+            }
+            cpuRelax();
+        }
+        spinBudget.store(std::max(1u, budget / 2), std::memory_order_relaxed);
+    }
+
+    // Move n items out of the ring starting at head (at most two segments)
+    void copyOut(T* out, std::size_t n) {
+        std::size_t firstPart = std::min(n, Capacity - head);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (firstPart != 0) std::memcpy(out, &buffer[head], firstPart * sizeof(T));
+            if (n != firstPart) std::memcpy(out + firstPart, &buffer[0], (n - firstPart) * sizeof(T));
+        } else {
+            std::move(&buffer[head], &buffer[head] + firstPart, out);
+            std::move(&buffer[0], &buffer[0] + (n - firstPart), out + firstPart);
+        }
+        head = wrap(head + n);
+        count -= n;
+    }
+
+    // Copy n items in after the last element (at most two segments)
+    void copyIn(const T* values, std::size_t n) {
+        std::size_t tail = wrap(head + count);
+        std::size_t firstPart = std::min(n, Capacity - tail);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (firstPart != 0) std::memcpy(&buffer[tail], values, firstPart * sizeof(T));
+            if (n != firstPart) std::memcpy(&buffer[0], values + firstPart, (n - firstPart) * sizeof(T));
+        } else {
+            std::copy(values, values + firstPart, &buffer[tail]);
+            std::copy(values + firstPart, values + n, &buffer[0]);
+        }
+        count += n;
+    }
+
+    void publish() { visibleCount.store(count, std::memory_order_release); }
+
+    // Park until there is an item or the queue is closed (lock held)
+    void waitForItems(std::unique_lock<std::mutex>& guard) {
+        while (count == 0 && !closed) {
+            sleepingConsumers++;
+            parks.fetch_add(1, std::memory_order_relaxed);
+            notEmpty.wait(guard);
+            sleepingConsumers--;
+        }
+    }
+
+    // Park until there is room or the queue is closed (lock held)
+    void waitForRoom(std::unique_lock<std::mutex>& guard) {
+        while (count == Capacity && !closed) {
+            sleepingProducers++;
+            parks.fetch_add(1, std::memory_order_relaxed);
+            notFull.wait(guard);
+            sleepingProducers--;
+        }
+    }
+
+    bool itemsOrClosed() const {
+        return visibleCount.load(std::memory_order_acquire) != 0 || visibleClosed.load(std::memory_order_relaxed);
+    }
+    bool roomOrClosed() const {
+        return visibleCount.load(std::memory_order_acquire) != Capacity || visibleClosed.load(std::memory_order_relaxed);
+    }
+
+public:
+    BlockingQueue()
+        : buffer{}, head(0), count(0), sleepingConsumers(0), sleepingProducers(0), closed(false),
+          visibleCount(0), visibleClosed(false), spinBudget(0), spinCeiling(0), parks(0) {
+        setMaxSpin(std::thread::hardware_concurrency() > 1 ? MAX_SPIN : 0);
+    }
+
+    // A mutex cannot be copied or moved, so neither can the queue
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // Upper bound for the adaptive spin (0 = always park immediately).
+    // Call before the queue is shared between threads.
+    void setMaxSpin(unsigned rounds) {
+        spinCeiling = rounds;
+        spinBudget.store(std::min(rounds, 64u), std::memory_order_relaxed);
+    }
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    // Snapshot of the size; may already be stale when the caller reads it
+    std::size_t size() const { return visibleCount.load(std::memory_order_acquire); }
+    bool isClosed() const { return visibleClosed.load(std::memory_order_acquire); }
+
+    // Number of times any thread had to sleep (a measure of contention)
+    std::size_t parkCount() const { return parks.load(std::memory_order_relaxed); }
+
+    memusage::MemoryUsage memoryUsage() const {
+        std::lock_guard<std::mutex> guard(lock);
+        return memusage::arrayUsage<T>(count, sizeof(*this));
+    }
+
+    // ------------------------------------------------------------------------
+    // pushWait(value): blocks while full. Returns false (value dropped) only
+    // if the queue is closed.
+    // ------------------------------------------------------------------------
+    bool pushWait(const T& value) {
+        spinFor([this] { return roomOrClosed(); });
+        std::unique_lock<std::mutex> guard(lock);
+        waitForRoom(guard);
+        if (closed) return false;
+        buffer[wrap(head + count)] = value;
+        count++;
+        publish();
+        bool wake = sleepingConsumers != 0;
+        guard.unlock();                 // wake AFTER unlocking: the woken thread
+        if (wake) notEmpty.notify_one(); // does not immediately block on `lock`
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // popWait(out): blocks while empty. Returns false when the queue is
+    // closed AND every remaining item has been taken (end of stream).
+    // ------------------------------------------------------------------------
+    bool popWait(T& out) {
+        spinFor([this] { return itemsOrClosed(); });
+        std::unique_lock<std::mutex> guard(lock);
+        waitForItems(guard);
+        if (count == 0) return false;   // closed and drained
+        out = std::move(buffer[head]);
+        head = wrap(head + 1);
+        count--;
+        publish();
+        bool wake = sleepingProducers != 0;
+        guard.unlock();
+        if (wake) notFull.notify_one();
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // drainTo(out, max): waits for at least one item, then takes as many as
+    // are available (up to max) in FIFO order. Returns the number taken;
+    // 0 means end of stream (closed and empty).
+    // ------------------------------------------------------------------------
+    std::size_t drainTo(T* out, std::size_t max) {
+        if (max == 0) return 0;
+        spinFor([this] { return itemsOrClosed(); });
+        std::unique_lock<std::mutex> guard(lock);
+        waitForItems(guard);
+        std::size_t n = std::min(max, count);
+        copyOut(out, n);
+        publish();
+        bool wake = sleepingProducers != 0;
+        guard.unlock();
+        if (wake) {
+            if (n > 1) notFull.notify_all();   // several slots freed at once
+            else notFull.notify_one();
+        }
+        return n;
+    }
+
+    // ------------------------------------------------------------------------
+    // pushBatch(values, n): pushes all n items, each round copying as many as
+    // currently fit. Returns how many were pushed (less than n only if the
+    // queue was closed meanwhile).
+    // ------------------------------------------------------------------------
+    std::size_t pushBatch(const T* values, std::size_t n) {
+        std::size_t pushed = 0;
+        while (pushed < n) {
+            spinFor([this] { return roomOrClosed(); });
+            std::unique_lock<std::mutex> guard(lock);
+            waitForRoom(guard);
+            if (closed) break;
+            std::size_t chunk = std::min(n - pushed, Capacity - count);
+            copyIn(values + pushed, chunk);
+            publish();
+            pushed += chunk;
+            std::size_t sleepers = sleepingConsumers;
+            guard.unlock();
+            if (sleepers > 1 && chunk > 1) notEmpty.notify_all();
+            else if (sleepers != 0) notEmpty.notify_one();
+        }
+        return pushed;
+    }
+
+    // Non-blocking versions: fail immediately instead of waiting
+    bool tryPush(const T& value) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (closed || count == Capacity) return false;
+        buffer[wrap(head + count)] = value;
+        count++;
+        publish();
+        bool wake = sleepingConsumers != 0;
+        guard.unlock();
+        if (wake) notEmpty.notify_one();
+        return true;
+    }
+
+    bool tryPop(T& out) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (count == 0) return false;
+        out = std::move(buffer[head]);
+        head = wrap(head + 1);
+        count--;
+        publish();
+        bool wake = sleepingProducers != 0;
+        guard.unlock();
+        if (wake) notFull.notify_one();
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // close(): shutdown. Further pushes fail; consumers finish the remaining
+    // items, then see end of stream. Every parked thread is woken.
+    // ------------------------------------------------------------------------
+    void close() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            closed = true;
+            visibleClosed.store(true, std::memory_order_release);
+        }
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+};
+
+
+// ============================================================================
+// TEST HARNESS (main) — a two-stage pipeline
+// ----------------------------------------------------------------------------
+// producer --> [BlockingQueue, capacity 8] --> consumer
+// The queue is tiny, so the producer keeps hitting "full" and waits
+// (backpressure). The consumer takes batches with drainTo() and stops when
+// the producer closes the queue.
+// ============================================================================
+
+#ifndef DS_NO_DEMO_MAIN   // define it to #include this file from a benchmark
+int main() {
+    BlockingQueue<int, 8> q;
+    const int ITEMS = 1000;
+
+    thread producer([&q, ITEMS] {
+        for (int i = 1; i <= ITEMS; i++) q.pushWait(i);
+        q.close();                       // end of stream
+    });
+
+    long long sum = 0;
+    size_t batches = 0;
+    int batch[8];
+    while (size_t n = q.drainTo(batch, 8)) {
+        for (size_t i = 0; i < n; i++) sum += batch[i];
+        batches++;
+    }
+    producer.join();
+
+    cout << "Consumed sum " << sum << " (expected " << 1LL * ITEMS * (ITEMS + 1) / 2 << ") in "
+         << batches << " batches" << endl;
+    cout << "Push after close accepted? " << (q.pushWait(1) ? "yes" : "no") << endl;
+    return 0;
+}
+#endif // DS_NO_DEMO_MAIN
@@ -0,0 +1,576 @@
+#include <algorithm>    // std::binary_search, std::lower_bound
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t, std::uint8_t
+#include <cstring>      // std::memset, std::memcpy
+#include <iostream>     // std::cout (demo and print())
+#include <iterator>     // std::forward_iterator_tag
+#include <new>          // ::operator new / delete (blocks have a variable size)
+#include <stdexcept>    // std::invalid_argument
+#include <type_traits>  // std::is_integral
+#include <utility>      // std::swap
+#if defined(__SSE2__) && !defined(DS_NO_SIMD)
+#include <emmintrin.h>  // SSE2: 4 x 32-bit lanes (every x86-64 CPU has it)
+#endif
+#if __cplusplus >= 202002L
+#include <ranges>       // std::ranges::forward_range (concept check below)
+#endif
+
+#include "Instrumentation.h" // DS_COUNT_* hooks (active only with -DDS_INSTRUMENT)
+#include "MemoryUsage.h"     // memusage::MemoryUsage footprint breakdown
+
+using namespace std;
+
+// ============================================================================
+// COMPRESSED SORTED INTEGER LIST (delta + bit-packing) — STUDY GUIDE VERSION
+// ----------------------------------------------------------------------------
+// A sorted LinkedList<int> of ids (1000, 1003, 1004, 1010, ...) pays for a
+// 16-byte node (32 with malloc's header) to hold 4 bytes of value, and most
+// of those 4 bytes are wasted too: neighbouring ids differ by a few units.
+// This list stores the same values in 1-2 bytes each.
+//
+// 1) DELTAS. Store the GAP to the previous value instead of the value:
+//        1000 1003 1004 1010 1012   ->   first = 1000, deltas 0 3 1 6 2
+//    In a sorted list every gap is >= 0 and usually small.
+//
+// 2) BIT-PACKING (FOR, "frame of reference"). Values arrive in BLOCKS of
+//    128. A block whose largest gap is 6 needs only 3 bits per gap, so its
+//    128 gaps take 128 * 3 / 8 = 48 bytes instead of 512.
+//
+// 3) EXCEPTIONS (PFOR, "patched" FOR). One huge gap would force a wide
+//    width on all 128. Instead the width is chosen to minimise the block's
+//    size, and the few gaps that do not fit keep their high bits in an
+//    exception list (index + high bits, 5 bytes each) patched in after
+//    unpacking.
+//
+// 4) SIMD LAYOUT. Gap i goes to lane i % 4 of a 4 x 32-bit vector, so one
+//    SSE2 shift + mask unpacks FOUR gaps, and the running sum that turns
+//    gaps back into values is done 4 at a time as well. (Without SSE2, or
+//    with -DDS_NO_SIMD, plain loops read the same layout.)
+//
+// 5) SKIP HEADERS. Each block remembers its first (smallest) and last
+//    (largest) value, so searchNode() hops over every block whose range
+//    cannot hold the value WITHOUT decoding it, and stops at the first
+//    block that starts above it.
+//
+// The newest (< 128) values wait uncompressed in a small array at the tail
+// (`pending`) until they fill a block. So:
+//   append(v)         O(1); v must be >= the last value (returns false if not)
+//   forward iteration decodes one block at a time (128 values in the iterator)
+//   searchNode(v)     O(blocks) header checks + ONE block decode
+//   no insert/delete in the middle: rebuild from a range instead
+//
+// T: a 32-bit integer type (int, unsigned, int32_t, uint32_t).
+// ============================================================================
+
+namespace bitpack {
+
+const std::size_t BLOCK = 128;                 // values per block
+const std::size_t WORDS_PER_BIT = BLOCK / 32;  // packed words for each bit of width
+
+// Bits needed to write v (0 for 0)
+inline unsigned bitWidth(std::uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return v == 0 ? 0u : 32u - static_cast<unsigned>(__builtin_clz(v));
+#else
+    unsigned bits = 0;
+    while (v != 0) {
+        bits++;
+        v >>= 1;
+    }
+    return bits;
+#endif
+}
+
+inline std::uint32_t lowMask(unsigned bits) {
+    return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+}
+
+// ----------------------------------------------------------------------------
+// pack: the low `bits` bits of 128 values into 4 * bits words
+//
+// Value i is number i / 4 of lane i % 4; lane L fills words L, L + 4, L + 8 ...
+// ----------------------------------------------------------------------------
+inline void pack(const std::uint32_t* in, unsigned bits, std::uint32_t* words) {
+    std::memset(words, 0, WORDS_PER_BIT * bits * sizeof(std::uint32_t));
+    if (bits == 0) return;
+    const std::uint32_t mask = lowMask(bits);
+    for (std::size_t i = 0; i < BLOCK; i++) {
+        std::uint32_t v = in[i] & mask;
+        std::size_t lane = i & 3;
+        std::size_t bit = (i >> 2) * bits;
+        std::size_t word = bit >> 5;
+        unsigned offset = static_cast<unsigned>(bit & 31);
+        words[word * 4 + lane] |= v << offset;
+        if (offset + bits > 32) {   // straddles into the lane's next word
+            words[(word + 1) * 4 + lane] |= v >> (32 - offset);
+        }
+    }
+}
+
+// unpack: the inverse, one value at a time (the reference version)
+inline void unpackScalar(const std::uint32_t* words, unsigned bits, std::uint32_t* out) {
+    if (bits == 0) {
+        std::memset(out, 0, BLOCK * sizeof(std::uint32_t));
+        return;
+    }
+    const std::uint32_t mask = lowMask(bits);
+    for (std::size_t i = 0; i < BLOCK; i++) {
+        std::size_t lane = i & 3;
+        std::size_t bit = (i >> 2) * bits;
+        std::size_t word = bit >> 5;
+        unsigned offset = static_cast<unsigned>(bit & 31);
+        std::uint32_t v = words[word * 4 + lane] >> offset;
+        if (offset + bits > 32) {
+            v |= words[(word + 1) * 4 + lane] << (32 - offset);
+        }
+        out[i] = v & mask;
+    }
+}
+
+// Running sum: gaps -> values, starting from `base`
+inline void prefixSumScalar(std::uint32_t* values, std::uint32_t base) {
+    for (std::size_t i = 0; i < BLOCK; i++) {
+        base += values[i];
+        values[i] = base;
+    }
+}
+
+#if defined(__SSE2__) && !defined(DS_NO_SIMD)
+// The same unpack with 4 lanes per instruction: 32 steps instead of 128
+inline void unpackSimd(const std::uint32_t* words, unsigned bits, std::uint32_t* out) {
+    if (bits == 0) {
+        std::memset(out, 0, BLOCK * sizeof(std::uint32_t));
+        return;
+    }
+    const __m128i mask = _mm_set1_epi32(static_cast<int>(lowMask(bits)));
+    const __m128i* in = reinterpret_cast<const __m128i*>(words);
+    __m128i* to = reinterpret_cast<__m128i*>(out);
+    __m128i current = _mm_loadu_si128(in);
+    unsigned shift = 0;
+    for (unsigned j = 0; j < 32; j++) {
+        __m128i v = _mm_srl_epi32(current, _mm_cvtsi32_si128(static_cast<int>(shift)));
+        shift += bits;
+        if (shift >= 32) {
+            shift -= 32;
+            if (shift > 0) {          // the value continues in the next word
+                current = _mm_loadu_si128(++in);
+                v = _mm_or_si128(v, _mm_sll_epi32(current, _mm_cvtsi32_si128(static_cast<int>(bits - shift))));
+            } else if (j != 31) {     // ended exactly on a word boundary
+                current = _mm_loadu_si128(++in);
+            }
+        }
+        _mm_storeu_si128(to + j, _mm_and_si128(v, mask));
+    }
+}
+
+// Running sum of 4 values at a time: add the vector shifted by one lane,
+// then by two lanes, then the last value of the previous vector
+inline void prefixSumSimd(std::uint32_t* values, std::uint32_t base) {
+    __m128i carry = _mm_set1_epi32(static_cast<int>(base));
+    __m128i* v = reinterpret_cast<__m128i*>(values);
+    for (std::size_t j = 0; j < BLOCK / 4; j++) {
+        __m128i x = _mm_loadu_si128(v + j);
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        _mm_storeu_si128(v + j, x);
+        carry = _mm_shuffle_epi32(x, 0xFF);
+    }
+}
+#endif
+
+// The versions the list uses
+inline void unpack(const std::uint32_t* words, unsigned bits, std::uint32_t* out) {
+#if defined(__SSE2__) && !defined(DS_NO_SIMD)
+    unpackSimd(words, bits, out);
+#else
+    unpackScalar(words, bits, out);
+#endif
+}
+
+inline void prefixSum(std::uint32_t* values, std::uint32_t base) {
+#if defined(__SSE2__) && !defined(DS_NO_SIMD)
+    prefixSumSimd(values, base);
+#else
+    prefixSumScalar(values, base);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// chooseWidth: the width that makes a block of these gaps smallest
+//
+// Width b costs 16 * b bytes of packed words plus 5 bytes for every gap
+// wider than b (an exception). Returns b; *exceptions gets their count.
+// ----------------------------------------------------------------------------
+inline unsigned chooseWidth(const std::uint32_t* gaps, std::size_t* exceptions) {
+    std::size_t widths[33] = {};
+    for (std::size_t i = 0; i < BLOCK; i++) widths[bitWidth(gaps[i])]++;
+    unsigned best = 32;
+    std::size_t bestBytes = WORDS_PER_BIT * 32 * sizeof(std::uint32_t);
+    std::size_t bestExceptions = 0;
+    std::size_t wider = 0;   // gaps wider than b
+    for (unsigned b = 32; b-- > 0;) {
+        wider += widths[b + 1];
+        std::size_t bytes = WORDS_PER_BIT * b * sizeof(std::uint32_t) + wider * 5;
+        if (bytes < bestBytes) {
+            best = b;
+            bestBytes = bytes;
+            bestExceptions = wider;
+        }
+    }
+    *exceptions = bestExceptions;
+    return best;
+}
+
+} // namespace bitpack
+
+// ============================================================================
+// CompressedBlock: skip header + packed gaps of 128 sorted values
+// ----------------------------------------------------------------------------
+// One heap allocation per block, header first:
+//    [next | first | last | bits | exceptions] [4 * bits words]
+//    [exception high bits: exceptions x uint32] [exception positions: bytes]
+// ============================================================================
+template <typename T>
+struct CompressedBlock {
+    CompressedBlock* next;
+    T first;                 // smallest value (skip header)
+    T last;                  // largest value (skip header)
+    std::uint8_t bits;       // width of the packed gaps
+    std::uint8_t exceptions; // gaps wider than `bits`
+
+    std::uint32_t* words() { return reinterpret_cast<std::uint32_t*>(this + 1); }
+    const std::uint32_t* words() const { return reinterpret_cast<const std::uint32_t*>(this + 1); }
+    const std::uint32_t* highBits() const { return words() + bitpack::WORDS_PER_BIT * bits; }
+    const std::uint8_t* positions() const { return reinterpret_cast<const std::uint8_t*>(highBits() + exceptions); }
+
+    static std::size_t bytesFor(unsigned bits, std::size_t exceptions) {
+        return sizeof(CompressedBlock) + (bitpack::WORDS_PER_BIT * bits + exceptions) * sizeof(std::uint32_t) +
+               exceptions;
+    }
+    std::size_t bytes() const { return bytesFor(bits, exceptions); }
+
+    // The 128 values, in order
+    void decode(std::uint32_t* out) const {
+        bitpack::unpack(words(), bits, out);
+        const std::uint32_t* high = highBits();
+        const std::uint8_t* at = positions();
+        for (unsigned e = 0; e < exceptions; e++) {
+            out[at[e]] |= high[e] << bits;   // bits < 32 whenever there are exceptions
+        }
+        bitpack::prefixSum(out, static_cast<std::uint32_t>(first));
+    }
+};
+
+// ============================================================================
+// CompressedIntList: sorted, append-only list of 32-bit integers
+// ============================================================================
+template <typename T = int>
+class CompressedIntList {
+    static_assert(std::is_integral<T>::value && sizeof(T) == 4,
+                  "CompressedIntList packs 32-bit integers (int, unsigned, int32_t, uint32_t)");
+
+private:
+    using Block = CompressedBlock<T>;
+    static const std::size_t BLOCK = bitpack::BLOCK;
+
+    Block* head;              // oldest block
+    Block* tail;              // newest block (appends link after it)
+    std::size_t blockCount;
+    std::size_t nodeCount;    // values in blocks + pending
+    T pending[BLOCK];         // the newest values, not compressed yet
+    std::size_t pendingCount;
+
+    // Compress the full `pending` array into a new block at the tail
+    void sealPending() {
+        std::uint32_t gaps[BLOCK];
+        gaps[0] = 0;
+        for (std::size_t i = 1; i < BLOCK; i++) {
+            // sorted, so the unsigned difference is the exact gap
+            gaps[i] = static_cast<std::uint32_t>(pending[i]) - static_cast<std::uint32_t>(pending[i - 1]);
+        }
+        std::size_t exceptions = 0;
+        unsigned bits = bitpack::chooseWidth(gaps, &exceptions);
+
+        Block* block = static_cast<Block*>(::operator new(Block::bytesFor(bits, exceptions)));
+        DS_COUNT_ALLOC("CompressedIntList");
+        block->next = nullptr;
+        block->first = pending[0];
+        block->last = pending[BLOCK - 1];
+        block->bits = static_cast<std::uint8_t>(bits);
+        block->exceptions = static_cast<std::uint8_t>(exceptions);
+        bitpack::pack(gaps, bits, block->words());
+        std::uint32_t* high = block->words() + bitpack::WORDS_PER_BIT * bits;
+        std::uint8_t* at = reinterpret_cast<std::uint8_t*>(high + exceptions);
+        for (std::size_t i = 0, e = 0; e < exceptions; i++) {
+            if (bitpack::bitWidth(gaps[i]) > bits) {
+                high[e] = gaps[i] >> bits;
+                at[e] = static_cast<std::uint8_t>(i);
+                e++;
+            }
+        }
+
+        if (tail != nullptr) tail->next = block;
+        else head = block;
+        tail = block;
+        blockCount++;
+        pendingCount = 0;
+    }
+
+    void clear() noexcept {
+        while (head != nullptr) {
+            Block* next = head->next;
+            ::operator delete(head);
+            DS_COUNT_FREE("CompressedIntList");
+            head = next;
+        }
+        tail = nullptr;
+        blockCount = 0;
+        nodeCount = 0;
+        pendingCount = 0;
+    }
+
+public:
+    // ------------------------------------------------------------------------
+    // const_iterator: forward, read-only (the values are packed, there is
+    // nothing to assign to). It carries one decoded block (512 bytes), so
+    // copying it is not free: prefer range-for or forEach() to passing
+    // iterators around by value.
+    // ------------------------------------------------------------------------
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator() = default;
+
+        reference operator*() const {
+            // int and unsigned int may alias each other, so the decoded
+            // words can be read as T directly
+            return block_ != nullptr ? reinterpret_cast<const T&>(values_[index_]) : list_->pending[index_];
+        }
+        pointer operator->() const { return &**this; }
+
+        const_iterator& operator++() {
+            position_++;
+            if (++index_ == available_) load(block_ != nullptr ? block_->next : nullptr, block_ == nullptr);
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator& other) const { return position_ == other.position_; }
+        bool operator!=(const const_iterator& other) const { return position_ != other.position_; }
+
+    private:
+        friend class CompressedIntList;
+
+        const CompressedIntList* list_ = nullptr;
+        const Block* block_ = nullptr;   // decoded into values_; nullptr = reading pending
+        std::size_t position_ = 0;       // values passed (end() = size())
+        std::size_t index_ = 0;
+        std::size_t available_ = 0;
+        std::uint32_t values_[BLOCK];
+
+        const_iterator(const CompressedIntList* list, std::size_t position) : list_(list), position_(position) {}
+
+        // Start on `block` (or on pending once the blocks run out)
+        void load(const Block* block, bool pastPending) {
+            index_ = 0;
+            block_ = block;
+            if (block != nullptr) {
+                block->decode(values_);
+                available_ = BLOCK;
+            } else {
+                available_ = pastPending ? 0 : list_->pendingCount;
+            }
+        }
+    };
+    using iterator = const_iterator;
+
+    CompressedIntList() : head(nullptr), tail(nullptr), blockCount(0), nodeCount(0), pendingCount(0) {}
+
+    // Build from any SORTED range, e.g. a sorted LinkedList<int>:
+    //   CompressedIntList<int> ids(list.begin(), list.end());
+    // Throws std::invalid_argument if a value is smaller than the one before.
+    template <typename InputIt>
+    CompressedIntList(InputIt first, InputIt last) : CompressedIntList() {
+        for (; first != last; ++first) {
+            if (!append(*first)) {
+                clear();
+                throw std::invalid_argument("CompressedIntList: the values must be sorted");
+            }
+        }
+    }
+
+    CompressedIntList(const CompressedIntList&) = delete;
+    CompressedIntList& operator=(const CompressedIntList&) = delete;
+
+    CompressedIntList(CompressedIntList&& other) noexcept : CompressedIntList() { swap(other); }
+
+    CompressedIntList& operator=(CompressedIntList&& other) noexcept {
+        swap(other);
+        return *this;   // our old blocks are freed by other's destructor
+    }
+
+    ~CompressedIntList() { clear(); }
+
+    void swap(CompressedIntList& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(blockCount, other.blockCount);
+        std::swap(nodeCount, other.nodeCount);
+        std::swap(pending, other.pending);
+        std::swap(pendingCount, other.pendingCount);
+    }
+
+    // ------------------------------------------------------------------------
+    // append(value): O(1). The list stays sorted, so value must be >= the
+    // last value; otherwise nothing changes and false is returned.
+    // Every 128th append compresses the pending values into a block.
+    // ------------------------------------------------------------------------
+    bool append(const T& value) {
+        DS_COUNT_OP("CompressedIntList", "append");
+        if (nodeCount != 0 && value < back()) return false;
+        pending[pendingCount++] = value;
+        nodeCount++;
+        if (pendingCount == BLOCK) sealPending();
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    // searchNode(value): block skipping
+    //
+    // A block whose last value is smaller is skipped on its header alone;
+    // the first block that does not end below `value` is the only one that
+    // can hold it, so at most one block is decoded (then binary search).
+    // ------------------------------------------------------------------------
+    bool searchNode(const T& value) const {
+        DS_TRAVERSAL_SCOPE("CompressedIntList", "searchNode", steps);
+        for (const Block* block = head; block != nullptr; block = block->next) {
+            if (block->last < value) {
+                DS_TRAVERSAL_STEP(steps);
+                continue;
+            }
+            if (value < block->first) return false;
+            std::uint32_t values[BLOCK];
+            block->decode(values);
+            const T* decoded = reinterpret_cast<const T*>(values);
+            return std::binary_search(decoded, decoded + BLOCK, value);
+        }
+        return std::binary_search(pending, pending + pendingCount, value);
+    }
+
+    // ------------------------------------------------------------------------
+    // forEach(f): f(value) for every value in order, one block decoded at a
+    // time into a local buffer (the fastest full scan; no iterator copies)
+    // ------------------------------------------------------------------------
+    template <typename F>
+    void forEach(F f) const {
+        std::uint32_t values[BLOCK];
+        for (const Block* block = head; block != nullptr; block = block->next) {
+            block->decode(values);
+            const T* decoded = reinterpret_cast<const T*>(values);
+            for (std::size_t i = 0; i < BLOCK; i++) f(decoded[i]);
+        }
+        for (std::size_t i = 0; i < pendingCount; i++) f(pending[i]);
+    }
+
+    const_iterator begin() const {
+        const_iterator it(this, 0);
+        it.load(head, false);
+        return it;
+    }
+    const_iterator end() const { return const_iterator(this, nodeCount); }
+
+    std::size_t size() const { return nodeCount; }
+    bool isEmpty() const { return nodeCount == 0; }
+    std::size_t blocks() const { return blockCount; }
+
+    // Smallest and largest value (the list must not be empty)
+    T front() const { return head != nullptr ? head->first : pending[0]; }
+    T back() const { return pendingCount != 0 ? pending[pendingCount - 1] : tail->last; }
+
+    // ------------------------------------------------------------------------
+    // memoryUsage(): payload = packed gaps and exceptions (what the values
+    // shrank to), overhead = block headers + this object (its 512-byte
+    // pending array included), slack = malloc's share of every block
+    // ------------------------------------------------------------------------
+    memusage::MemoryUsage memoryUsage() const {
+        memusage::MemoryUsage usage;
+        usage.elements = nodeCount;
+        usage.overheadBytes = sizeof(*this);
+        usage.heapBlocks = blockCount;
+        for (const Block* block = head; block != nullptr; block = block->next) {
+            std::size_t bytes = block->bytes();
+            usage.payloadBytes += bytes - sizeof(Block);
+            usage.overheadBytes += sizeof(Block);
+            usage.allocatorSlackBytes += memusage::mallocBlockSize(bytes) - bytes;
+        }
+        return usage;
+    }
+
+    void print() const {
+        bool firstValue = true;
+        forEach([&firstValue](const T& value) {
+            if (!firstValue) cout << "  ";
+            cout << value;
+            firstValue = false;
+        });
+        cout << endl;
+    }
+};
+
+#if __cplusplus >= 202002L
+static_assert(std::forward_iterator<CompressedIntList<>::const_iterator>);
+static_assert(std::ranges::forward_range<CompressedIntList<>>);
+#endif
+
+// ============================================================================
+// Demo (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+// ============================================================================
+#ifndef DS_NO_DEMO_MAIN
+int main() {
+    // 1000 sorted ids, gaps of 1..4 with a jump of 100000 every 250 ids
+    CompressedIntList<> ids;
+    int id = 1000;
+    for (int i = 0; i < 1000; i++) {
+        ids.append(id);
+        id += 1 + (i * 7) % 4 + (i % 250 == 249 ? 100000 : 0);
+    }
+    cout << "Values: " << ids.size() << " in " << ids.blocks() << " blocks + "
+         << ids.size() - ids.blocks() * 128 << " pending" << endl;
+
+    memusage::MemoryUsage usage = ids.memoryUsage();
+    cout << "Bytes per value: " << usage.bytesPerElement() << " (LinkedList<int>: 32 with malloc's header)" << endl;
+
+    cout << "First ten: ";
+    int shown = 0;
+    for (int v : ids) {
+        if (shown++ == 10) break;
+        cout << v << " ";
+    }
+    cout << endl;
+    cout << "Contains 1005? " << (ids.searchNode(1005) ? "yes" : "no")
+         << ", contains 1004? " << (ids.searchNode(1004) ? "yes" : "no")
+         << ", contains " << ids.back() << "? " << (ids.searchNode(ids.back()) ? "yes" : "no") << endl;
+
+    cout << "append(5) after " << ids.back() << ": " << (ids.append(5) ? "accepted" : "rejected (not sorted)") << endl;
+
+    long long sum = 0;
+    ids.forEach([&sum](int v) { sum += v; });
+    cout << "Sum through forEach: " << sum << endl;
+
+    int small[] = {-7, -3, 0, 0, 2, 9};
+    CompressedIntList<> negatives(small, small + 6);
+    cout << "From a sorted array: ";
+    negatives.print();
+    return 0;
+}
+#endif // DS_NO_DEMO_MAIN
@@ -0,0 +1,327 @@
+#include <atomic>
+#include <cstddef>      // std::size_t
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>      // std::move
+#include <vector>
+
+#include "EpochReclaim.h"    // epoch::Domain: when an unlinked node may be freed
+#include "Instrumentation.h" // DS_COUNT_* hooks (active only with -DDS_INSTRUMENT)
+#include "MemoryUsage.h"     // memusage::MemoryUsage footprint breakdown
+
+using namespace std;
+
+// ============================================================================
+// CONCURRENT DOUBLY LINKED LIST — STUDY GUIDE VERSION
+// ----------------------------------------------------------------------------
+// DoublyLinkedList is not thread-safe. The simple fix is ONE mutex around the
+// whole list, but then a thread scanning 10^5 nodes for searchAndInsert()
+// blocks every other thread for the whole scan, even threads that will touch
+// a completely different part of the list.
+//
+// This version lets threads work on different parts of the list at once.
+//
+// 1) A LOCK PER NODE. A change between A and B only locks A and B (and the
+//    node being removed). Threads working elsewhere are not affected.
+//
+// 2) Two ways to reach the node to lock:
+//
+//    HAND-OVER-HAND (insertAtPosition): walk from the head holding at most
+//    two locks, like climbing a rope:
+//        lock(head) -> lock(n1), unlock(head) -> lock(n2), unlock(n1) -> ...
+//    Nobody can change the part of the list we are standing on, so
+//    "position k" is exact. Threads queue up behind each other but move
+//    along the list in a pipeline instead of one at a time.
+//
+//    OPTIMISTIC (deleteByValue, searchAndInsert): search WITHOUT locks, then
+//    lock only the nodes to change and VALIDATE that nothing changed in
+//    between:
+//        pred not removed, cur not removed, pred->next still == cur
+//    If validation fails (another thread got there first), start again.
+//    Long scans no longer hold any lock, so they block nobody.
+//
+// 3) LOCK-FREE READERS (searchNode, forEach, displayForward): no locks at
+//    all. A removed node is first MARKED (removed = true) and then unlinked;
+//    its `next` still leads back into the list, so a reader standing on it
+//    simply walks on. Readers skip marked nodes.
+//
+// 4) WHO FREES A REMOVED NODE? A reader may still be standing on it, so it is
+//    handed to epoch-based reclamation (EpochReclaim.h) and deleted once
+//    every reader that could have seen it has finished.
+//
+// DEADLOCK FREEDOM: locks are always taken left to right (a node, then its
+// current successor). Only the FIRST lock of an operation may be a stale or
+// removed node, and the validation step then lets go.
+//
+// Sentinels: `head` and `tail` are dummy links that are never removed, so
+// every real node has a predecessor and a successor to lock.
+//
+// Cost per node: a std::mutex (40 bytes on Linux) and a flag on top of
+// data/next/prev. See memoryUsage().
+// ============================================================================
+
+// Links only (the sentinels have no data)
+struct ConcurrentLink {
+    std::atomic<ConcurrentLink*> next{nullptr};
+    std::atomic<ConcurrentLink*> prev{nullptr};
+    std::atomic<bool> removed{false};   // set under the lock, before unlinking
+    std::mutex lock;
+};
+
+template <typename T>
+struct ConcurrentNode : ConcurrentLink {
+    T data;   // never changes after the node is published
+    explicit ConcurrentNode(const T& val) : data(val) {}
+};
+
+template <typename T = int>
+class ConcurrentDoublyLinkedList {
+private:
+    using Link = ConcurrentLink;
+    using Node = ConcurrentNode<T>;
+
+    Link head;                        // sentinel before the first node
+    Link tail;                        // sentinel after the last node
+    std::atomic<std::size_t> nodeCount{0};
+    mutable epoch::Domain reclaimer;  // removed nodes wait here for readers
+
+    static const T& dataOf(const Link* link) { return static_cast<const Node*>(link)->data; }
+
+    // Link `node` between pred and succ. Caller holds both locks.
+    void linkBetween(Link* pred, Node* node, Link* succ) {
+        node->prev.store(pred, std::memory_order_relaxed);
+        node->next.store(succ, std::memory_order_relaxed);
+        pred->next.store(node, std::memory_order_release);   // publish: readers may now see it
+        succ->prev.store(node, std::memory_order_release);
+        nodeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // First live node holding `value` (lock-free; caller holds a Guard)
+    Link* findLive(const T& value) const {
+        Link* cur = head.next.load(std::memory_order_acquire);
+        while (cur != &tail) {
+            if (!cur->removed.load(std::memory_order_acquire) && dataOf(cur) == value) return cur;
+            cur = cur->next.load(std::memory_order_acquire);
+        }
+        return nullptr;
+    }
+
+public:
+    ConcurrentDoublyLinkedList() {
+        head.next.store(&tail, std::memory_order_relaxed);
+        tail.prev.store(&head, std::memory_order_relaxed);
+    }
+
+    // No other thread may use the list any more: free everything directly
+    ~ConcurrentDoublyLinkedList() {
+        Link* cur = head.next.load(std::memory_order_relaxed);
+        while (cur != &tail) {
+            Link* next = cur->next.load(std::memory_order_relaxed);
+            delete static_cast<Node*>(cur);
+            DS_COUNT_FREE("ConcurrentDoublyLinkedList");
+            cur = next;
+        }
+        reclaimer.drain();
+    }
+
+    ConcurrentDoublyLinkedList(const ConcurrentDoublyLinkedList&) = delete;
+    ConcurrentDoublyLinkedList& operator=(const ConcurrentDoublyLinkedList&) = delete;
+
+    // Approximate while other threads are changing the list
+    std::size_t size() const { return nodeCount.load(std::memory_order_relaxed); }
+    bool isEmpty() const { return size() == 0; }
+
+    // ------------------------------------------------------------------------
+    // insertAtPosition(pos, val): HAND-OVER-HAND
+    // pos is 1-based, 1..size()+1; false if out of range.
+    // ------------------------------------------------------------------------
+    bool insertAtPosition(int pos, const T& val) {
+        DS_COUNT_OP("ConcurrentDoublyLinkedList", "insertAtPosition");
+        if (pos < 1) return false;
+
+        Link* pred = &head;
+        std::unique_lock<std::mutex> predLock(pred->lock);
+        for (int i = 1; i < pos; i++) {
+            Link* next = pred->next.load(std::memory_order_relaxed);
+            if (next == &tail) return false;                 // pos > size + 1
+            std::unique_lock<std::mutex> nextLock(next->lock);
+            predLock = std::move(nextLock);                  // unlocks pred, keeps next
+            pred = next;
+        }
+        Link* succ = pred->next.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> succLock(succ->lock);
+        Node* node = new Node(val);
+        DS_COUNT_ALLOC("ConcurrentDoublyLinkedList");
+        linkBetween(pred, node, succ);
+        return true;
+    }
+
+    void insertAtFront(const T& val) { insertAtPosition(1, val); }
+
+    // ------------------------------------------------------------------------
+    // deleteByValue(target): OPTIMISTIC
+    // Removes one node holding target (the first one the search met).
+    // ------------------------------------------------------------------------
+    bool deleteByValue(const T& target) {
+        DS_COUNT_OP("ConcurrentDoublyLinkedList", "deleteByValue");
+        epoch::Domain::Guard guard(reclaimer);
+        for (;;) {
+            Link* cur = findLive(target);                   // 1) search, no locks
+            if (cur == nullptr) return false;
+            Link* pred = cur->prev.load(std::memory_order_acquire);
+            {
+                std::lock_guard<std::mutex> predLock(pred->lock);   // 2) lock left to right
+                std::lock_guard<std::mutex> curLock(cur->lock);
+                if (pred->removed.load(std::memory_order_relaxed) || cur->removed.load(std::memory_order_relaxed) ||
+                    pred->next.load(std::memory_order_relaxed) != cur) {
+                    continue;                                // 3) changed meanwhile: retry
+                }
+                Link* succ = cur->next.load(std::memory_order_relaxed);
+                std::lock_guard<std::mutex> succLock(succ->lock);
+                cur->removed.store(true, std::memory_order_release);  // readers skip it from now on
+                pred->next.store(succ, std::memory_order_release);
+                succ->prev.store(pred, std::memory_order_release);
+                nodeCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            reclaimer.retire(static_cast<Node*>(cur));       // 4) freed when no reader can see it
+            DS_COUNT_FREE("ConcurrentDoublyLinkedList");
+            return true;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // searchAndInsert(searchVal, newVal): OPTIMISTIC
+    // Inserts newVal right after a node holding searchVal; false if none.
+    // ------------------------------------------------------------------------
+    bool searchAndInsert(const T& searchVal, const T& newVal) {
+        DS_COUNT_OP("ConcurrentDoublyLinkedList", "searchAndInsert");
+        epoch::Domain::Guard guard(reclaimer);
+        Node* node = nullptr;
+        for (;;) {
+            Link* cur = findLive(searchVal);
+            if (cur == nullptr) {
+                delete node;
+                return false;
+            }
+            if (node == nullptr) {
+                node = new Node(newVal);                     // allocate outside the locks
+                DS_COUNT_ALLOC("ConcurrentDoublyLinkedList");
+            }
+            std::lock_guard<std::mutex> curLock(cur->lock);
+            if (cur->removed.load(std::memory_order_relaxed)) continue;   // removed meanwhile: retry
+            Link* succ = cur->next.load(std::memory_order_relaxed);      // stable: cur is locked
+            std::lock_guard<std::mutex> succLock(succ->lock);
+            linkBetween(cur, node, succ);
+            return true;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // LOCK-FREE READERS
+    // ------------------------------------------------------------------------
+    bool searchNode(const T& value) const {
+        DS_COUNT_OP("ConcurrentDoublyLinkedList", "searchNode");
+        epoch::Domain::Guard guard(reclaimer);
+        return findLive(value) != nullptr;
+    }
+
+    // f(value) for every live node, front to back. Nodes inserted or removed
+    // during the walk may or may not be seen; nothing is seen twice.
+    template <typename F>
+    void forEach(F f) const {
+        epoch::Domain::Guard guard(reclaimer);
+        for (Link* cur = head.next.load(std::memory_order_acquire); cur != &tail;
+             cur = cur->next.load(std::memory_order_acquire)) {
+            if (!cur->removed.load(std::memory_order_acquire)) f(dataOf(cur));
+        }
+    }
+
+    std::vector<T> toVector() const {
+        std::vector<T> values;
+        values.reserve(size());
+        forEach([&values](const T& v) { values.push_back(v); });
+        return values;
+    }
+
+    void displayForward() const {
+        cout << "Forward: ";
+        forEach([](const T& v) { cout << v << " "; });
+        cout << endl;
+    }
+
+    // Back links are also published atomically, so the backward walk is
+    // lock-free too
+    void displayBackward() const {
+        epoch::Domain::Guard guard(reclaimer);
+        cout << "Backward: ";
+        for (Link* cur = tail.prev.load(std::memory_order_acquire); cur != &head;
+             cur = cur->prev.load(std::memory_order_acquire)) {
+            if (!cur->removed.load(std::memory_order_acquire)) cout << dataOf(cur) << " ";
+        }
+        cout << endl;
+    }
+
+    // Nodes carry a mutex + flag on top of data/next/prev; the container
+    // holds two sentinels and the epoch slots (one cache line per thread).
+    // Nodes waiting for reclamation are not counted.
+    memusage::MemoryUsage memoryUsage() const {
+        std::size_t n = size();
+        memusage::MemoryUsage usage;
+        usage.elements = n;
+        usage.payloadBytes = n * sizeof(T);
+        usage.overheadBytes = n * (sizeof(Node) - sizeof(T)) + sizeof(*this);
+        usage.allocatorSlackBytes = n * (memusage::mallocBlockSize(sizeof(Node)) - sizeof(Node));
+        usage.heapBlocks = n;
+        return usage;
+    }
+};
+
+// ============================================================================
+// TEST HARNESS (main) — four threads change the list at once
+// ============================================================================
+
+#ifndef DS_NO_DEMO_MAIN   // define it to #include this file from a benchmark
+int main() {
+    ConcurrentDoublyLinkedList<int> list;
+    for (int i = 1; i <= 5; i++) list.insertAtPosition(i, i * 10);   // 10 20 30 40 50
+    list.displayForward();
+
+    // Threads 0-1 insert after 10 and 50, threads 2-3 add and then remove
+    // their own values, while the main thread keeps reading
+    vector<thread> workers;
+    for (int t = 0; t < 4; t++) {
+        workers.emplace_back([&list, t] {
+            for (int i = 0; i < 1000; i++) {
+                if (t < 2) {
+                    list.searchAndInsert(t == 0 ? 10 : 50, 1000 + t);
+                } else {
+                    int value = t * 10000 + i;
+                    list.insertAtPosition(1 + i % 3, value);
+                    list.deleteByValue(value);
+                }
+            }
+        });
+    }
+    size_t reads = 0;
+    while (reads < 2000) {
+        if (list.searchNode(30)) reads++;   // 30 is never removed
+    }
+    for (thread& w : workers) w.join();
+
+    size_t after10 = 0, after50 = 0;
+    list.forEach([&](int v) {
+        if (v == 1000) after10++;
+        if (v == 1001) after50++;
+    });
+    cout << "size " << list.size() << " (expected 2005), inserted after 10: " << after10
+         << ", after 50: " << after50 << endl;
+
+    list.deleteByValue(1000);
+    list.deleteByValue(1001);
+    cout << "After removing one 1000 and one 1001, size " << list.size() << endl;
+    cout << "Contains 25? " << (list.searchNode(25) ? "yes" : "no") << endl;
+    cout << "Bytes per element: " << list.memoryUsage().bytesPerElement() << endl;
+    return 0;
+}
+#endif // DS_NO_DEMO_MAIN
@@ -133,7 +133,28 @@ int main() {
 #include <iostream>
 using namespace std;*/
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <string>
+#if __cplusplus >= 202002L
+#include <ranges>
+#include <span>
+#endif
+
+#include <thread>
+#include <vector>
+#include "ChainPrefetch.h"
+#include "Instrumentation.h"
+#include "ListSnapshot.h"
+#include "MemoryUsage.h"
+#include "ListSort.h"
+#include "NodeArena.h"
+#include "NodeIterators.h"
+#include "Serialization.h"
+#include "ValueIndex.h"
+
 using namespace std;
 
 /*
@@ -150,54 +171,148 @@ using namespace std;
       - Insertion/deletion in the middle requires updating BOTH directions.
 */
 
+template <typename T>
 struct Node {
-    int data;
+    T data;
     Node* next;
     Node* prev;
 
-    Node(int val) : data(val), next(nullptr), prev(nullptr) {}
+    Node(const T& val) : data(val), next(nullptr), prev(nullptr) {}
+
+    // compact() may move nodes into an arena: delete finds out which,
+    // and new refills the arena's holes (NodeArena.h)
+    static void* operator new(std::size_t bytes) { return nodearena::Registry<Node>::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) {
+        nodearena::Registry<Node>::deallocate(p, bytes);
+    }
 };
 
+template <typename T = int>
 class DoublyLinkedList {
 private:
-    Node* head;
+    Node<T>* head;
+    std::size_t nodeCount;   // number of nodes, maintained by every insert/delete
+    nodearena::Compactor<Node<T>> compactor;   // compactStep() progress
+
+    // Optional value -> node index (enableValueIndex, ValueIndex.h).
+    // Compaction re-points the entry of each node it moves (IndexMoves).
+    valueindex::RobinHoodIndex<T, Node<T>*, valueindex::NodeKey<Node<T>>> valueIndex;
+    bool indexed = false;
+
+    bool rebuildValueIndex() {
+        valueIndex.clear();
+        valueIndex.reserve(nodeCount);
+        for (Node<T>* cur = head; cur != nullptr; cur = cur->next) {
+            if (!valueIndex.insert(cur->data, cur)) return false;
+        }
+        return true;
+    }
+
+    // A new node was linked; a duplicate value switches the index off
+    void indexAdd(Node<T>* node) {
+        if (indexed && !valueIndex.insert(node->data, node)) disableValueIndex();
+    }
+
+    // A node is about to be deleted
+    void indexRemove(Node<T>* node) {
+        if (indexed) valueIndex.erase(node->data);
+    }
+
+    // Compactor callback: the node moved from `from` to `to`
+    struct IndexMoves {
+        DoublyLinkedList* list;
+        void operator()(Node<T>* from, Node<T>* to) const {
+            if (list->indexed) list->valueIndex.repoint(to->data, from, to);
+        }
+    };
 
     // ------------------------------------------------------------
     // Helper: Get pointer to node at 1-based position (pos)
     // Returns nullptr if pos is out of range.
     // ------------------------------------------------------------
-    Node* getNodeAtPosition(int pos) {
+    Node<T>* getNodeAtPosition(int pos) {
         if (pos < 1) return nullptr;
-        Node* cur = head;
+        DS_TRAVERSAL_SCOPE("DoublyLinkedList", "getNodeAtPosition", steps);
+        DS_PERF_REGION("DoublyLinkedList::getNodeAtPosition");
+        Node<T>* cur = head;
         int idx = 1;
         while (cur != nullptr && idx < pos) {
             cur = cur->next;
             idx++;
+            DS_TRAVERSAL_STEP(steps);
         }
         return cur; // may be nullptr if pos > length
     }
 
 public:
+    // ------------------------------------------------------------
+    // Iterators: bidirectional (each node has next AND prev).
+    // There is no tail pointer, so --end() walks to the last node once.
+    // ------------------------------------------------------------
+    using iterator = BidirectionalNodeIterator<Node<T>, T>;
+    using const_iterator = BidirectionalNodeIterator<const Node<T>, const T>;
+
     // ------------------------------------------------------------
     // Constructor / Destructor
     // ------------------------------------------------------------
-    DoublyLinkedList() : head(nullptr) {}
+    DoublyLinkedList() : head(nullptr), nodeCount(0) {}
 
     ~DoublyLinkedList() {
-        Node* cur = head;
+        clear();
+    }
+
+    // ------------------------------------------------------------
+    // Helper: free every node (destructor / loadSnapshot)
+    // ------------------------------------------------------------
+    void clear() {
+        compactor.abandon();
+        Node<T>* cur = head;
         while (cur != nullptr) {
-            Node* nxt = cur->next;
+            Node<T>* nxt = cur->next;
             delete cur;          // release memory for each node
+            DS_COUNT_FREE("DoublyLinkedList");
             cur = nxt;
         }
         head = nullptr;
+        nodeCount = 0;
+        valueIndex.clear();
+    }
+
+    // ------------------------------------------------------------
+    // Range access (range-for, <algorithm>, std::execution)
+    // ------------------------------------------------------------
+    iterator begin() { return iterator(head, &head, false); }
+    iterator end() { return iterator(nullptr, &head, false); }
+    const_iterator begin() const { return const_iterator(head, &head, false); }
+    const_iterator end() const { return const_iterator(nullptr, &head, false); }
+
+    std::size_t size() const { return nodeCount; }
+    bool isEmpty() const { return head == nullptr; }
+
+    // ------------------------------------------------------------
+    // Memory footprint (see MemoryUsage.h)
+    // Each node carries TWO pointers next to its int, so the link
+    // overhead is 16 of every 24 node bytes (plus malloc slack).
+    // O(n): fragmentation is measured by walking the chain.
+    // An enabled value index adds its table as overhead.
+    // ------------------------------------------------------------
+    memusage::MemoryUsage memoryUsage() const {
+        memusage::MemoryUsage usage = memusage::nodeChainUsage<Node<T>, T>(head, nodeCount, sizeof(*this));
+        if (valueIndex.bytes() != 0) {
+            usage.overheadBytes += valueIndex.bytes();
+            usage.heapBlocks++;
+        }
+        return usage;
     }
 
     // ------------------------------------------------------------
     // Helper: Insert at front (used by insertAtPosition)
     // ------------------------------------------------------------
-    void insertAtFront(int val) {
-        Node* newNode = new Node(val);
+    void insertAtFront(const T& val) {
+        DS_COUNT_OP("DoublyLinkedList", "insertAtFront");
+        Node<T>* newNode = new Node<T>(val);
+        DS_COUNT_ALLOC("DoublyLinkedList");
+        nodeCount++;
 
         newNode->next = head;      // new node points forward to old head
         newNode->prev = nullptr;   // new head has no previous
@@ -207,6 +322,7 @@ public:
         }
 
         head = newNode;            // update head to new node
+        indexAdd(newNode);
     }
 
     // ------------------------------------------------------------
@@ -214,7 +330,7 @@ public:
     // ------------------------------------------------------------
     void displayForward() const {
         cout << "Forward: ";
-        Node* cur = head;
+        Node<T>* cur = head;
         while (cur != nullptr) {
             cout << cur->data << " ";
             cur = cur->next;
@@ -233,7 +349,7 @@ public:
         }
 
         // go to tail
-        Node* tail = head;
+        Node<T>* tail = head;
         while (tail->next != nullptr) tail = tail->next;
 
         // traverse backward
@@ -268,7 +384,8 @@ public:
           true  = inserted successfully
           false = invalid position (pos > length+1 or pos < 1)
     */
-    bool insertAtPosition(int pos, int val) {
+    bool insertAtPosition(int pos, const T& val) {
+        DS_COUNT_OP("DoublyLinkedList", "insertAtPosition");
         // Case A: invalid position
         if (pos < 1) return false;
 
@@ -286,14 +403,16 @@ public:
             If current is nullptr, we might still insert at the end
             ONLY if previous exists and pos == length+1.
         */
-        Node* previous = getNodeAtPosition(pos - 1);
+        Node<T>* previous = getNodeAtPosition(pos - 1);
         if (previous == nullptr) {
             // Means pos-1 doesn't exist => pos too large
             return false;
         }
 
-        Node* current = previous->next;  // could be nullptr if inserting at end
-        Node* newNode = new Node(val);
+        Node<T>* current = previous->next;  // could be nullptr if inserting at end
+        Node<T>* newNode = new Node<T>(val);
+        DS_COUNT_ALLOC("DoublyLinkedList");
+        nodeCount++;
 
         // Link new node with its neighbors
         newNode->prev = previous;
@@ -307,6 +426,7 @@ public:
             current->prev = newNode;
         }
 
+        indexAdd(newNode);
         return true;
     }
 
@@ -331,16 +451,25 @@ public:
           true  = node found and deleted
           false = target not found (no deletion)
     */
-    bool deleteByValue(int target) {
-        Node* cur = head;
-
-        // Step 1: Find the node
-        while (cur != nullptr && cur->data != target) {
-            cur = cur->next;
+    bool deleteByValue(const T& target) {
+        DS_COUNT_OP("DoublyLinkedList", "deleteByValue");
+        DS_TRAVERSAL_SCOPE("DoublyLinkedList", "deleteByValue", steps);
+        Node<T>* cur = head;
+
+        // Step 1: Find the node (one hash lookup when indexed)
+        if (indexed) {
+            Node<T>** found = valueIndex.find(target);
+            cur = found != nullptr ? *found : nullptr;
+        } else {
+            while (cur != nullptr && cur->data != target) {
+                cur = cur->next;
+                DS_TRAVERSAL_STEP(steps);
+            }
         }
 
         // Not found
         if (cur == nullptr) return false;
+        indexRemove(cur);
 
         // Step 2: Re-link neighbors
 
@@ -362,6 +491,8 @@ public:
 
         // Step 3: Free memory
         delete cur;
+        DS_COUNT_FREE("DoublyLinkedList");
+        nodeCount--;
 
         return true;
     }
@@ -389,10 +520,12 @@ public:
           false = invalid pos (out of range)
     */
     bool deleteAtPosition(int pos) {
+        DS_COUNT_OP("DoublyLinkedList", "deleteAtPosition");
         if (pos < 1) return false;
 
-        Node* toDelete = getNodeAtPosition(pos);
+        Node<T>* toDelete = getNodeAtPosition(pos);
         if (toDelete == nullptr) return false; // pos out of range
+        indexRemove(toDelete);
 
         // If deleting head
         if (toDelete == head) {
@@ -401,12 +534,14 @@ public:
                 head->prev = nullptr;
             }
             delete toDelete;
+            DS_COUNT_FREE("DoublyLinkedList");
+            nodeCount--;
             return true;
         }
 
         // Deleting middle or tail
-        Node* left = toDelete->prev;
-        Node* right = toDelete->next;
+        Node<T>* left = toDelete->prev;
+        Node<T>* right = toDelete->next;
 
         // Bridge left -> right
         if (left != nullptr) left->next = right;
@@ -415,14 +550,18 @@ public:
         if (right != nullptr) right->prev = left;
 
         delete toDelete;
+        DS_COUNT_FREE("DoublyLinkedList");
+        nodeCount--;
         return true;
     }
 
     //Delete node from beginning
     void deleteFromBeginning() {
+        DS_COUNT_OP("DoublyLinkedList", "deleteFromBeginning");
         if (head == nullptr) return; // List is empty
 
-        Node* toDelete = head;
+        Node<T>* toDelete = head;
+        indexRemove(toDelete);
         head = head->next; // Move head forward
 
         if (head != nullptr) {
@@ -430,6 +569,8 @@ public:
         }
 
         delete toDelete; // Free memory
+        DS_COUNT_FREE("DoublyLinkedList");
+        nodeCount--;
     }
 
     // ============================================================
@@ -460,20 +601,30 @@ public:
           true  = found and inserted
           false = searchVal not found
     */
-    bool searchAndInsert(int searchVal, int newVal) {
-        Node* cur = head;
-
-        // Step 1: Search
-        while (cur != nullptr && cur->data != searchVal) {
-            cur = cur->next;
+    bool searchAndInsert(const T& searchVal, const T& newVal) {
+        DS_COUNT_OP("DoublyLinkedList", "searchAndInsert");
+        DS_TRAVERSAL_SCOPE("DoublyLinkedList", "searchAndInsert", steps);
+        Node<T>* cur = head;
+
+        // Step 1: Search (one hash lookup when indexed)
+        if (indexed) {
+            Node<T>** found = valueIndex.find(searchVal);
+            cur = found != nullptr ? *found : nullptr;
+        } else {
+            while (cur != nullptr && cur->data != searchVal) {
+                cur = cur->next;
+                DS_TRAVERSAL_STEP(steps);
+            }
         }
 
         // Not found
         if (cur == nullptr) return false;
 
         // Step 2: Insert AFTER cur
-        Node* after = cur->next;
-        Node* newNode = new Node(newVal);
+        Node<T>* after = cur->next;
+        Node<T>* newNode = new Node<T>(newVal);
+        DS_COUNT_ALLOC("DoublyLinkedList");
+        nodeCount++;
 
         newNode->prev = cur;
         newNode->next = after;
@@ -484,13 +635,239 @@ public:
             after->prev = newNode;
         }
 
+        indexAdd(newNode);
         return true;
     }
+
+    // ============================================================
+    // VALUE INDEX (see ValueIndex.h)
+    // ============================================================
+    /*
+        enableValueIndex()
+          For lists of UNIQUE values (ids): build a hash index
+          value -> node in O(n). searchAndInsert and deleteByValue
+          then find their node with one lookup instead of a walk;
+          every insert/delete keeps the index up to date, and the
+          list order does not change.
+          Returns false (no index) if a value occurs twice or T has
+          no std::hash. Inserting a duplicate later switches the
+          index off again (hasValueIndex() tells).
+
+        Do not change values through iterators while indexed.
+        Cost: 16 bytes per table slot, 20-40 bytes per element.
+    */
+    bool enableValueIndex() {
+        if constexpr (!valueindex::IsHashable<T>::value) {
+            return false;
+        } else {
+            indexed = rebuildValueIndex();
+            if (!indexed) valueIndex.release();
+            return indexed;
+        }
+    }
+
+    void disableValueIndex() {
+        indexed = false;
+        valueIndex.release();
+    }
+
+    bool hasValueIndex() const { return indexed; }
+    std::size_t valueIndexBytes() const { return valueIndex.bytes(); }
+    double valueIndexProbeLength() const { return valueIndex.averageProbeLength(); }
+
+    // ============================================================
+    // SORTING (stable merge sort, see ListSort.h)
+    // ============================================================
+    /*
+        sort() / sortBottomUp() / sortParallel(tasks)
+
+        The merge sort only follows and rewrites `next` pointers,
+        exactly like for a singly linked list. Afterwards one pass
+        (listsort::relinkPrev) restores every `prev` pointer:
+          cur->prev = previous node in the new order
+
+        No node is allocated or copied.
+    */
+    void sort() {
+        DS_COUNT_OP("DoublyLinkedList", "sort");
+        DS_PERF_REGION("DoublyLinkedList::sort");
+        head = listsort::mergeSortTopDown(head);
+        listsort::relinkPrev(head);
+    }
+
+    void sortBottomUp() {
+        DS_COUNT_OP("DoublyLinkedList", "sortBottomUp");
+        DS_PERF_REGION("DoublyLinkedList::sortBottomUp");
+        head = listsort::mergeSortBottomUp(head);
+        listsort::relinkPrev(head);
+    }
+
+    void sortParallel(unsigned tasks = std::thread::hardware_concurrency()) {
+        DS_COUNT_OP("DoublyLinkedList", "sortParallel");
+        DS_PERF_REGION("DoublyLinkedList::sortParallel");
+        head = listsort::mergeSortParallel(head, nodeCount, tasks);
+        listsort::relinkPrev(head);
+    }
+
+    /*
+        radixSort()
+          Integer keys only: LSD radix sort, one byte per pass through
+          256 bucket head/tail pairs. Same prev fix-up afterwards.
+    */
+    void radixSort() {
+        DS_COUNT_OP("DoublyLinkedList", "radixSort");
+        DS_PERF_REGION("DoublyLinkedList::radixSort");
+        head = listsort::radixSort(head);
+        listsort::relinkPrev(head);
+    }
+
+    // ============================================================
+    // COMPACTION (see NodeArena.h)
+    // ============================================================
+    /*
+        compact()
+          Churn (insertAtPosition / deleteByValue ...) scatters the nodes
+          over the heap, and every hop of a walk becomes a cache miss.
+          compact() moves every node into one block in list order,
+          fixing next AND prev around each one, and reports one walk's
+          time per node before and after.
+
+        compactStep(maxNodes)
+          The same pass in slices of at most maxNodes nodes, so no
+          single call pauses for long; true when the pass is finished.
+          The list can be used normally between slices.
+
+        Both invalidate iterators and node pointers; the value index
+        (if on) is re-pointed node by node as they move.
+
+        setArenaBacking(backing)
+          Where the next arena comes from: 2 MB pages (fewer TLB
+          misses on huge lists) and/or a NUMA policy (Linux only).
+    */
+    nodearena::CompactReport compact() {
+        DS_COUNT_OP("DoublyLinkedList", "compact");
+        DS_PERF_REGION("DoublyLinkedList::compact");
+        nodearena::CompactReport report;
+        report.nodes = nodeCount;
+        report.nsPerNodeBefore = nodearena::traversalNsPerNode(head, nodeCount);
+        compactor.abandon();   // a sliced pass in progress starts over
+        while (!compactor.step(head, nodeCount, SIZE_MAX, nullptr, IndexMoves{this})) {}
+        report.movedNodes = compactor.movedNodes();
+        report.nsPerNodeAfter = nodearena::traversalNsPerNode(head, nodeCount);
+        report.pages = compactor.obtainedPages();
+        report.numaApplied = compactor.numaApplied();
+        return report;
+    }
+
+    bool compactStep(std::size_t maxNodes) {
+        DS_COUNT_OP("DoublyLinkedList", "compactStep");
+        DS_PERF_REGION("DoublyLinkedList::compactStep");
+        return compactor.step(head, nodeCount, maxNodes, nullptr, IndexMoves{this});
+    }
+
+    // Huge pages / NUMA policy for the arenas of later passes
+    void setArenaBacking(const nodearena::Backing& backing) { compactor.setBacking(backing); }
+
+    // ============================================================
+    // BATCHED POSITION LOOKUPS (see ChainPrefetch.h)
+    // ============================================================
+    /*
+        getAtPositions(positions, n, out, inRange)
+          n getNodeAtPosition() calls walk the chain n times. This sorts
+          the positions and collects them all in ONE walk from head
+          (prefetching the next node as it goes).
+          out[i] = value at 1-based positions[i]; inRange[i] = false
+          (and out[i] untouched) when the position does not exist.
+    */
+    void getAtPositions(const int* positions, std::size_t n, T* out, bool* inRange) const {
+        DS_COUNT_OP("DoublyLinkedList", "getAtPositions");
+        DS_PERF_REGION("DoublyLinkedList::getAtPositions");
+        std::vector<const Node<T>*> nodes(n);
+        chainwalk::nodesAtPositions<const Node<T>>(head, positions, n, nodes.data());
+        for (std::size_t i = 0; i < n; i++) {
+            inRange[i] = nodes[i] != nullptr;
+            if (inRange[i]) out[i] = nodes[i]->data;
+        }
+    }
+
+#if __cplusplus >= 202002L
+    void getAtPositions(std::span<const int> positions, std::span<T> out, std::span<bool> inRange) const {
+        getAtPositions(positions.data(), std::min({positions.size(), out.size(), inRange.size()}), out.data(),
+                       inRange.data());
+    }
+#endif
+
+    // ============================================================
+    // SNAPSHOTS (file layout in ListSnapshot.h)
+    // ============================================================
+    /*
+        saveSnapshot(path)
+          Walk head -> tail once and stream the values to disk.
+
+        loadSnapshot(view)
+          Rebuild a mutable list from a read-only mmap view.
+          Each new node is linked after the previous one, so both
+          next and prev are set in a single O(n) pass.
+    */
+    void saveSnapshot(const string& path) const {
+        snapshot::SnapshotWriter<T> writer(path, snapshot::Kind::DoublyLinkedList);
+        for (Node<T>* cur = head; cur != nullptr; cur = cur->next) {
+            writer.append(cur->data);
+        }
+        writer.finish();
+    }
+
+    void loadSnapshot(const snapshot::SnapshotView<T>& view) {
+        clear();
+        Node<T>* tail = nullptr;
+        for (const T& value : view) {
+            Node<T>* newNode = new Node<T>(value);
+            DS_COUNT_ALLOC("DoublyLinkedList");
+            newNode->prev = tail;
+            if (tail == nullptr) head = newNode;
+            else tail->next = newNode;
+            tail = newNode;
+        }
+        nodeCount = view.size();
+        if (indexed && !rebuildValueIndex()) disableValueIndex();
+    }
+
+    // ============================================================
+    // BINARY SERIALIZATION (format in Serialization.h)
+    // ============================================================
+    /*
+        serialize(path, encoding)
+          head -> tail. Raw values go to writev straight from the
+          nodes; Auto picks DeltaVarint for a sorted int list.
+
+        deserialize(path)
+          All nodes are built in ONE arena allocation (buildChain,
+          NodeArena.h), next and prev linked as they are made.
+    */
+    void serialize(const string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        serial::save<T>(path, serial::Kind::DoublyLinkedList, begin(), end(), nodeCount, encoding);
+    }
+
+    void deserialize(const string& path) {
+        serial::Reader<T> in(path);
+        clear();
+        head = nodearena::buildChain<Node<T>>(in.size(), [&in] { return in.next(); });
+        nodeCount = in.size();
+        DS_COUNT_ALLOCS("DoublyLinkedList", nodeCount);
+        if (indexed && !rebuildValueIndex()) disableValueIndex();
+    }
 };
 
+#if __cplusplus >= 202002L
+static_assert(std::ranges::bidirectional_range<DoublyLinkedList<>>);
+static_assert(std::ranges::sized_range<DoublyLinkedList<>>);
+#endif
+
 // ------------------------------------------------------------
 // Demo main() (optional)
+// Define DS_NO_DEMO_MAIN to #include this file from a benchmark.
 // ------------------------------------------------------------
+#ifndef DS_NO_DEMO_MAIN
 int main() {
     DoublyLinkedList dll;
 
@@ -502,6 +879,13 @@ int main() {
     dll.displayForward();
     dll.displayBackward();
 
+    // Same backward walk through bidirectional iterators
+    cout << "Reverse iterators (size " << dll.size() << "): ";
+    for (auto it = std::make_reverse_iterator(dll.end()); it != std::make_reverse_iterator(dll.begin()); ++it) {
+        cout << *it << " ";
+    }
+    cout << "\n";
+
     dll.insertAtPosition(3, 99);
     cout << "\nAfter insertAtPosition(3, 99):\n";
     dll.displayForward();
@@ -518,8 +902,50 @@ int main() {
     cout << "\nAfter deleteAtPosition(2):\n";
     dll.displayForward();
 
+    dll.sort();
+    cout << "\nAfter sort():\n";
+    dll.displayForward();
+    dll.displayBackward();
+
+    // Several positions, one walk
+    int positions[3] = {4, 1, 9};
+    int values[3];
+    bool inRange[3];
+    dll.getAtPositions(positions, 3, values, inRange);
+    cout << "getAtPositions {4, 1, 9}: ";
+    for (int i = 0; i < 3; i++) {
+        if (inRange[i]) cout << values[i] << " ";
+        else cout << "(none) ";
+    }
+    cout << "\n";
+
+    // Compact in slices of 2 nodes, then walk both ways
+    int slices = 1;
+    while (!dll.compactStep(2)) slices++;
+    cout << "compactStep(2): done after " << slices << " slices, fragmentation "
+         << dll.memoryUsage().fragmentation << "\n";
+    dll.displayForward();
+    dll.displayBackward();
+
+    // Unique values: index them (the compaction above left the index
+    // stale, the first indexed call rebuilds it)
+    if (dll.enableValueIndex()) {
+        dll.compactStep(2);
+        dll.searchAndInsert(10, 25);
+        dll.deleteByValue(40);
+        cout << "Indexed: inserted 25 after 10, deleted 40 (index "
+             << dll.valueIndexBytes() << " bytes)\n";
+        dll.displayForward();
+    }
+
+#if defined(DS_INSTRUMENT)
+    // getNodeAtPosition / search lengths, allocations and frees so far
+    cout << "\nStats: " << instr::toJson(instr::takeSnapshot()) << "\n";
+#endif
+
     return 0;
 }
+#endif // DS_NO_DEMO_MAIN
 
 /*
 ============================================================
@@ -1,57 +1,131 @@
 
+#include <cstddef>
 #include <iostream>
+#include <string>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+#include "ErrorPolicy.h"
+#include "Instrumentation.h"
+#include "ListSnapshot.h"
+#include "MemoryUsage.h"
+#include "NodeIterators.h"
+#include "ValueIndex.h"
+
 using namespace std;
 
+template <typename T>
 class Node {
 public:
-    int data;
+    T data;
     Node* next;
 
-    Node(int val) {
+    Node(const T& val) {
         data = val;
         next = nullptr;
     }
 };
 
+// ErrorPolicy (see ErrorPolicy.h) decides how deleteNode() reports an empty
+// list or a missing value: Print (default, the original messages), Silent,
+// Throw, ReturnExpected or Callback<f>.
+//
+// enableValueIndex() adds a hash index value -> node (ValueIndex.h) for lists
+// of unique values: searchAndInsert() and deleteNode() then find their node
+// in O(1) instead of walking from head. The list order is unchanged.
+template <typename T = int, typename ErrorPolicy = errpolicy::Print>
 class LinkedListImplementation {
 private:
-    Node* head;
+    Node<T>* head;
+    Node<T>** tailLink;    // where insertAtEnd links the next node (&head when empty)
+    std::size_t nodeCount; // number of nodes (updated on every insert/delete)
+
+    // The index maps a value to the LINK that points at its node (&head or
+    // &pred->next): deleting needs the predecessor, and a singly linked node
+    // does not know it. Every insert/delete keeps the links up to date.
+    valueindex::RobinHoodIndex<T, Node<T>**, valueindex::LinkKey<Node<T>>> valueIndex;
+    bool indexed = false;
+
+    // `link` now leads to a new node; a value that is already indexed
+    // switches the index off (values must be unique)
+    void indexAdd(const T& val, Node<T>** link) {
+        if (indexed && !valueIndex.insert(val, link)) disableValueIndex();
+    }
+
+    // `node` is now reached through `link`
+    void relinkIndexed(Node<T>* node, Node<T>** link) {
+        if (indexed && node != nullptr) *valueIndex.find(node->data) = link;
+    }
+
+    bool rebuildValueIndex() {
+        valueIndex.clear();
+        valueIndex.reserve(nodeCount);
+        for (Node<T>** link = &head; *link != nullptr; link = &(*link)->next) {
+            if (!valueIndex.insert((*link)->data, link)) return false;
+        }
+        return true;
+    }
+
+    // Link a new node right after `current` (searchAndInsert)
+    void insertAfter(Node<T>* current, const T& newVal) {
+        Node<T>* newNode = new Node<T>(newVal);
+        DS_COUNT_ALLOC("LinkedListImplementation");
+
+        // Insert after the found node (the old successor is re-indexed
+        // first, while every link in the index still leads to its node)
+        newNode->next = current->next;
+        relinkIndexed(newNode->next, &newNode->next);
+        current->next = newNode;
+        if (tailLink == &current->next) tailLink = &newNode->next;
+        indexAdd(newVal, &current->next);
+        nodeCount++;
+    }
 
 public:
+    // Forward iterators over the chain
+    using iterator = NodeIterator<Node<T>, T>;
+    using const_iterator = NodeIterator<const Node<T>, const T>;
+
     LinkedListImplementation() {
         head = nullptr;
+        tailLink = &head;
+        nodeCount = 0;
     }
 
-    // Insert at end (simple helper)
-    void insertAtEnd(int val) {
-        Node* newNode = new Node(val);
+    // tailLink and the index point into this object: no shallow copies
+    LinkedListImplementation(const LinkedListImplementation&) = delete;
+    LinkedListImplementation& operator=(const LinkedListImplementation&) = delete;
 
-        if (head == nullptr) {
-            head = newNode;
-            return;
-        }
+    // Insert at end (simple helper), O(1) through tailLink
+    void insertAtEnd(const T& val) {
+        DS_COUNT_OP("LinkedListImplementation", "insertAtEnd");
+        Node<T>* newNode = new Node<T>(val);
+        DS_COUNT_ALLOC("LinkedListImplementation");
+        nodeCount++;
 
-        Node* temp = head;
-        while (temp->next != nullptr) {
-            temp = temp->next;
-        }
-        temp->next = newNode;
+        *tailLink = newNode;
+        indexAdd(val, tailLink);
+        tailLink = &newNode->next;
     }
 
     // Function 05: Search for a value and insert a new node after that value
-    bool searchAndInsert(int searchVal, int newVal) {
-        Node* current = head; // Start at the head
+    bool searchAndInsert(const T& searchVal, const T& newVal) {
+        DS_COUNT_OP("LinkedListImplementation", "searchAndInsert");
+        if (indexed) {
+            Node<T>** const* link = valueIndex.find(searchVal);
+            if (link == nullptr) return false;   // Value not found
+            insertAfter(**link, newVal);
+            return true;
+        }
+
+        DS_TRAVERSAL_SCOPE("LinkedListImplementation", "searchAndInsert", steps);
+        Node<T>* current = head; // Start at the head
 
         while (current != nullptr) {
+            DS_TRAVERSAL_STEP(steps);
             if (current->data == searchVal) {
-
-                // Create the new node
-                Node* newNode = new Node(newVal);
-
-                // Insert after the found node
-                newNode->next = current->next;
-                current->next = newNode;
-
+                insertAfter(current, newVal);
                 return true; // Insertion successful
             }
 
@@ -61,55 +135,104 @@ public:
         return false; // Value not found
     }
 
+    // ------------------------------------------------------------------------
+    // Value index (ValueIndex.h)
+    // ------------------------------------------------------------------------
+    // Build the index from the current contents, O(n). False (and no index)
+    // if two nodes hold the same value or T has no std::hash.
+    bool enableValueIndex() {
+        if constexpr (!valueindex::IsHashable<T>::value) {
+            return false;
+        } else {
+            indexed = rebuildValueIndex();
+            if (!indexed) valueIndex.release();
+            return indexed;
+        }
+    }
+
+    void disableValueIndex() {
+        indexed = false;
+        valueIndex.release();
+    }
+
+    bool hasValueIndex() const { return indexed; }
+    std::size_t valueIndexBytes() const { return valueIndex.bytes(); }
+    double valueIndexProbeLength() const { return valueIndex.averageProbeLength(); }
+
     //Function 06: Delete or deallocate memories
     ~LinkedListImplementation() {
         //Destructor to deallocate memory
-        Node* temp = head;
-        Node* nextNode = nullptr;
+        clear();
+    }
+
+    //Free every node and leave an empty list
+    void clear() {
+        Node<T>* temp = head;
+        Node<T>* nextNode = nullptr;
 
         while (temp != nullptr) {
             nextNode = temp->next;
             delete temp;
+            DS_COUNT_FREE("LinkedListImplementation");
             temp = nextNode;
         }
+        head = nullptr;
+        tailLink = &head;
+        nodeCount = 0;
+        valueIndex.clear();
     }
 
     //Function 07: Delete from a given node value
-    void deleteNode(int value) {
+    typename ErrorPolicy::status_type deleteNode(const T& value) {
+        DS_COUNT_OP("LinkedListImplementation", "deleteNode");
+        DS_TRAVERSAL_SCOPE("LinkedListImplementation", "deleteNode", steps);
         if (head == nullptr){
-            cout << "List is empty. Cannot delete." << endl;
-            return;
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "List is empty. Cannot delete." << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Underflow, "LinkedListImplementation::deleteNode: list is empty");
         }
 
-        Node* current = head;
-        //Traverse the list to find the node with the given value
-        Node* prev = nullptr;
-        while (current != nullptr && current->data != value) {
-            prev = current;
-            current = current->next;
+        //Find the link (head or prev->next) that points to the node with the
+        //given value: from the index, or by traversing the list
+        Node<T>** link = &head;
+        if (indexed) {
+            Node<T>** const* found = valueIndex.find(value);
+            if (found != nullptr) link = *found;
+            else link = nullptr;
+        } else {
+            while (*link != nullptr && (*link)->data != value) {
+                link = &(*link)->next;
+                DS_TRAVERSAL_STEP(steps);
+            }
+            if (*link == nullptr) link = nullptr;
         }
 
         //If value is not found
-        if (current == nullptr) {
-            cout <<"Value not found in the list." << endl;
-            return;
+        if (link == nullptr) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout <<"Value not found in the list." << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::NotFound, "LinkedListImplementation::deleteNode: value not found");
         }
 
-        //If deleting the head node
-        if (prev == nullptr) {
-            head = current->next;
-        } else {
-            //Update the previous nodes next pointer to skip the current node
-            prev->next = current->next;
-        }
+        //Update head, or the previous nodes next pointer, to skip the current node
+        Node<T>* current = *link;
+        if (indexed) valueIndex.erase(value);
+        *link = current->next;
+        relinkIndexed(current->next, link);
+        if (tailLink == &current->next) tailLink = link;
 
         //Free the memory of the node to be deleted
         delete current;
+        DS_COUNT_FREE("LinkedListImplementation");
+        nodeCount--;
+        return ErrorPolicy::ok();
     }
 
     // Display list (helper)
     void display() {
-        Node* current = head;
+        Node<T>* current = head;
         while (current != nullptr) {
             cout << current->data << " -> ";
             current = current->next;
@@ -117,8 +240,56 @@ public:
         cout << "NULL\n";
     }
 
+    // Range access (range-for, <algorithm>, std::execution)
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    std::size_t size() const { return nodeCount; }
+
+    // Footprint breakdown (payload / node overhead / malloc slack / fragmentation), O(n)
+    // The value index, when enabled, counts as overhead (one more heap block).
+    memusage::MemoryUsage memoryUsage() const {
+        memusage::MemoryUsage usage = memusage::nodeChainUsage<Node<T>, T>(head, nodeCount, sizeof(*this));
+        if (valueIndex.bytes() != 0) {
+            usage.overheadBytes += valueIndex.bytes();
+            usage.heapBlocks++;
+        }
+        return usage;
+    }
+
+    // Write the list to a snapshot file (layout in ListSnapshot.h)
+    void saveSnapshot(const string& path) const {
+        snapshot::SnapshotWriter<T> writer(path, snapshot::Kind::LinkedListImplementation);
+        for (Node<T>* current = head; current != nullptr; current = current->next) {
+            writer.append(current->data);
+        }
+        writer.finish();
+    }
+
+    // Rebuild a mutable list from a mapped snapshot in O(n) (tail append)
+    void loadSnapshot(const snapshot::SnapshotView<T>& view) {
+        clear();
+        for (const T& value : view) {
+            Node<T>* newNode = new Node<T>(value);
+            DS_COUNT_ALLOC("LinkedListImplementation");
+            *tailLink = newNode;
+            tailLink = &newNode->next;
+        }
+        nodeCount = view.size();
+        if (indexed && !rebuildValueIndex()) disableValueIndex();
+    }
+
 };
 
+#if __cplusplus >= 202002L
+static_assert(std::ranges::forward_range<LinkedListImplementation<>>);
+static_assert(std::ranges::sized_range<LinkedListImplementation<>>);
+#endif
+
+// Demo (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+#ifndef DS_NO_DEMO_MAIN
 int main() {
     LinkedListImplementation list;
 
@@ -137,5 +308,13 @@ int main() {
 
     list.display();
 
+    // Unique values: index them, then search/delete without walking
+    list.enableValueIndex();
+    list.searchAndInsert(30, 40);
+    list.deleteNode(10);
+    cout << "Indexed: inserted 40 after 30, deleted 10:\n";
+    list.display();
+
     return 0;
 }
+#endif // DS_NO_DEMO_MAIN
@@ -1,40 +1,88 @@
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
+#include <string>
+#if __cplusplus >= 202002L
+#include <ranges>
+#include <span>
+#endif
+
+#include <thread>
+#include <vector>
+#include "ChainPrefetch.h"
+#include "FastIO.h"
+#include "Instrumentation.h"
+#include "ListSetOps.h"
+#include "MemoryUsage.h"
+#include "ListSnapshot.h"
+#include "ListSort.h"
+#include "NodeArena.h"
+#include "NodeIterators.h"
+#include "Serialization.h"
 
 using namespace std;
 
 // ────────────────────────────────────────────────
 // Node structure (good style: use member initializer list)
+template <typename T>
 struct Node {
-    int   data;
+    T     data;
     Node* next;
 
-    explicit Node(int val) : data(val), next(nullptr) {}
+    explicit Node(const T& val) : data(val), next(nullptr) {}
+
+    // compact() may move nodes into an arena: delete finds out which,
+    // and new refills the arena's holes (NodeArena.h)
+    static void* operator new(std::size_t bytes) { return nodearena::Registry<Node>::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) {
+        nodearena::Registry<Node>::deallocate(p, bytes);
+    }
 };
 
 // ────────────────────────────────────────────────
+template <typename T = int>
 class LinkedList {
 private:                    // ← better encapsulation
-    Node* head;
+    Node<T>* head;
+    std::size_t nodeCount;   // kept up to date by every insert/remove, so size() is O(1)
+    nodearena::Compactor<Node<T>> compactor;   // compactStep() progress
 
-public:
-    LinkedList() : head(nullptr) {}
-
-    // VERY IMPORTANT: destructor to prevent memory leak
-    ~LinkedList() {
-        Node* current = head;
+    // free every node (used by the destructor and loadSnapshot)
+    void clear() {
+        compactor.abandon();
+        Node<T>* current = head;
         while (current != nullptr) {
-            Node* next = current->next;
+            Node<T>* next = current->next;
             delete current;
+            DS_COUNT_FREE("LinkedList");
             current = next;
         }
+        head = nullptr;
+        nodeCount = 0;
+    }
+
+public:
+    // Iterators: forward only (each node knows just its successor)
+    using iterator = NodeIterator<Node<T>, T>;
+    using const_iterator = NodeIterator<const Node<T>, const T>;
+
+    LinkedList() : head(nullptr), nodeCount(0) {}
+
+    // VERY IMPORTANT: destructor to prevent memory leak
+    ~LinkedList() {
+        clear();
     }
 
     // Optional: disable copying (simplest safe choice)
     LinkedList(const LinkedList&) = delete;
     LinkedList& operator=(const LinkedList&) = delete;
 
-    void insertAtEnd(int val) {
-        Node* newNode = new Node(val);
+    void insertAtEnd(const T& val) {
+        DS_COUNT_OP("LinkedList", "insertAtEnd");
+        DS_TRAVERSAL_SCOPE("LinkedList", "insertAtEnd", steps);
+        Node<T>* newNode = new Node<T>(val);
+        DS_COUNT_ALLOC("LinkedList");
+        nodeCount++;
 
         if (head == nullptr) {
             head = newNode;
@@ -42,23 +90,66 @@ public:
         }
 
         else{
-        Node* temp = head;
+        Node<T>* temp = head;
         while (temp->next != nullptr) {
             temp = temp->next;
+            DS_TRAVERSAL_STEP(steps);
         }
         temp->next = newNode;
         }
     }
 
-    void insertAtBeggining(int val) {//function to insert a new node at the beginning of the linked list
-        Node* newNode = new Node(val);//create a new node with the given value
+    void insertAtBeggining(const T& val) {//function to insert a new node at the beginning of the linked list
+        DS_COUNT_OP("LinkedList", "insertAtBeggining");
+        Node<T>* newNode = new Node<T>(val);//create a new node with the given value
+        DS_COUNT_ALLOC("LinkedList");
         newNode->next = head;//point the new node's next to the current head
         head = newNode;//set the head to the new node
+        nodeCount++;
+    }
+
+    // Append n values in order: ONE walk to the tail, then each node is
+    // linked through a running tail pointer (n insertAtEnd() calls would
+    // walk the whole list n times). Returns the last node: pass it back as
+    // `tail` on the next call and even that walk is skipped, as long as the
+    // node is still in the list. Used by fastio::appendAll (FastIO.h).
+    Node<T>* insertAtEndBulk(const T* values, std::size_t n, Node<T>* tail = nullptr) {
+        DS_COUNT_OP("LinkedList", "insertAtEndBulk");
+        Node<T>* last = (tail != nullptr) ? tail : head;
+        if (last != nullptr) {
+            while (last->next != nullptr) last = last->next;
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            Node<T>* newNode = new Node<T>(values[i]);
+            DS_COUNT_ALLOC("LinkedList");
+            if (last == nullptr) head = newNode;
+            else last->next = newNode;
+            last = newNode;
+        }
+        nodeCount += n;
+        return last;
+    }
+
+    // Range access: works with range-for, <algorithm> and std::execution
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    std::size_t size() const { return nodeCount; }
+    bool isEmpty() const { return head == nullptr; }
+
+    // Bytes used: payload, next pointers + padding, malloc slack (see MemoryUsage.h).
+    // O(n): measuring fragmentation walks every node once.
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::nodeChainUsage<Node<T>, T>(head, nodeCount, sizeof(*this));
     }
 
     // Nice helper for printing (using modern C++ style)
     void print() const {
-        const Node* temp = head;
+        const Node<T>* temp = head;
         while (temp != nullptr) {
             cout << temp->data;
             if (temp->next != nullptr) cout << "  ";
@@ -67,9 +158,22 @@ public:
         cout << '\n';
     }
 
-    bool searchNode(int searchVal) const {//function to search for a node with a specific value in the linked list
-        Node* temp = head;//start from the head of the list
+    // Bulk counterpart of print(): every value through a buffered writer
+    // (fastio::Writer in FastIO.h), head to tail, one per line
+    template <typename Out>
+    void writeTo(Out& out) const {
+        for (const Node<T>* temp = head; temp != nullptr; temp = temp->next) {
+            out.write(temp->data);
+        }
+    }
+
+    bool searchNode(const T& searchVal) const {//function to search for a node with a specific value in the linked list
+        DS_COUNT_OP("LinkedList", "searchNode");
+        DS_TRAVERSAL_SCOPE("LinkedList", "searchNode", steps);
+        DS_PERF_REGION("LinkedList::searchNode");
+        Node<T>* temp = head;//start from the head of the list
         while (temp != nullptr) {//traverse the list until the end
+            DS_TRAVERSAL_STEP(steps);
             if (temp->data == searchVal) {//if the current node's data matches the search value
                 return true;//return true indicating the node is found
             }
@@ -77,10 +181,231 @@ public:
         }
         return false;//if the search value is not found, return false
     }
+
+    // ────────────────────────────────────────────
+    // searchMany(): n searchNode() questions answered in ONE walk
+    //
+    // n separate searches load every node up to n times, and each load is a
+    // cache miss on a big list. Here each node is loaded once and checked
+    // against all keys, with the next node prefetched meanwhile
+    // (see ChainPrefetch.h). found[i] = is keys[i] in the list?
+    // ────────────────────────────────────────────
+    void searchMany(const T* keys, std::size_t n, bool* found) const {
+        DS_COUNT_OP("LinkedList", "searchMany");
+        DS_PERF_REGION("LinkedList::searchMany");
+        std::vector<const Node<T>*> nodes(n);
+        chainwalk::findAllInChain<const Node<T>>(head, nullptr, keys, n, nodes.data());
+        for (std::size_t i = 0; i < n; i++) found[i] = nodes[i] != nullptr;
+    }
+
+#if __cplusplus >= 202002L
+    void searchMany(std::span<const T> keys, std::span<bool> found) const {
+        searchMany(keys.data(), std::min(keys.size(), found.size()), found.data());
+    }
+#endif
+
+    // ────────────────────────────────────────────
+    // Sorting (see ListSort.h)
+    //
+    // All three are stable merge sorts that only re-link `next` pointers:
+    // no node is allocated or copied, so a huge list sorts without needing
+    // a second copy of itself.
+    //   sort()          top-down, recursion depth O(log n)
+    //   sortBottomUp()  iterative, no recursion at all
+    //   sortParallel()  sorts `tasks` pieces on separate threads, then merges
+    // ────────────────────────────────────────────
+    void sort() {
+        DS_COUNT_OP("LinkedList", "sort");
+        DS_PERF_REGION("LinkedList::sort");
+        head = listsort::mergeSortTopDown(head);
+    }
+
+    void sortBottomUp() {
+        DS_COUNT_OP("LinkedList", "sortBottomUp");
+        DS_PERF_REGION("LinkedList::sortBottomUp");
+        head = listsort::mergeSortBottomUp(head);
+    }
+
+    void sortParallel(unsigned tasks = std::thread::hardware_concurrency()) {
+        DS_COUNT_OP("LinkedList", "sortParallel");
+        DS_PERF_REGION("LinkedList::sortParallel");
+        head = listsort::mergeSortParallel(head, nodeCount, tasks);
+    }
+
+    // LSD radix sort: 4 byte-passes through 256 buckets, nodes re-linked (stable)
+    void radixSort() {
+        DS_COUNT_OP("LinkedList", "radixSort");
+        DS_PERF_REGION("LinkedList::radixSort");
+        head = listsort::radixSort(head);
+    }
+
+    // ────────────────────────────────────────────
+    // Compaction (see NodeArena.h)
+    //
+    // After lots of inserts and deletes the nodes are scattered over the
+    // heap and every step of a walk is a cache miss. compact() moves all
+    // nodes into one block in list order and reports one walk's time per
+    // node before and after. compactStep(maxNodes) does the same work in
+    // slices of at most maxNodes nodes, returning true when the pass is done;
+    // the list may be used between slices.
+    // Both invalidate iterators and node pointers.
+    // setArenaBacking(): 2 MB pages and/or a NUMA policy for the arena,
+    // for lists big enough to miss the TLB (huge pages, NUMA: Linux only).
+    // ────────────────────────────────────────────
+    nodearena::CompactReport compact() {
+        DS_COUNT_OP("LinkedList", "compact");
+        DS_PERF_REGION("LinkedList::compact");
+        nodearena::CompactReport report;
+        report.nodes = nodeCount;
+        report.nsPerNodeBefore = nodearena::traversalNsPerNode(head, nodeCount);
+        compactor.abandon();   // a sliced pass in progress starts over
+        while (!compactor.step(head, nodeCount, SIZE_MAX)) {}
+        report.movedNodes = compactor.movedNodes();
+        report.nsPerNodeAfter = nodearena::traversalNsPerNode(head, nodeCount);
+        report.pages = compactor.obtainedPages();
+        report.numaApplied = compactor.numaApplied();
+        return report;
+    }
+
+    bool compactStep(std::size_t maxNodes) {
+        DS_COUNT_OP("LinkedList", "compactStep");
+        DS_PERF_REGION("LinkedList::compactStep");
+        return compactor.step(head, nodeCount, maxNodes);
+    }
+
+    // Huge pages / NUMA policy for the arenas of later passes
+    void setArenaBacking(const nodearena::Backing& backing) { compactor.setBacking(backing); }
+
+    // ────────────────────────────────────────────
+    // Set operations on SORTED lists (see ListSetOps.h)
+    //
+    // Both lists must be sorted ascending (e.g. after sort()).
+    // One simultaneous walk replaces the O(n * m) searchNode() loop.
+    //   unionWith(other)      moves other's nodes in; other ends up empty
+    //   intersectWith(other)  keeps only values also in other
+    //   differenceWith(other) removes values that are in other
+    // The (first, last) overloads take a sorted random-access range
+    // (vector, SnapshotView, ...) and gallop through it, which is much
+    // cheaper when that range is far larger than this list.
+    // ────────────────────────────────────────────
+    void unionWith(LinkedList& other) {
+        if (this == &other) return;
+        other.compactor.abandon();      // its pass would go on walking our chain
+        std::size_t freed = 0;
+        head = listset::unionRuns(head, other.head, freed);
+        nodeCount = nodeCount + other.nodeCount - freed;
+        DS_COUNT_FREES("LinkedList", freed);
+        other.head = nullptr;           // its nodes now belong to this list
+        other.nodeCount = 0;
+    }
+
+    void intersectWith(const LinkedList& other) {
+        if (this == &other) return;
+        std::size_t freed = 0;
+        head = listset::intersectRuns(head, other.head, freed);
+        nodeCount -= freed;
+        DS_COUNT_FREES("LinkedList", freed);
+    }
+
+    void differenceWith(const LinkedList& other) {
+        if (this == &other) {
+            clear();
+            return;
+        }
+        std::size_t freed = 0;
+        head = listset::differenceRuns(head, other.head, freed);
+        nodeCount -= freed;
+        DS_COUNT_FREES("LinkedList", freed);
+    }
+
+    template <typename RandomIt>
+    void intersectWith(RandomIt first, RandomIt last) {
+        std::size_t freed = 0;
+        head = listset::intersectWithRange(head, first, last, freed);
+        nodeCount -= freed;
+        DS_COUNT_FREES("LinkedList", freed);
+    }
+
+    template <typename RandomIt>
+    void differenceWith(RandomIt first, RandomIt last) {
+        std::size_t freed = 0;
+        head = listset::differenceWithRange(head, first, last, freed);
+        nodeCount -= freed;
+        DS_COUNT_FREES("LinkedList", freed);
+    }
+
+    // k-way merge: splice every node of `lists` into this sorted list
+    // (min-heap over the k list fronts, O(N log k), all inputs end up empty)
+    void mergeFrom(const std::vector<LinkedList*>& lists) {
+        std::vector<Node<T>*> heads;
+        heads.push_back(head);
+        for (LinkedList* list : lists) {
+            if (list == this) continue;
+            list->compactor.abandon();   // its pass would go on walking our chain
+            heads.push_back(list->head);
+            nodeCount += list->nodeCount;
+            list->head = nullptr;
+            list->nodeCount = 0;
+        }
+        head = listset::mergeK(heads);
+    }
+
+    // ────────────────────────────────────────────
+    // Snapshots (see ListSnapshot.h for the file layout)
+    //
+    // saveSnapshot(): one pass over the chain, elements written in order.
+    // loadSnapshot(): copy a read-only view into a mutable list (eager: every
+    //   element becomes a node now; the view can be closed afterwards).
+    //   Nodes are appended through a running tail pointer, so the rebuild is
+    //   O(n) instead of the O(n^2) of calling insertAtEnd() in a loop.
+    // ────────────────────────────────────────────
+    void saveSnapshot(const string& path) const {
+        snapshot::SnapshotWriter<T> writer(path, snapshot::Kind::LinkedList);
+        for (const Node<T>* temp = head; temp != nullptr; temp = temp->next) {
+            writer.append(temp->data);
+        }
+        writer.finish();
+    }
+
+    void loadSnapshot(const snapshot::SnapshotView<T>& view) {
+        clear();
+        Node<T>** link = &head;             // where the next node gets attached
+        for (const T& value : view) {
+            *link = new Node<T>(value);
+            DS_COUNT_ALLOC("LinkedList");
+            link = &(*link)->next;
+        }
+        nodeCount = view.size();
+    }
+
+    // ────────────────────────────────────────────
+    // Binary serialization (format in Serialization.h)
+    //   serialize():   head -> tail; Raw is written straight from the nodes
+    //                  with writev, sorted int lists shrink with DeltaVarint
+    //   deserialize(): every node built inside ONE allocation, in order
+    // ────────────────────────────────────────────
+    void serialize(const string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        serial::save<T>(path, serial::Kind::LinkedList, begin(), end(), nodeCount, encoding);
+    }
+
+    void deserialize(const string& path) {
+        serial::Reader<T> in(path);
+        clear();
+        head = nodearena::buildChain<Node<T>>(in.size(), [&in] { return in.next(); });
+        nodeCount = in.size();
+        DS_COUNT_ALLOCS("LinkedList", nodeCount);
+    }
 };
 
+#if __cplusplus >= 202002L
+static_assert(std::ranges::forward_range<LinkedList<>>);
+static_assert(std::ranges::sized_range<LinkedList<>>);
+#endif
+
 // ────────────────────────────────────────────────
 // main() MUST be outside the class
+// (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+#ifndef DS_NO_DEMO_MAIN
 int main() {
     LinkedList list;
 
@@ -93,6 +418,99 @@ int main() {
     cout << "Linked List: ";
     list.print();
 
+    // Iterators: the list now works with <algorithm> directly
+    // (and with std::for_each(std::execution::par_unseq, list.begin(), list.end(), ...))
+    cout << "Size: " << list.size()
+         << ", max: " << *std::max_element(list.begin(), list.end())
+         << ", values > 25: " << std::count_if(list.begin(), list.end(), [](int v) { return v > 25; })
+         << '\n';
+
+    // Several searches, one walk
+    int wanted[3] = {40, 7, 10};
+    bool present[3];
+    list.searchMany(wanted, 3, present);
+    cout << "searchMany {40, 7, 10}: " << present[0] << present[1] << present[2] << '\n';
+
+    // Move the nodes next to each other, in list order
+    nodearena::CompactReport compacted = list.compact();
+    cout << "compact(): " << compacted.movedNodes << " nodes moved, fragmentation now "
+         << list.memoryUsage().fragmentation << '\n';
+    list.print();
+
+    // Snapshot round trip: write once, reopen as a zero-copy mmap view
+    list.saveSnapshot("linkedlist.snap");
+    snapshot::SnapshotView<int> view("linkedlist.snap");
+    cout << "Snapshot has " << view.size() << " elements, contains 30? "
+         << (view.searchNode(30) ? "yes" : "no") << '\n';
+
+    LinkedList restored;
+    restored.loadSnapshot(view);     // O(n) copy into a mutable list
+    restored.insertAtBeggining(5);
+    cout << "Restored + 5: ";
+    restored.print();
+
+    // Sort in place (stable, nodes re-linked, nothing copied)
+    restored.insertAtBeggining(35);
+    restored.insertAtEnd(1);
+    restored.sortBottomUp();
+    cout << "Sorted: ";
+    restored.print();
+
+    restored.insertAtBeggining(-7);  // radix sort handles negative keys too
+    restored.radixSort();
+    cout << "Radix sorted: ";
+    restored.print();
+
+    // Set operations on sorted lists (linear merge walks)
+    LinkedList evens, odds;
+    for (int v = 0; v <= 40; v += 10) evens.insertAtEnd(v);   // 0 10 20 30 40
+    for (int v = 5; v <= 45; v += 10) odds.insertAtEnd(v);    // 5 15 25 35 45
+    restored.intersectWith(evens);
+    cout << "Intersect with 0..40 step 10: ";
+    restored.print();
+    odds.compactStep(2);             // a sliced pass over odds is still open...
+    restored.unionWith(odds);        // ...and ends here, as odds gives its nodes away
+    cout << "Union with 5..45 step 10: ";
+    restored.print();
+    cout << "Pass over the emptied odds finished? " << (odds.compactStep(1) ? "yes" : "no") << '\n';
+    restored.compact();
+    cout << "Compacted after union: " << restored.memoryUsage().fragmentation << " fragmentation\n";
+
+    LinkedList small;
+    for (int v = 1; v <= 9; v += 2) small.insertAtEnd(v);
+    small.compactStep(1);            // same for a k-way merge
+    restored.mergeFrom({&small});
+    cout << "Pass over the emptied small finished? " << (small.compactStep(1) ? "yes" : "no") << '\n';
+    restored.compact();
+    cout << "Merged with 1..9 step 2, compacted: ";
+    restored.print();
+
+    // Text round trip without iostream: a buffered writer out, mmap + from_chars
+    // back in, appended through insertAtEndBulk() (FastIO.h)
+    {
+        fastio::Writer out("linkedlist.txt");
+        restored.writeTo(out);
+    }
+    LinkedList reloaded;
+    fastio::NumberReader<int> in("linkedlist.txt");
+    std::size_t loaded = fastio::appendAll(in, reloaded);
+    cout << "Reloaded " << loaded << " values from text: ";
+    reloaded.print();
+
+    // Binary round trip: the list is sorted, so Auto stores it delta-encoded
+    // (about a byte per value); loading builds all nodes in one allocation
+    reloaded.serialize("linkedlist.bin");
+    LinkedList decoded;
+    decoded.deserialize("linkedlist.bin");
+    cout << "Deserialized " << decoded.size() << " values: ";
+    decoded.print();
+
+#if defined(DS_INSTRUMENT)
+    // op counts, allocations and search lengths recorded above
+    cout << "Stats: " << instr::toJson(instr::takeSnapshot()) << '\n';
+#endif
+
     // List is automatically cleaned up when main() ends
     return 0;
-}
\ No newline at end of file
+}
+#endif // DS_NO_DEMO_MAIN
\ No newline at end of file
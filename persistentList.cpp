@@ -0,0 +1,364 @@
+#include <cstddef>      // std::size_t
+#include <iostream>     // std::cout (demo and print())
+#include <utility>      // std::move, std::swap
+#if __cplusplus >= 202002L
+#include <ranges>       // std::ranges::forward_range (concept check below)
+#endif
+
+#include "ErrorPolicy.h"     // errpolicy::Print / Silent / Throw / ReturnExpected / Callback
+#include "Instrumentation.h" // DS_COUNT_* hooks (active only with -DDS_INSTRUMENT)
+#include "MemoryUsage.h"     // memusage::MemoryUsage footprint breakdown
+#include "NodeIterators.h"   // NodeIterator: shared forward iterator over node chains
+
+using namespace std;
+
+// ============================================================================
+// PERSISTENT (immutable) stack and list
+// ----------------------------------------------------------------------------
+// "Persistent" = an update never changes an existing version; it returns a
+// NEW version, and every old version stays valid and unchanged.
+//
+// Why? Undo / versioning. With StackListImp or LinkedList a snapshot means a
+// deep copy (O(n) time and memory per snapshot, and both classes even delete
+// their copy constructors). Here a snapshot is just a copy of the handle: O(1).
+//
+// STRUCTURAL SHARING: nodes are never modified after they are built, so a new
+// version can point INTO an old one instead of copying it:
+//
+//    v1            = {3, 2, 1}     v1 --> [3] --> [2] --> [1]
+//    v2 = v1.push(4)               v2 --> [4] ---^
+//    v3 = v1.push(9)               v3 --> [9] ---^
+//
+// Three versions, 3 + 1 + 1 = 5 nodes instead of 3 + 4 + 4 = 11.
+// Memory grows with the DIFFERENCES between versions, not with their count.
+//
+// Who frees a shared node? REFERENCE COUNTING: every node counts its owners
+// (versions whose head it is + nodes whose `next` it is). Dropping a version
+// decrements its head; a node that reaches 0 is freed and decrements its own
+// successor, and so on down the chain (iteratively, so a long chain cannot
+// overflow the call stack).
+//
+// COST MODEL (singly linked, so only the FRONT can be shared cheaply):
+//   push / insertAtBeggining / pop / tail   O(1), one node
+//   insertAtPosition(p) / deleteByValue      copy the nodes before p, share the rest
+//   insertAtEnd                              copies the whole list (O(n))
+//
+// THREADS: the counts are plain integers. Versions can be read from several
+// threads, but creating/dropping versions that share nodes must happen on
+// one thread (or under a lock).
+// ============================================================================
+
+template <typename T>
+struct PersistentNode {
+    T data;                 // never changes after construction
+    PersistentNode* next;   // shared tail (may belong to many versions)
+    std::size_t refs;       // owners: versions + predecessor nodes
+
+    PersistentNode(const T& val, PersistentNode* nxt) : data(val), next(nxt), refs(1) {}
+};
+
+// ============================================================================
+// PersistentList: immutable singly linked list (LinkedList's operations,
+// but every "modifier" is const and returns the new version)
+//
+// insertAtPosition() reports a position that does not exist through the
+// ErrorPolicy (ErrorPolicy.h); Print and Silent then return this same
+// version unchanged.
+// ============================================================================
+template <typename T = int, typename ErrorPolicy = errpolicy::Print>
+class PersistentList {
+private:
+    using Node = PersistentNode<T>;
+
+    Node* head;             // this version owns ONE reference to head
+    std::size_t nodeCount;
+
+    // Adopt a chain whose head reference already belongs to us
+    PersistentList(Node* first, std::size_t count) : head(first), nodeCount(count) {}
+
+    // The new version with val in front of the node at 0-based `index`
+    // (index <= nodeCount)
+    PersistentList insertBefore(std::size_t index, const T& val) const {
+        const Node* at = head;
+        for (std::size_t i = 0; i < index; i++) at = at->next;
+        Node* inserted = makeNode(val, retain(const_cast<Node*>(at)));
+        return PersistentList(copyPrefix(head, index, inserted), nodeCount + 1);
+    }
+
+    static Node* retain(Node* node) {
+        if (node != nullptr) node->refs++;
+        return node;
+    }
+
+    // Drop one reference; free every node that is no longer owned by anyone
+    static void release(Node* node) {
+        while (node != nullptr && --node->refs == 0) {
+            Node* next = node->next;
+            delete node;
+            DS_COUNT_FREE("PersistentList");
+            node = next;
+        }
+    }
+
+    static Node* makeNode(const T& val, Node* next) {
+        Node* node = new Node(val, next);
+        DS_COUNT_ALLOC("PersistentList");
+        return node;
+    }
+
+    // PATH COPYING: new copies of the first `count` nodes, then `rest` (whose
+    // reference the caller already took). Returns the head of the new chain.
+    static Node* copyPrefix(const Node* from, std::size_t count, Node* rest) {
+        Node* first = nullptr;
+        Node** link = &first;           // where the next copy gets attached
+        for (std::size_t i = 0; i < count; i++, from = from->next) {
+            *link = makeNode(from->data, nullptr);
+            link = &(*link)->next;
+        }
+        *link = rest;
+        return first;
+    }
+
+public:
+    // Read-only iteration (versions are immutable): range-for, <algorithm>
+    using const_iterator = NodeIterator<const Node, const T>;
+    using iterator = const_iterator;
+
+    PersistentList() : head(nullptr), nodeCount(0) {}
+
+    // Build the first version from any range, in order (O(n))
+    template <typename InputIt>
+    PersistentList(InputIt first, InputIt last) : head(nullptr), nodeCount(0) {
+        Node** link = &head;
+        for (; first != last; ++first) {
+            *link = makeNode(*first, nullptr);
+            link = &(*link)->next;
+            nodeCount++;
+        }
+    }
+
+    // SNAPSHOT = copy: O(1), shares every node
+    PersistentList(const PersistentList& other) : head(retain(other.head)), nodeCount(other.nodeCount) {}
+
+    PersistentList& operator=(const PersistentList& other) {
+        Node* old = head;
+        head = retain(other.head);      // retain first: safe for self-assignment
+        nodeCount = other.nodeCount;
+        release(old);
+        return *this;
+    }
+
+    PersistentList(PersistentList&& other) noexcept : head(other.head), nodeCount(other.nodeCount) {
+        other.head = nullptr;
+        other.nodeCount = 0;
+    }
+
+    PersistentList& operator=(PersistentList&& other) noexcept {
+        std::swap(head, other.head);
+        std::swap(nodeCount, other.nodeCount);
+        return *this;   // our old chain is released by other's destructor
+    }
+
+    ~PersistentList() { release(head); }
+
+    // ------------------------------------------------------------------------
+    // "Modifiers": each returns a NEW version, *this is unchanged
+    // ------------------------------------------------------------------------
+
+    // O(1): one new node in front of the shared list
+    PersistentList insertAtBeggining(const T& val) const {
+        DS_COUNT_OP("PersistentList", "insertAtBeggining");
+        return PersistentList(makeNode(val, retain(head)), nodeCount + 1);
+    }
+
+    // O(1): the version without the first element (empty stays empty)
+    PersistentList tail() const {
+        if (head == nullptr) return PersistentList();
+        return PersistentList(retain(head->next), nodeCount - 1);
+    }
+
+    // O(pos): val becomes element pos (1-based, like DoublyLinkedList);
+    // copies the pos - 1 nodes before it, shares the rest.
+    //   {10, 20, 30}.insertAtPosition(2, 25) => {10, 25, 20, 30}
+    // Valid positions: 1 .. size() + 1 (size() + 1 appends).
+    typename ErrorPolicy::template result<PersistentList> insertAtPosition(std::size_t pos, const T& val) const {
+        DS_COUNT_OP("PersistentList", "insertAtPosition");
+        if (pos < 1 || pos > nodeCount + 1) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Invalid position." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::NotFound,
+                                          "PersistentList::insertAtPosition: position out of range", *this);
+        }
+        return ErrorPolicy::value(insertBefore(pos - 1, val));
+    }
+
+    // O(n): nothing can be shared, the last node's `next` would have to change
+    PersistentList insertAtEnd(const T& val) const {
+        return insertBefore(nodeCount, val);
+    }
+
+    // Remove the FIRST node equal to val: copies the nodes before it and
+    // shares the nodes after it. Not found => returns this same version.
+    PersistentList deleteByValue(const T& val) const {
+        DS_COUNT_OP("PersistentList", "deleteByValue");
+        DS_TRAVERSAL_SCOPE("PersistentList", "deleteByValue", steps);
+        std::size_t position = 0;
+        const Node* at = head;
+        while (at != nullptr && !(at->data == val)) {
+            at = at->next;
+            position++;
+            DS_TRAVERSAL_STEP(steps);
+        }
+        if (at == nullptr) return *this;
+        return PersistentList(copyPrefix(head, position, retain(at->next)), nodeCount - 1);
+    }
+
+    // ------------------------------------------------------------------------
+    // Queries
+    // ------------------------------------------------------------------------
+    bool searchNode(const T& val) const {
+        DS_TRAVERSAL_SCOPE("PersistentList", "searchNode", steps);
+        for (const Node* temp = head; temp != nullptr; temp = temp->next) {
+            if (temp->data == val) return true;
+            DS_TRAVERSAL_STEP(steps);
+        }
+        return false;
+    }
+
+    // Do two versions share their whole list? (O(1) "nothing changed" test)
+    bool sameVersionAs(const PersistentList& other) const { return head == other.head; }
+
+    std::size_t size() const { return nodeCount; }
+    bool isEmpty() const { return head == nullptr; }
+
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+
+    // Bytes reachable from this version. Shared nodes are counted in EVERY
+    // version that reaches them; measure the heap to see the real total.
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::nodeChainUsage<Node, T>(head, nodeCount, sizeof(*this));
+    }
+
+    void print() const {
+        for (const Node* temp = head; temp != nullptr; temp = temp->next) {
+            cout << temp->data;
+            if (temp->next != nullptr) cout << "  ";
+        }
+        cout << endl;
+    }
+};
+
+// ============================================================================
+// PersistentStack: StackListImp's interface on a PersistentList
+// ----------------------------------------------------------------------------
+// push() / pop() return the new version; peek() reports an empty stack
+// through the ErrorPolicy exactly like StackListImp. pop() on an empty stack
+// reports Underflow and (for Print / Silent) returns an empty stack.
+// ============================================================================
+template <typename T = int, typename ErrorPolicy = errpolicy::Print>
+class PersistentStack {
+private:
+    PersistentList<T> items;   // top of the stack = front of the list
+
+    explicit PersistentStack(PersistentList<T> list) : items(std::move(list)) {}
+
+public:
+    using const_iterator = typename PersistentList<T>::const_iterator;
+    using iterator = const_iterator;
+
+    PersistentStack() = default;
+
+    PersistentStack push(const T& val) const {
+        DS_COUNT_OP("PersistentStack", "push");
+        return PersistentStack(items.insertAtBeggining(val));
+    }
+
+    typename ErrorPolicy::template result<PersistentStack> pop() const {
+        DS_COUNT_OP("PersistentStack", "pop");
+        if (items.isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "PersistentStack::pop: stack is empty",
+                                          PersistentStack());
+        }
+        return ErrorPolicy::value(PersistentStack(items.tail()));
+    }
+
+    typename ErrorPolicy::template result<T> peek() const {
+        if (items.isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Stack is empty." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "PersistentStack::peek: stack is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        return ErrorPolicy::value(*items.begin());
+    }
+
+    bool isEmpty() const { return items.isEmpty(); }
+    std::size_t size() const { return items.size(); }
+    bool sameVersionAs(const PersistentStack& other) const { return items.sameVersionAs(other.items); }
+
+    const_iterator begin() const { return items.begin(); }
+    const_iterator end() const { return items.end(); }
+
+    memusage::MemoryUsage memoryUsage() const { return items.memoryUsage(); }
+};
+
+#if __cplusplus >= 202002L
+static_assert(std::ranges::forward_range<PersistentList<>>);
+static_assert(std::ranges::sized_range<PersistentList<>>);
+static_assert(std::ranges::forward_range<PersistentStack<>>);
+#endif
+
+// ============================================================================
+// Demo (define DS_NO_DEMO_MAIN to #include this file from a benchmark)
+// ============================================================================
+#ifndef DS_NO_DEMO_MAIN
+int main() {
+    // --- stack: undo history -------------------------------------------------
+    PersistentStack<> empty;
+    PersistentStack<> v1 = empty.push(1).push(2).push(3);
+    PersistentStack<> v2 = v1.push(4);        // shares 3, 2, 1 with v1
+    PersistentStack<> v3 = v1.pop();          // shares 2, 1 with v1
+
+    cout << "v1 (top first): ";
+    for (int v : v1) cout << v << " ";
+    cout << "\nv2 = v1.push(4): ";
+    for (int v : v2) cout << v << " ";
+    cout << "\nv3 = v1.pop():   ";
+    for (int v : v3) cout << v << " ";
+    cout << "\nv1 unchanged, peek = " << v1.peek() << ", size = " << v1.size() << endl;
+
+    PersistentStack<> snapshot = v2;          // O(1): same nodes
+    cout << "snapshot is v2: " << (snapshot.sameVersionAs(v2) ? "yes" : "no") << endl;
+
+    cout << "Pop on empty stack: ";
+    empty.pop();                              // prints "Stack is empty."
+
+    // --- list: copy only the changed prefix ----------------------------------
+    int values[] = {10, 20, 30, 40, 50};
+    PersistentList<> base(values, values + 5);
+    PersistentList<> withFront = base.insertAtBeggining(5);
+    PersistentList<> inserted = base.insertAtPosition(2, 25);    // copies 10
+    PersistentList<> removed = base.deleteByValue(30);           // copies 10, 20
+    PersistentList<> appended = base.insertAtEnd(60);            // copies all 5
+
+    cout << "base:                 "; base.print();
+    cout << "insertAtBeggining(5): "; withFront.print();
+    cout << "insertAtPosition(2):  "; inserted.print();
+    cout << "deleteByValue(30):    "; removed.print();
+    cout << "insertAtEnd(60):      "; appended.print();
+    cout << "base still has 30: " << (base.searchNode(30) ? "yes" : "no")
+         << ", removed has 30: " << (removed.searchNode(30) ? "yes" : "no") << endl;
+    cout << "deleteByValue(99) returns the same version: "
+         << (base.deleteByValue(99).sameVersionAs(base) ? "yes" : "no") << endl;
+    cout << "insertAtPosition(7, 70): ";
+    PersistentList<> unchanged = base.insertAtPosition(7, 70);  // prints "Invalid position."
+    cout << "returns the same version: " << (unchanged.sameVersionAs(base) ? "yes" : "no") << endl;
+    return 0;
+}
+#endif
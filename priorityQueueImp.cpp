@@ -0,0 +1,591 @@
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "ErrorPolicy.h"
+#include "Instrumentation.h"
+#include "MemoryUsage.h"
+using namespace std;
+
+// ============================================================================
+// Priority Queues — STUDY GUIDE VERSION
+// ----------------------------------------------------------------------------
+// BIG IDEA: the element that comes out next is the one with the BEST key,
+// not the oldest one (FIFO, SimpleQueue) or the newest one (LIFO, stacks).
+// A job dispatcher uses this for "run the earliest deadline first".
+//
+// ORDERING: Compare works like std::sort's: comp(a, b) == true means
+// "a comes out before b". With the default std::less<T> the SMALLEST key
+// comes out first (a min-heap: earliest deadline, shortest distance).
+// NOTE: std::priority_queue uses the opposite convention (std::less gives
+// the LARGEST first); pass std::greater<T> there to get the same order.
+//
+// The same queue-style API as SimpleQueue:
+//   enqueue(key)  dequeue()  peek()  isEmpty()
+// plus the names std::priority_queue users expect: push / pop / top.
+//
+// DECREASE-KEY:
+// enqueue() returns a Handle. decreaseKey(handle, newKey) moves that element
+// to its new place without removing it (Dijkstra, rescheduling a job sooner).
+//
+// Two implementations with different strengths:
+//
+//   DaryHeap (4-ary implicit heap)        PairingHeap
+//   one array, no pointers                one heap node per element
+//   enqueue / decreaseKey  O(log n)       enqueue / decreaseKey  O(1)
+//   dequeue                O(log n)       dequeue  O(log n) amortized
+//   heapify(range)         O(n)
+//   best for: general use, cache-friendly best for: MANY decreaseKey calls
+// ============================================================================
+
+
+// ============================================================================
+// 1) DaryHeap: implicit d-ary heap (default d = 4)
+// ----------------------------------------------------------------------------
+// The tree lives in an array: the children of logical node j are
+// d*j + 1 ... d*j + d. No pointers are stored at all.
+//
+// Why 4 children instead of 2?
+// - The tree is half as tall (log4 n = log2 n / 2), so sift-down visits
+//   half as many levels. Each level compares 4 siblings instead of 2, but
+//   siblings are NEXT TO EACH OTHER in memory: 4 ints = 16 bytes, one cache
+//   line fetch. Fewer levels = fewer cache misses on big heaps.
+//
+// Cache-line alignment trick:
+// - With the root in slot 0 the sibling groups would sit at 1..4, 5..8, ...,
+//   and some of them would straddle a cache-line boundary. Instead the array
+//   starts with d - 1 unused slots (OFFSET), so every sibling group begins at
+//   an index that is a multiple of d. For 4-byte keys a group is 16 bytes,
+//   malloc returns 16-byte aligned blocks, so a group never splits across
+//   two cache lines.
+//
+// Handles:
+// - Every element gets an id; slot[id] is its current array index and is
+//   updated whenever the element moves. decreaseKey() looks it up in O(1).
+// - Ids of dequeued elements are reused, so each slot also counts a
+//   generation: a Handle kept after its element left the queue no longer
+//   matches, and contains() / decreaseKey() reject it instead of touching
+//   whichever element got the id next.
+// - keys and ids are kept in two parallel arrays so the comparisons in a
+//   sift only touch the (small, contiguous) keys.
+// ============================================================================
+
+template <typename T = int, std::size_t Arity = 4, typename Compare = std::less<T>,
+          typename ErrorPolicy = errpolicy::Print>
+class DaryHeap {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+public:
+    struct Handle {
+        std::size_t id;
+        std::size_t generation;
+    };
+
+private:
+    struct Slot {
+        std::size_t index;        // array index of the element, or NO_SLOT
+        std::size_t generation;   // bumped every time the id is released
+    };
+
+    static constexpr std::size_t OFFSET = Arity - 1;      // unused leading slots
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    std::vector<T> keys;              // heap order, starting at index OFFSET
+    std::vector<std::size_t> ids;     // ids[p] = id of the element at index p
+    std::vector<Slot> slot;           // slot[id] = where element `id` is now
+    std::vector<std::size_t> freeIds; // ids of dequeued elements, reused first
+    Compare comp;
+
+    static std::size_t parentOf(std::size_t p) { return (p - OFFSET - 1) / Arity + OFFSET; }
+    static std::size_t firstChildOf(std::size_t p) { return Arity * (p - OFFSET + 1); }
+
+    // Move the element at p up while it beats its parent ("hole" technique:
+    // parents slide down into the hole, the element is written once at the end)
+    void siftUp(std::size_t p) {
+        T key = std::move(keys[p]);
+        std::size_t id = ids[p];
+        while (p > OFFSET) {
+            std::size_t parent = parentOf(p);
+            if (!comp(key, keys[parent])) break;
+            keys[p] = std::move(keys[parent]);
+            ids[p] = ids[parent];
+            slot[ids[p]].index = p;
+            p = parent;
+        }
+        keys[p] = std::move(key);
+        ids[p] = id;
+        slot[id].index = p;
+    }
+
+    // Move the element at p down while one of its children beats it
+    void siftDown(std::size_t p) {
+        const std::size_t n = keys.size();
+        T key = std::move(keys[p]);
+        std::size_t id = ids[p];
+        for (;;) {
+            std::size_t first = firstChildOf(p);
+            if (first >= n) break;
+            std::size_t last = std::min(first + Arity, n);
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; c++) {
+                if (comp(keys[c], keys[best])) best = c;
+            }
+            if (!comp(keys[best], key)) break;
+            keys[p] = std::move(keys[best]);
+            ids[p] = ids[best];
+            slot[ids[p]].index = p;
+            p = best;
+        }
+        keys[p] = std::move(key);
+        ids[p] = id;
+        slot[id].index = p;
+    }
+
+    std::size_t newId() {
+        if (!freeIds.empty()) {
+            std::size_t id = freeIds.back();
+            freeIds.pop_back();
+            return id;
+        }
+        slot.push_back(Slot{NO_SLOT, 0});
+        return slot.size() - 1;
+    }
+
+    void releaseId(std::size_t id) {
+        slot[id].index = NO_SLOT;
+        slot[id].generation++;
+        freeIds.push_back(id);
+    }
+
+    // Shared body of both heapify() overloads; `emit` receives each handle
+    template <typename InputIt, typename Emit>
+    void heapifyImpl(InputIt first, InputIt last, Emit emit) {
+        DS_COUNT_OP("DaryHeap", "heapify");
+        clear();
+        freeIds.clear();
+        std::size_t id = 0;
+        for (; first != last; ++first, ++id) {
+            if (id == slot.size()) slot.push_back(Slot{NO_SLOT, 0});
+            slot[id].index = keys.size();
+            ids.push_back(id);
+            keys.push_back(*first);
+            emit(Handle{id, slot[id].generation});
+        }
+        for (std::size_t unused = slot.size(); unused-- > id;) freeIds.push_back(unused);
+        if (size() < 2) return;
+        for (std::size_t p = parentOf(keys.size() - 1) + 1; p-- > OFFSET;) siftDown(p);
+    }
+
+public:
+    explicit DaryHeap(Compare compare = Compare())
+        : keys(OFFSET), ids(OFFSET, NO_SLOT), comp(compare) {}
+
+    std::size_t size() const { return keys.size() - OFFSET; }
+    bool isEmpty() const { return keys.size() == OFFSET; }
+
+    void reserve(std::size_t n) {
+        keys.reserve(n + OFFSET);
+        ids.reserve(n + OFFSET);
+        slot.reserve(n);
+    }
+
+    // Remove everything; handles issued so far all become stale
+    void clear() {
+        for (std::size_t p = OFFSET; p < keys.size(); p++) releaseId(ids[p]);
+        keys.resize(OFFSET);
+        ids.resize(OFFSET);
+    }
+
+    // Handle still refers to an element in the heap?
+    bool contains(Handle h) const {
+        return h.id < slot.size() && slot[h.id].index != NO_SLOT && slot[h.id].generation == h.generation;
+    }
+
+    // ------------------------------------------------------------------------
+    // enqueue(key): append at the end of the array, then sift up. O(log_d n)
+    // ------------------------------------------------------------------------
+    Handle enqueue(const T& key) {
+        DS_COUNT_OP("DaryHeap", "enqueue");
+        std::size_t id = newId();
+        keys.push_back(key);
+        ids.push_back(id);
+        siftUp(keys.size() - 1);
+        return Handle{id, slot[id].generation};
+    }
+
+    // ------------------------------------------------------------------------
+    // dequeue(): remove the best key. The last element moves into the root's
+    // place and sifts down. O(d log_d n)
+    // ------------------------------------------------------------------------
+    typename ErrorPolicy::template result<T> dequeue() {
+        DS_COUNT_OP("DaryHeap", "dequeue");
+        if (isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Priority queue is empty. Nothing to dequeue." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "DaryHeap::dequeue: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        T best = std::move(keys[OFFSET]);
+        releaseId(ids[OFFSET]);
+        if (keys.size() - 1 > OFFSET) {
+            keys[OFFSET] = std::move(keys.back());
+            ids[OFFSET] = ids.back();
+            keys.pop_back();
+            ids.pop_back();
+            siftDown(OFFSET);
+        } else {
+            keys.pop_back();
+            ids.pop_back();
+        }
+        return ErrorPolicy::value(std::move(best));
+    }
+
+    typename ErrorPolicy::template result<T> peek() const {
+        if (isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Priority queue is empty. No front element." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "DaryHeap::peek: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        return ErrorPolicy::value(keys[OFFSET]);
+    }
+
+    // ------------------------------------------------------------------------
+    // decreaseKey(handle, newKey): change one element's key in place.
+    // A better key sifts up (the usual case, O(log_d n)); a worse key is
+    // accepted too and sifts down.
+    // ------------------------------------------------------------------------
+    typename ErrorPolicy::status_type decreaseKey(Handle h, const T& newKey) {
+        DS_COUNT_OP("DaryHeap", "decreaseKey");
+        if (!contains(h)) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Handle " << h.id << " is not in the priority queue." << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::NotFound, "DaryHeap::decreaseKey: stale handle");
+        }
+        std::size_t p = slot[h.id].index;
+        bool better = comp(newKey, keys[p]);
+        keys[p] = newKey;
+        if (better) {
+            siftUp(p);
+        } else {
+            siftDown(p);
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // ------------------------------------------------------------------------
+    // heapify(first, last): replace the contents with a range in O(n)
+    // (Floyd's method: sift down every internal node, bottom level first;
+    // most nodes are near the bottom and move only a step or two).
+    // The second overload writes each element's Handle to `handles`, in
+    // range order.
+    // ------------------------------------------------------------------------
+    template <typename InputIt>
+    void heapify(InputIt first, InputIt last) {
+        heapifyImpl(first, last, [](Handle) {});
+    }
+
+    template <typename InputIt, typename OutputIt>
+    void heapify(InputIt first, InputIt last, OutputIt handles) {
+        heapifyImpl(first, last, [&handles](Handle h) { *handles++ = h; });
+    }
+
+    // std::priority_queue-style names
+    Handle push(const T& key) { return enqueue(key); }
+    typename ErrorPolicy::template result<T> pop() { return dequeue(); }
+    typename ErrorPolicy::template result<T> top() const { return peek(); }
+
+    // Footprint: four growable arrays (keys, ids, slots, free ids)
+    memusage::MemoryUsage memoryUsage() const {
+        memusage::MemoryUsage usage;
+        usage.elements = size();
+        usage.payloadBytes = size() * sizeof(T);
+        std::size_t arrays[] = {keys.capacity() * sizeof(T), ids.capacity() * sizeof(std::size_t),
+                                slot.capacity() * sizeof(Slot), freeIds.capacity() * sizeof(std::size_t)};
+        std::size_t reserved = 0;
+        for (std::size_t bytes : arrays) {
+            if (bytes == 0) continue;
+            reserved += bytes;
+            usage.allocatorSlackBytes += memusage::mallocBlockSize(bytes) - bytes;
+            usage.heapBlocks++;
+        }
+        usage.overheadBytes = reserved + sizeof(*this) - usage.payloadBytes;
+        return usage;
+    }
+};
+
+
+// ============================================================================
+// 2) PairingHeap: a heap-ordered multiway tree of nodes
+// ----------------------------------------------------------------------------
+// Each node keeps: its key, its FIRST child, its next sibling, and `prev`
+// (the previous sibling, or the parent for a first child) so it can be cut
+// out of the tree in O(1).
+//
+// meld(a, b): the root with the worse key becomes the first child of the
+// other. That single step is the whole trick:
+//   enqueue       = meld(root, new node)                         O(1)
+//   decreaseKey   = cut the node's subtree out, meld it with root O(1)
+//   dequeue       = remove the root, then combine its children in
+//                   TWO PASSES: meld pairs left to right, then fold the
+//                   results right to left                   O(log n) amortized
+// The two-pass rule keeps the tree shallow over a sequence of operations
+// (Fredman, Sedgewick, Sleator & Tarjan, 1986).
+//
+// Handles are node pointers: valid until that element is dequeued.
+// ============================================================================
+
+template <typename T>
+struct PairingNode {
+    T key;
+    PairingNode* child;     // first (leftmost) child
+    PairingNode* sibling;   // next sibling to the right
+    PairingNode* prev;      // left sibling, or parent if this is the first child
+
+    explicit PairingNode(const T& value) : key(value), child(nullptr), sibling(nullptr), prev(nullptr) {}
+};
+
+template <typename T = int, typename Compare = std::less<T>, typename ErrorPolicy = errpolicy::Print>
+class PairingHeap {
+public:
+    class Handle {
+    public:
+        Handle() : node(nullptr) {}
+
+    private:
+        friend class PairingHeap;
+        explicit Handle(PairingNode<T>* n) : node(n) {}
+        PairingNode<T>* node;
+    };
+
+private:
+    PairingNode<T>* root;
+    std::size_t count;
+    Compare comp;
+
+    // Both arguments must be detached roots (no sibling, no prev)
+    PairingNode<T>* meld(PairingNode<T>* a, PairingNode<T>* b) {
+        if (a == nullptr) return b;
+        if (b == nullptr) return a;
+        if (comp(b->key, a->key)) std::swap(a, b);
+        b->prev = a;                    // b becomes a's first child
+        b->sibling = a->child;
+        if (a->child != nullptr) a->child->prev = b;
+        a->child = b;
+        return a;
+    }
+
+    // Combine a sibling list into one tree (the two-pass rule, no recursion)
+    PairingNode<T>* mergePairs(PairingNode<T>* first) {
+        if (first == nullptr) return nullptr;
+        // Pass 1, left to right: meld neighbours in pairs. The results are
+        // chained through `sibling` in REVERSE order, ready for pass 2.
+        PairingNode<T>* pairs = nullptr;
+        while (first != nullptr) {
+            PairingNode<T>* a = first;
+            PairingNode<T>* b = a->sibling;
+            first = (b != nullptr) ? b->sibling : nullptr;
+            a->sibling = a->prev = nullptr;
+            if (b != nullptr) b->sibling = b->prev = nullptr;
+            PairingNode<T>* merged = meld(a, b);
+            merged->sibling = pairs;
+            pairs = merged;
+        }
+        // Pass 2, right to left: fold every pair into one tree
+        PairingNode<T>* result = pairs;
+        pairs = pairs->sibling;
+        result->sibling = nullptr;
+        while (pairs != nullptr) {
+            PairingNode<T>* next = pairs->sibling;
+            pairs->sibling = nullptr;
+            result = meld(result, pairs);
+            pairs = next;
+        }
+        return result;
+    }
+
+    // Unlink a non-root node (and its subtree) from its parent / siblings
+    void cut(PairingNode<T>* node) {
+        if (node->prev->child == node) {
+            node->prev->child = node->sibling;   // node was the first child
+        } else {
+            node->prev->sibling = node->sibling;
+        }
+        if (node->sibling != nullptr) node->sibling->prev = node->prev;
+        node->sibling = node->prev = nullptr;
+    }
+
+public:
+    explicit PairingHeap(Compare compare = Compare()) : root(nullptr), count(0), comp(compare) {}
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    ~PairingHeap() { clear(); }
+
+    std::size_t size() const { return count; }
+    bool isEmpty() const { return root == nullptr; }
+
+    // Free every node without recursion: a node's child list is spliced
+    // in front of the nodes still waiting to be freed
+    void clear() {
+        PairingNode<T>* pending = root;
+        while (pending != nullptr) {
+            PairingNode<T>* node = pending;
+            if (node->child != nullptr) {
+                PairingNode<T>* tail = node->child;
+                while (tail->sibling != nullptr) tail = tail->sibling;
+                tail->sibling = node->sibling;
+                pending = node->child;
+            } else {
+                pending = node->sibling;
+            }
+            delete node;
+        }
+        DS_COUNT_FREES("PairingHeap", count);
+        root = nullptr;
+        count = 0;
+    }
+
+    Handle enqueue(const T& key) {
+        DS_COUNT_OP("PairingHeap", "enqueue");
+        PairingNode<T>* node = new PairingNode<T>(key);
+        DS_COUNT_ALLOC("PairingHeap");
+        root = meld(root, node);
+        count++;
+        return Handle(node);
+    }
+
+    typename ErrorPolicy::template result<T> dequeue() {
+        DS_COUNT_OP("PairingHeap", "dequeue");
+        if (root == nullptr) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Priority queue is empty. Nothing to dequeue." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "PairingHeap::dequeue: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        PairingNode<T>* old = root;
+        T best = std::move(old->key);
+        root = mergePairs(old->child);
+        delete old;
+        DS_COUNT_FREE("PairingHeap");
+        count--;
+        return ErrorPolicy::value(std::move(best));
+    }
+
+    typename ErrorPolicy::template result<T> peek() const {
+        if (root == nullptr) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Priority queue is empty. No front element." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "PairingHeap::peek: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        return ErrorPolicy::value(root->key);
+    }
+
+    // ------------------------------------------------------------------------
+    // decreaseKey(handle, newKey): O(1) for a better key (cut + meld).
+    // A worse key also works but costs like a dequeue: the node's children
+    // are merged back first, then the node is re-inserted alone.
+    // ------------------------------------------------------------------------
+    typename ErrorPolicy::status_type decreaseKey(Handle h, const T& newKey) {
+        DS_COUNT_OP("PairingHeap", "decreaseKey");
+        PairingNode<T>* node = h.node;
+        if (node == nullptr) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Empty handle: nothing to update." << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::NotFound, "PairingHeap::decreaseKey: empty handle");
+        }
+        if (comp(newKey, node->key)) {
+            node->key = newKey;
+            if (node != root) {
+                cut(node);
+                root = meld(root, node);
+            }
+        } else {
+            PairingNode<T>* children = mergePairs(node->child);
+            node->child = nullptr;
+            node->key = newKey;
+            if (node == root) {
+                root = meld(children, node);
+            } else {
+                cut(node);
+                root = meld(meld(root, children), node);
+            }
+        }
+        return ErrorPolicy::ok();
+    }
+
+    Handle push(const T& key) { return enqueue(key); }
+    typename ErrorPolicy::template result<T> pop() { return dequeue(); }
+    typename ErrorPolicy::template result<T> top() const { return peek(); }
+
+    // Footprint: one node (key + 3 pointers) per element
+    memusage::MemoryUsage memoryUsage() const {
+        const std::size_t nodeBytes = sizeof(PairingNode<T>);
+        memusage::MemoryUsage usage;
+        usage.elements = count;
+        usage.payloadBytes = count * sizeof(T);
+        usage.overheadBytes = count * (nodeBytes - sizeof(T)) + sizeof(*this);
+        usage.allocatorSlackBytes = count * (memusage::mallocBlockSize(nodeBytes) - nodeBytes);
+        usage.heapBlocks = count;
+        return usage;
+    }
+};
+
+
+// ============================================================================
+// TEST HARNESS (main) — a tiny job dispatcher
+// ----------------------------------------------------------------------------
+// Keys are deadlines: the smallest deadline runs first. One job is
+// rescheduled earlier with decreaseKey before dispatching starts.
+// ============================================================================
+
+#ifndef DS_NO_DEMO_MAIN   // define it to #include this file from a benchmark
+int main() {
+    DaryHeap<int> jobs;
+    jobs.enqueue(40);
+    jobs.enqueue(10);
+    DaryHeap<int>::Handle report = jobs.enqueue(70);
+    jobs.enqueue(25);
+
+    cout << "Next deadline (peek): " << jobs.peek() << endl;
+    jobs.decreaseKey(report, 5);          // report is now urgent
+    cout << "DaryHeap order: ";
+    while (!jobs.isEmpty()) cout << jobs.dequeue() << " ";
+    cout << endl;
+    jobs.dequeue();                        // underflow message, returns -1
+
+    // O(n) construction from a range
+    int deadlines[] = {9, 3, 7, 1, 8, 2, 6, 4, 5};
+    vector<DaryHeap<int>::Handle> handles;
+    jobs.heapify(begin(deadlines), end(deadlines), back_inserter(handles));
+    jobs.decreaseKey(handles[0], 0);      // the job with deadline 9 -> 0
+    cout << "Stale handle still valid? " << (jobs.contains(report) ? "yes" : "no") << endl;
+    cout << "After heapify:  ";
+    while (!jobs.isEmpty()) cout << jobs.pop() << " ";
+    cout << endl;
+
+    // Same dispatcher on a pairing heap
+    PairingHeap<int> pairing;
+    pairing.enqueue(40);
+    pairing.enqueue(10);
+    PairingHeap<int>::Handle late = pairing.enqueue(70);
+    pairing.enqueue(25);
+    pairing.decreaseKey(late, 5);
+    cout << "PairingHeap order: ";
+    while (!pairing.isEmpty()) cout << pairing.dequeue() << " ";
+    cout << endl;
+
+    return 0;
+}
+#endif // DS_NO_DEMO_MAIN
@@ -0,0 +1,338 @@
+#include <atomic>
+#include <cstddef>      // std::size_t
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EpochReclaim.h"    // epoch::QuiescentDomain: grace periods for retired nodes
+#include "Instrumentation.h" // DS_COUNT_* hooks (active only with -DDS_INSTRUMENT)
+#include "MemoryUsage.h"     // memusage::MemoryUsage footprint breakdown
+
+using namespace std;
+
+// ============================================================================
+// RCU LIST (Read-Copy-Update) — STUDY GUIDE VERSION
+// ----------------------------------------------------------------------------
+// For tables that are READ ALL THE TIME and CHANGED RARELY (configuration,
+// routing entries): hundreds of reader threads, a few updates per second.
+//
+// Rules of the game:
+//
+// 1) READERS TAKE NOTHING. No mutex, no counter, no read-modify-write, no
+//    fence. A lookup is a plain walk over `next` pointers (acquire loads,
+//    which are ordinary moves on x86 and ARMv8.3+ LDAPR). Readers never wait
+//    for anybody: wait-free.
+//
+// 2) WRITERS NEVER CHANGE WHAT A READER MAY BE LOOKING AT. Writers take one
+//    writer mutex (writers only wait for writers) and then:
+//      insert   build the node completely, THEN publish it with one release
+//               store into pred->next
+//      delete   one release store: pred->next = cur->next
+//      update   COPY the node with the new value, link the copy in place of
+//               the old one (copy-on-update). A reader sees the old value or
+//               the new one, never half of each.
+//      replace  build a whole new list off to the side, swap `head`
+//
+// 3) WHEN IS AN OLD NODE FREED? After a GRACE PERIOD: once every reader that
+//    might still be standing on it has said "I hold no pointers right now".
+//    Each reader thread:
+//        RcuList<int>::Reader reader(list);   // online for its lifetime
+//        ... lookups ...
+//        reader.quiescent();                  // now and then, between lookups
+//    A thread that never registers can still call searchNode(); it then goes
+//    online/offline around each call (one fence, still no lock).
+//    Retired nodes wait in epoch::QuiescentDomain until the grace period ends.
+//
+// Cost: writes are slower (mutex, copies, bookkeeping) and a reader that
+// stays online without calling quiescent() delays freeing (memory grows, it
+// is never freed too early).
+// ============================================================================
+
+template <typename T>
+struct RcuNode {
+    T data;                           // never changes once published
+    std::atomic<RcuNode*> next{nullptr};
+    explicit RcuNode(const T& val) : data(val) {}
+};
+
+template <typename T = int>
+class RcuList {
+private:
+    using Node = RcuNode<T>;
+
+    // A whole old list, retired at once by replaceAll()
+    struct RetiredChain {
+        Node* first;
+        ~RetiredChain() {
+            while (first != nullptr) {
+                Node* next = first->next.load(std::memory_order_relaxed);
+                delete first;
+                DS_COUNT_FREE("RcuList");
+                first = next;
+            }
+        }
+    };
+
+    std::atomic<Node*> head{nullptr};
+    Node* tail = nullptr;              // writers only (under writeLock)
+    std::atomic<std::size_t> nodeCount{0};
+    std::mutex writeLock;              // serialises writers; readers never touch it
+    mutable epoch::QuiescentDomain rcu;
+
+    // Writer helper: first node holding value and its predecessor
+    Node* findForWrite(const T& value, Node*& pred) const {
+        pred = nullptr;
+        Node* cur = head.load(std::memory_order_relaxed);
+        while (cur != nullptr && !(cur->data == value)) {
+            pred = cur;
+            cur = cur->next.load(std::memory_order_relaxed);
+        }
+        return cur;
+    }
+
+    // Writer helper: make `pred` (or head) point to `node`, readers included
+    void publishAfter(Node* pred, Node* node) {
+        if (pred == nullptr) head.store(node, std::memory_order_release);
+        else pred->next.store(node, std::memory_order_release);
+    }
+
+public:
+    RcuList() = default;
+
+    // No reader may be using the list any more
+    ~RcuList() {
+        RetiredChain all{head.load(std::memory_order_relaxed)};
+        rcu.drain();
+    }
+
+    RcuList(const RcuList&) = delete;
+    RcuList& operator=(const RcuList&) = delete;
+
+    // ------------------------------------------------------------------------
+    // Reader registration (RAII): online for the object's lifetime
+    // ------------------------------------------------------------------------
+    class Reader {
+    public:
+        explicit Reader(const RcuList& list) : list_(list) { list_.rcu.online(); }
+        ~Reader() { list_.rcu.offline(); }
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Call between lookups: no pointer from an earlier lookup is kept
+        void quiescent() { list_.rcu.quiescent(); }
+
+    private:
+        const RcuList& list_;
+    };
+
+    std::size_t size() const { return nodeCount.load(std::memory_order_relaxed); }
+    bool isEmpty() const { return head.load(std::memory_order_relaxed) == nullptr; }
+
+    // Nodes retired but not yet freed (waiting for a grace period)
+    std::size_t pendingReclaim() const { return rcu.pending(); }
+
+    // ------------------------------------------------------------------------
+    // READERS: no locks, no read-modify-write
+    // ------------------------------------------------------------------------
+    bool searchNode(const T& searchVal) const {
+        DS_COUNT_OP("RcuList", "searchNode");
+        epoch::QuiescentDomain::ReadSection section(rcu);
+        for (Node* cur = head.load(std::memory_order_acquire); cur != nullptr;
+             cur = cur->next.load(std::memory_order_acquire)) {
+            if (cur->data == searchVal) return true;
+        }
+        return false;
+    }
+
+    // Copy of the first value for which match(value) is true, e.g. a routing
+    // entry looked up by its prefix. The copy stays valid after quiescent().
+    template <typename Match>
+    bool findIf(Match match, T& out) const {
+        epoch::QuiescentDomain::ReadSection section(rcu);
+        for (Node* cur = head.load(std::memory_order_acquire); cur != nullptr;
+             cur = cur->next.load(std::memory_order_acquire)) {
+            if (match(cur->data)) {
+                out = cur->data;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // f(value) for every node of ONE consistent-enough snapshot: nodes
+    // added or removed during the walk may or may not be seen
+    template <typename F>
+    void forEach(F f) const {
+        epoch::QuiescentDomain::ReadSection section(rcu);
+        for (Node* cur = head.load(std::memory_order_acquire); cur != nullptr;
+             cur = cur->next.load(std::memory_order_acquire)) {
+            f(cur->data);
+        }
+    }
+
+    std::vector<T> toVector() const {
+        std::vector<T> values;
+        values.reserve(size());
+        forEach([&values](const T& v) { values.push_back(v); });
+        return values;
+    }
+
+    void print() const {
+        forEach([](const T& v) { cout << v << " -> "; });
+        cout << "nullptr" << endl;
+    }
+
+    // ------------------------------------------------------------------------
+    // WRITERS: one at a time, never modify a published node
+    // ------------------------------------------------------------------------
+    void insertAtBeggining(const T& val) {
+        DS_COUNT_OP("RcuList", "insertAtBeggining");
+        Node* node = new Node(val);
+        DS_COUNT_ALLOC("RcuList");
+        std::lock_guard<std::mutex> guard(writeLock);
+        Node* first = head.load(std::memory_order_relaxed);
+        node->next.store(first, std::memory_order_relaxed);
+        head.store(node, std::memory_order_release);   // fully built before readers can see it
+        if (tail == nullptr) tail = node;
+        nodeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void insertAtEnd(const T& val) {
+        DS_COUNT_OP("RcuList", "insertAtEnd");
+        Node* node = new Node(val);
+        DS_COUNT_ALLOC("RcuList");
+        std::lock_guard<std::mutex> guard(writeLock);
+        publishAfter(tail, node);
+        tail = node;
+        nodeCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Unlink the first node holding target; freed after a grace period
+    bool deleteByValue(const T& target) {
+        DS_COUNT_OP("RcuList", "deleteByValue");
+        std::lock_guard<std::mutex> guard(writeLock);
+        Node* pred = nullptr;
+        Node* cur = findForWrite(target, pred);
+        if (cur == nullptr) return false;
+        publishAfter(pred, cur->next.load(std::memory_order_relaxed));
+        if (cur == tail) tail = pred;
+        nodeCount.fetch_sub(1, std::memory_order_relaxed);
+        // cur->next is left alone: a reader standing on cur walks on normally
+        rcu.retire(cur);
+        DS_COUNT_FREE("RcuList");
+        return true;
+    }
+
+    // COPY-ON-UPDATE: replace the first node holding oldVal with a new node
+    // holding newVal, in the same place
+    bool updateValue(const T& oldVal, const T& newVal) {
+        DS_COUNT_OP("RcuList", "updateValue");
+        Node* copy = new Node(newVal);
+        DS_COUNT_ALLOC("RcuList");
+        std::lock_guard<std::mutex> guard(writeLock);
+        Node* pred = nullptr;
+        Node* cur = findForWrite(oldVal, pred);
+        if (cur == nullptr) {
+            delete copy;
+            DS_COUNT_FREE("RcuList");
+            return false;
+        }
+        copy->next.store(cur->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        publishAfter(pred, copy);
+        if (cur == tail) tail = copy;
+        rcu.retire(cur);
+        DS_COUNT_FREE("RcuList");
+        return true;
+    }
+
+    // Build a new list from `values` off to the side and publish it with ONE
+    // store; readers see either the whole old table or the whole new one
+    void replaceAll(const std::vector<T>& values) {
+        DS_COUNT_OP("RcuList", "replaceAll");
+        Node* first = nullptr;
+        Node* last = nullptr;
+        for (const T& v : values) {
+            Node* node = new Node(v);
+            DS_COUNT_ALLOC("RcuList");
+            if (last == nullptr) first = node;
+            else last->next.store(node, std::memory_order_relaxed);
+            last = node;
+        }
+        std::lock_guard<std::mutex> guard(writeLock);
+        Node* old = head.exchange(first, std::memory_order_acq_rel);
+        tail = last;
+        nodeCount.store(values.size(), std::memory_order_relaxed);
+        if (old != nullptr) rcu.retire(new RetiredChain{old});
+    }
+
+    // Wait until every node retired so far is freed (synchronize_rcu).
+    // Never call it from an online reader thread: it waits for readers.
+    void synchronize() { rcu.synchronize(); }
+
+    // Payload plus one `next` per node; the container itself carries the
+    // per-thread reader slots (one cache line each). Nodes waiting for a
+    // grace period are not counted.
+    memusage::MemoryUsage memoryUsage() const {
+        std::size_t n = size();
+        memusage::MemoryUsage usage;
+        usage.elements = n;
+        usage.payloadBytes = n * sizeof(T);
+        usage.overheadBytes = n * (sizeof(Node) - sizeof(T)) + sizeof(*this);
+        usage.allocatorSlackBytes = n * (memusage::mallocBlockSize(sizeof(Node)) - sizeof(Node));
+        usage.heapBlocks = n;
+        return usage;
+    }
+};
+
+// ============================================================================
+// TEST HARNESS (main) — readers look up while a writer keeps updating
+// ============================================================================
+
+#ifndef DS_NO_DEMO_MAIN   // define it to #include this file from a benchmark
+int main() {
+    RcuList<string> routes;
+    routes.insertAtEnd("10.0.0.0/8 via eth0");
+    routes.insertAtEnd("192.168.0.0/16 via eth1");
+    routes.insertAtEnd("0.0.0.0/0 via eth2");
+    routes.print();
+
+    // The writer flips the eth1 route back and forth while three readers
+    // look up the default route, which is updated but never missing
+    std::atomic<bool> stop{false};
+    std::atomic<long> lookups{0}, misses{0};
+    vector<thread> readers;
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&] {
+            RcuList<string>::Reader reader(routes);
+            while (!stop.load(std::memory_order_relaxed)) {
+                string route;
+                bool found = routes.findIf([](const string& s) { return s.compare(0, 9, "0.0.0.0/0") == 0; }, route);
+                if (!found) misses++;
+                lookups++;
+                reader.quiescent();
+            }
+        });
+    }
+    for (int i = 0; i < 2000; i++) {
+        if (i % 2 == 0) routes.updateValue("192.168.0.0/16 via eth1", "192.168.0.0/16 via eth3");
+        else routes.updateValue("192.168.0.0/16 via eth3", "192.168.0.0/16 via eth1");
+        routes.updateValue(i % 2 == 0 ? "0.0.0.0/0 via eth2" : "0.0.0.0/0 via eth4",
+                           i % 2 == 0 ? "0.0.0.0/0 via eth4" : "0.0.0.0/0 via eth2");
+        if (i % 100 == 0) this_thread::yield();
+    }
+    stop = true;
+    for (thread& t : readers) t.join();
+    cout << "Lookups: " << lookups << ", default route missing: " << misses << " (expected 0)" << endl;
+
+    routes.synchronize();
+    cout << "Waiting for a grace period after synchronize(): " << routes.pendingReclaim() << endl;
+
+    routes.deleteByValue("10.0.0.0/8 via eth0");
+    routes.replaceAll({"10.1.0.0/16 via eth5", "0.0.0.0/0 via eth2"});
+    routes.print();
+    cout << "Contains default route? " << (routes.searchNode("0.0.0.0/0 via eth2") ? "yes" : "no") << endl;
+    return 0;
+}
+#endif // DS_NO_DEMO_MAIN
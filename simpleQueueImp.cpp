@@ -1,4 +1,14 @@
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "Serialization.h"
 using namespace std;
 
 // ============================================================================
@@ -24,7 +34,8 @@ using namespace std;
 // (GeeksforGeeks, 2025; Tutorialspoint, n.d.). [1](https://cplusplus.com/doc/tutorial/dynamic/)[2](https://en.cppreference.com/w/cpp/language/namespace.html)
 //
 // HOW THIS IMPLEMENTATION WORKS:
-// - Uses a fixed-size array (capacity is MAX_SIZE).
+// - Uses a fixed-size array (capacity is MAX_SIZE, a template parameter that
+//   defaults to 10; the element type T defaults to int).
 // - Uses two indices:
 //     front -> index of the current front element (next to remove)
 //     rear  -> index of the current rear element (last inserted)
@@ -54,11 +65,23 @@ using namespace std;
 // This can be unsafe if -1 is a valid queue value; modern designs may use
 // exceptions or std::optional<int>. We keep -1 for least impact.
 // (Overflow/underflow discussion appears in array-queue explanations). [1](https://cplusplus.com/doc/tutorial/dynamic/)
+//
+// ERROR POLICY (template parameter, see ErrorPolicy.h):
+// - errpolicy::Print (default) keeps every message above, including the
+//   "Enqueued:" / "Dequeued:" trace printed on EVERY call.
+// - errpolicy::Silent / Throw / ReturnExpected / Callback<f> print nothing;
+//   the messages sit inside `if constexpr` and are compiled out.
+//
+// CONSTEXPR: with a non-printing policy the queue can be used inside constant
+// expressions (every operation except display() is constexpr).
 // ============================================================================
 
+template <typename T = int, std::size_t Capacity = 10, typename ErrorPolicy = errpolicy::Print>
 class SimpleQueue {
-    static const int MAX_SIZE = 10;   // Capacity (fixed size) [1](https://cplusplus.com/doc/tutorial/dynamic/)
-    int queue_array[MAX_SIZE];        // Storage for queue elements
+    static_assert(Capacity > 0 && Capacity <= static_cast<std::size_t>(INT_MAX), "capacity must fit an int index");
+
+    static constexpr int MAX_SIZE = static_cast<int>(Capacity);   // Capacity (fixed size) [1](https://cplusplus.com/doc/tutorial/dynamic/)
+    T queue_array[Capacity];          // Storage for queue elements
     int front;                        // Front index (next to be dequeued)
     int rear;                         // Rear index  (last enqueued)
 
@@ -71,10 +94,7 @@ public:
     // This is a common approach in simple array queue implementations.
     // (Tutorialspoint, n.d.). [2](https://en.cppreference.com/w/cpp/language/namespace.html)
     // ------------------------------------------------------------------------
-    SimpleQueue() {
-        front = -1;
-        rear = -1;
-    }
+    constexpr SimpleQueue() : queue_array{}, front(-1), rear(-1) {}
 
     // ------------------------------------------------------------------------
     // isFull(): overflow check
@@ -84,7 +104,7 @@ public:
     // - it does NOT reuse freed space at the front.
     // (GeeksforGeeks, 2025). [1](https://cplusplus.com/doc/tutorial/dynamic/)
     // ------------------------------------------------------------------------
-    bool isFull() const {
+    constexpr bool isFull() const {
         return (rear == MAX_SIZE - 1);
     }
 
@@ -96,10 +116,22 @@ public:
     // - front > rear (we dequeued everything)
     // (Tutorialspoint, n.d.). [2](https://en.cppreference.com/w/cpp/language/namespace.html)
     // ------------------------------------------------------------------------
-    bool isEmpty() const {
+    constexpr bool isEmpty() const {
         return (front == -1 || front > rear);
     }
 
+    // ------------------------------------------------------------------------
+    // memoryUsage(): footprint breakdown (see MemoryUsage.h)
+    //
+    // The array is part of the object, so the payload is only the elements
+    // between front and rear; every other slot is overhead. Because this is a
+    // LINEAR queue, slots before `front` stay lost until the queue is rebuilt.
+    // ------------------------------------------------------------------------
+    memusage::MemoryUsage memoryUsage() const {
+        std::size_t used = isEmpty() ? 0 : static_cast<std::size_t>(rear - front + 1);
+        return memusage::arrayUsage<T>(used, sizeof(*this));
+    }
+
     // ------------------------------------------------------------------------
     // enqueue(data): insert at REAR
     //
@@ -112,10 +144,12 @@ public:
     // 3) rear++
     // 4) store element at queue_array[rear]
     // ------------------------------------------------------------------------
-    void enqueue(int data) {
+    constexpr typename ErrorPolicy::status_type enqueue(const T& data) {
         if (isFull()) {
-            cout << "Queue Overflow. Cannot enqueue " << data << endl;
-            return;
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Overflow. Cannot enqueue " << data << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "SimpleQueue::enqueue: queue is full");
         }
 
         // First enqueue initializes front to 0 (first valid index).
@@ -126,7 +160,10 @@ public:
         rear++;
         queue_array[rear] = data;
 
-        cout << "Enqueued: " << data << endl;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Enqueued: " << data << endl;
+        }
+        return ErrorPolicy::ok();
     }
 
     // ------------------------------------------------------------------------
@@ -139,17 +176,22 @@ public:
     // - If empty, cannot dequeue -> print message + return -1 sentinel.
     // (GeeksforGeeks, 2025). [1](https://cplusplus.com/doc/tutorial/dynamic/)
     // ------------------------------------------------------------------------
-    int dequeue() {
+    constexpr typename ErrorPolicy::template result<T> dequeue() {
         if (isEmpty()) {
-            cout << "Queue Underflow. Cannot dequeue from an empty queue." << endl;
-            return -1; // sentinel
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Underflow. Cannot dequeue from an empty queue." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "SimpleQueue::dequeue: queue is empty",
+                                          errpolicy::sentinel<T>()); // sentinel
         }
 
-        int dequeued_data = queue_array[front];
+        T dequeued_data = queue_array[front];
         front++;
 
-        cout << "Dequeued: " << dequeued_data << endl;
-        return dequeued_data;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Dequeued: " << dequeued_data << endl;
+        }
+        return ErrorPolicy::value(dequeued_data);
     }
 
     // ------------------------------------------------------------------------
@@ -161,12 +203,89 @@ public:
     //
     // If empty, prints message + returns sentinel (-1).
     // ------------------------------------------------------------------------
-    int peek() const {
+    constexpr typename ErrorPolicy::template result<T> peek() const {
         if (isEmpty()) {
-            cout << "Queue is empty. No front element." << endl;
-            return -1;
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue is empty. No front element." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "SimpleQueue::peek: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        return ErrorPolicy::value(queue_array[front]);
+    }
+
+    // ------------------------------------------------------------------------
+    // room(): how many more values enqueue() will accept
+    //
+    // LINEAR design again: only the slots after `rear` count, whatever was
+    // dequeued from the front.
+    // ------------------------------------------------------------------------
+    constexpr std::size_t room() const {
+        return static_cast<std::size_t>(MAX_SIZE - 1 - rear);
+    }
+
+    // ------------------------------------------------------------------------
+    // enqueueBulk(values, n): all n values at the rear, or none (Overflow)
+    //
+    // One copy (memcpy for trivially copyable T) instead of n enqueue()
+    // calls, and one message instead of n for the Print policy.
+    // ------------------------------------------------------------------------
+    typename ErrorPolicy::status_type enqueueBulk(const T* values, std::size_t n) {
+        if (n > room()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Overflow. Cannot enqueue " << n << " elements" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "SimpleQueue::enqueueBulk: not enough room");
+        }
+        if (n == 0) return ErrorPolicy::ok();
+        if (front == -1) {
+            front = 0;
         }
-        return queue_array[front];
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::memcpy(&queue_array[rear + 1], values, n * sizeof(T));
+        } else {
+            std::copy(values, values + n, &queue_array[rear + 1]);
+        }
+        rear += static_cast<int>(n);
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Enqueued " << n << " elements" << endl;
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // ------------------------------------------------------------------------
+    // writeTo(out): the values front -> rear through a buffered writer
+    // (fastio::Writer, FastIO.h), one per line: the bulk version of display()
+    // ------------------------------------------------------------------------
+    template <typename Out>
+    void writeTo(Out& out) const {
+        if (!isEmpty()) {
+            out.writeValues(&queue_array[front], static_cast<std::size_t>(rear - front + 1));
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // serialize(path) / deserialize(path): binary save and load (Serialization.h)
+    //
+    // The live range front..rear is already one array, so Raw is a single
+    // write. deserialize() replaces the contents: the values land at index 0
+    // (one memcpy for Raw), and a file holding more than MAX_SIZE values
+    // throws std::runtime_error before anything changes.
+    // ------------------------------------------------------------------------
+    void serialize(const string& path, serial::Encoding encoding = serial::Encoding::Auto) const {
+        const T* first = isEmpty() ? queue_array : &queue_array[front];
+        std::size_t n = isEmpty() ? 0 : static_cast<std::size_t>(rear - front + 1);
+        serial::save<T>(path, serial::Kind::SimpleQueue, first, first + n, n, encoding);
+    }
+
+    void deserialize(const string& path) {
+        serial::Reader<T> in(path);
+        if (in.size() > Capacity) {
+            throw std::runtime_error("SimpleQueue::deserialize: " + path + " holds more values than the capacity");
+        }
+        in.readInto(queue_array, in.size());
+        front = in.size() == 0 ? -1 : 0;
+        rear = static_cast<int>(in.size()) - 1;
     }
 
     // ------------------------------------------------------------------------
@@ -192,6 +311,190 @@ public:
 };
 
 
+// ============================================================================
+// CircularQueue — the fix for the LINEAR queue limitation above
+// ----------------------------------------------------------------------------
+// Same FIFO interface, but indices wrap around the end of the array, so space
+// freed by dequeue() is reused and the queue holds exactly Capacity elements.
+//
+//   head  -> index of the front element
+//   count -> number of stored elements (tail = (head + count) wrapped)
+//
+// Keeping a count (instead of front/rear) avoids the classic "is head == tail
+// empty or full?" ambiguity without wasting a slot.
+//
+// WRAPAROUND COST:
+// - Capacity a power of two (8, 16, 1024...): `i & (Capacity - 1)`, one AND.
+// - Any other Capacity: `i % Capacity`, an integer division.
+// The choice is made at compile time with `if constexpr`, so there is no branch.
+//
+// BULK OPERATIONS:
+// enqueueBulk / dequeueBulk move n elements as at most TWO contiguous copies
+// (up to the end of the array, then from index 0). For trivially copyable T
+// (int, plain structs) those copies are memcpy calls.
+// ============================================================================
+
+template <typename T = int, std::size_t Capacity = 16, typename ErrorPolicy = errpolicy::Print>
+class CircularQueue {
+    static_assert(Capacity > 0, "a queue needs at least one slot");
+
+    static constexpr bool POWER_OF_TWO = (Capacity & (Capacity - 1)) == 0;
+
+    T buffer[Capacity];     // Storage for queue elements
+    std::size_t head;       // Index of the front element
+    std::size_t count;      // Number of stored elements
+
+    static constexpr std::size_t wrap(std::size_t i) {
+        if constexpr (POWER_OF_TWO) {
+            return i & (Capacity - 1);
+        } else {
+            return i % Capacity;
+        }
+    }
+
+    // Copy n elements; memcpy when T allows it
+    static void copyN(T* dst, const T* src, std::size_t n) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n != 0) std::memcpy(dst, src, n * sizeof(T));
+        } else {
+            std::copy(src, src + n, dst);
+        }
+    }
+
+public:
+    constexpr CircularQueue() : buffer{}, head(0), count(0) {}
+
+    static constexpr std::size_t capacity() { return Capacity; }
+    constexpr std::size_t size() const { return count; }
+    constexpr bool isFull() const { return count == Capacity; }
+    constexpr bool isEmpty() const { return count == 0; }
+
+    memusage::MemoryUsage memoryUsage() const {
+        return memusage::arrayUsage<T>(count, sizeof(*this));
+    }
+
+    // Insert at the rear (the slot just after the last element, wrapped)
+    constexpr typename ErrorPolicy::status_type enqueue(const T& data) {
+        if (isFull()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Overflow. Cannot enqueue " << data << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "CircularQueue::enqueue: queue is full");
+        }
+        buffer[wrap(head + count)] = data;
+        count++;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Enqueued: " << data << endl;
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // Remove from the front; head moves forward and wraps to 0 at the end
+    constexpr typename ErrorPolicy::template result<T> dequeue() {
+        if (isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Underflow. Cannot dequeue from an empty queue." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "CircularQueue::dequeue: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        T dequeued_data = buffer[head];
+        head = wrap(head + 1);
+        count--;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Dequeued: " << dequeued_data << endl;
+        }
+        return ErrorPolicy::value(dequeued_data);
+    }
+
+    constexpr typename ErrorPolicy::template result<T> peek() const {
+        if (isEmpty()) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue is empty. No front element." << endl;
+            }
+            return ErrorPolicy::failValue(errpolicy::Error::Underflow, "CircularQueue::peek: queue is empty",
+                                          errpolicy::sentinel<T>());
+        }
+        return ErrorPolicy::value(buffer[head]);
+    }
+
+    // Enqueue all n values or none (Overflow if they do not fit)
+    typename ErrorPolicy::status_type enqueueBulk(const T* values, std::size_t n) {
+        if (n > Capacity - count) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Overflow. Cannot enqueue " << n << " elements" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Overflow, "CircularQueue::enqueueBulk: not enough room");
+        }
+        std::size_t tail = wrap(head + count);
+        std::size_t firstPart = std::min(n, Capacity - tail);   // up to the end of the array
+        copyN(&buffer[tail], values, firstPart);
+        copyN(&buffer[0], values + firstPart, n - firstPart);   // the wrapped remainder
+        count += n;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Enqueued " << n << " elements" << endl;
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // Dequeue exactly n values into `out` in FIFO order, or none (Underflow)
+    typename ErrorPolicy::status_type dequeueBulk(T* out, std::size_t n) {
+        if (n > count) {
+            if constexpr (ErrorPolicy::verbose) {
+                cout << "Queue Underflow. Fewer than " << n << " elements to dequeue" << endl;
+            }
+            return ErrorPolicy::fail(errpolicy::Error::Underflow, "CircularQueue::dequeueBulk: not enough elements");
+        }
+        std::size_t firstPart = std::min(n, Capacity - head);
+        copyN(out, &buffer[head], firstPart);
+        copyN(out + firstPart, &buffer[0], n - firstPart);
+        head = wrap(head + n);
+        count -= n;
+        if constexpr (ErrorPolicy::verbose) {
+            cout << "Dequeued " << n << " elements" << endl;
+        }
+        return ErrorPolicy::ok();
+    }
+
+    // The values front -> rear through a buffered writer (FastIO.h)
+    template <typename Out>
+    void writeTo(Out& out) const {
+        std::size_t firstPart = std::min(count, Capacity - head);
+        out.writeValues(&buffer[head], firstPart);
+        out.writeValues(&buffer[0], count - firstPart);
+    }
+
+    void display() const {
+        if (isEmpty()) {
+            cout << "Queue is empty." << endl;
+            return;
+        }
+
+        cout << "Queue elements (front -> rear): ";
+        for (std::size_t i = 0; i < count; i++) {
+            cout << buffer[wrap(head + i)] << " ";
+        }
+        cout << endl;
+    }
+};
+
+// Compile-time check: wraparound works in a constant expression, both for a
+// power-of-two capacity (bitmask) and for any other capacity (modulo)
+template <std::size_t Capacity>
+constexpr int compileTimeWrapSum() {
+    CircularQueue<int, Capacity, errpolicy::Silent> q;
+    int sum = 0;
+    for (int i = 1; i <= 20; i++) {   // more than Capacity pushes: indices wrap
+        q.enqueue(i);
+        if (q.isFull()) sum += q.dequeue();
+    }
+    while (!q.isEmpty()) sum += q.dequeue();
+    return sum;
+}
+static_assert(compileTimeWrapSum<8>() == 210, "power-of-two circular queue");
+static_assert(compileTimeWrapSum<6>() == 210, "non-power-of-two circular queue");
+
+
 // ============================================================================
 // TEST HARNESS (main) — Demonstrates core queue behaviors
 // ----------------------------------------------------------------------------
@@ -203,6 +506,7 @@ public:
 // A circular queue fixes that. [1](https://cplusplus.com/doc/tutorial/dynamic/)[3](https://intellipaat.com/blog/new-and-delete-operators-in-cpp/)
 // ============================================================================
 
+#ifndef DS_NO_DEMO_MAIN   // define it to #include this file from a benchmark
 int main() {
     SimpleQueue q;
 
@@ -224,6 +528,33 @@ int main() {
     q.enqueue(50);
     q.display();
 
+    // Silent policy: same queue, no output; the bool / sentinel reports errors
+    SimpleQueue<int, 10, errpolicy::Silent> silent;
+    bool accepted = silent.enqueue(7);
+    int fromSilent = silent.dequeue();
+    int underflow = silent.dequeue();   // -1 sentinel, nothing printed
+    cout << "Silent queue: accepted=" << accepted << " got " << fromSilent
+         << " then " << underflow << endl;
+
+    // Circular queue: the gaps left by dequeue() are reused
+    CircularQueue<int, 4> ring;
+    ring.enqueue(1);
+    ring.enqueue(2);
+    ring.enqueue(3);
+    ring.dequeue();
+    ring.enqueue(4);
+    ring.enqueue(5);   // wraps around to slot 0
+    ring.display();
+
+    // Bulk transfer across the wrap point (two memcpy calls per direction)
+    CircularQueue<int, 8, errpolicy::Silent> bulk;
+    int in[6] = {1, 2, 3, 4, 5, 6};
+    int out[6] = {};
+    bulk.enqueueBulk(in, 6);
+    bulk.dequeueBulk(out, 4);
+    bulk.enqueueBulk(in, 6);   // 2 left + 6 new = 8, tail wraps
+    cout << "Circular bulk: size " << bulk.size() << ", front " << bulk.peek() << endl;
+
     // Uncomment to demonstrate underflow:
     /*
     while (!q.isEmpty()) {
@@ -234,6 +565,7 @@ int main() {
 
     return 0;
 }
+#endif // DS_NO_DEMO_MAIN
 
 
 /*